@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// ER-TFTM0784-1 driver benchmark
+//
+// Times fills, lines, triangles, circles, CGROM text, BTE colour expanded
+// glyphs, Show_picture, BTE move and serial flash DMA at each SPI clock in
+// spiSpeeds[] (once on the parallel bus) and prints the results as CSV on
+// Serial, see bench.h for the columns. Capture the output of two library
+// versions and compare them row by row.
+//
+// Wiring as in TFT_1280x400_test (VC-touch board).
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <ER-TFTM0784-1.h>
+#include <2828.h>
+
+#include "bench.h"
+
+//-----------------------------------------------------------------------------
+// RA8876 bus. For the 16-bit 8080 bus use the parallel constructor from
+// TFT_1280x400_test instead; spiSpeeds[] is ignored then.
+//-----------------------------------------------------------------------------
+
+#define SDI_PIN 11
+#define SDO_PIN 12
+#define SCLK_PIN 13
+#define CS_PIN 10
+#define RST_SER_PIN 9
+ER_TFTM0784 tft = ER_TFTM0784(42000000, SDI_PIN, SDO_PIN, SCLK_PIN, CS_PIN, RST_SER_PIN);
+
+#define CS_2828_PIN 25
+#define RST_2828_PIN 28
+#define SDI_2828_PIN 26
+#define SCLK_2828_PIN 27
+SSD2828 Master_bridge = SSD2828(SDI_2828_PIN, SCLK_2828_PIN, CS_2828_PIN, RST_2828_PIN);
+
+#define BACKLIGHT_PIN 24
+
+static const uint32_t spiSpeeds[] = { 4000000, 8000000, 12000000, 20000000, 30000000, 42000000 };
+
+//-----------------------------------------------------------------------------
+void setup(void)
+{
+  pinMode(BACKLIGHT_PIN, OUTPUT);
+  digitalWrite(BACKLIGHT_PIN, HIGH);
+
+  Serial.begin(115200);
+  delay(1000);
+
+  Master_bridge.Reset();
+  tft.RA8876_IO_Init();
+  tft.RA8876_HW_Reset();
+  Master_bridge.Initial();
+  tft.RA8876_initial();
+  tft.Display_ON();
+
+  benchHeader(Serial);
+  if (tft.bus().mode() == 2)
+  {
+    for (uint8_t i = 0; i < sizeof(spiSpeeds) / sizeof(spiSpeeds[0]); i++)
+      benchRun(tft, Serial, spiSpeeds[i]);
+  }
+  else
+    benchRun(tft, Serial, 0);
+  Serial.println("done");
+}
+
+void loop(void)
+{
+}
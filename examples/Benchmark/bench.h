@@ -0,0 +1,343 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 driver benchmarks, shared by Benchmark.ino and the host harness in
+// extras/ra8876_bench.
+//
+// benchRun() times each test for at least BENCH_MIN_US and prints one CSV
+// row per test:
+//
+//   version,bus,hz,test,count,us,rate,unit
+//
+// 'count' operations took 'us' microseconds; 'rate' is count (or bytes) per
+// second in 'unit'. benchHeader() prints the column names. Rows from two
+// driver versions can be joined on bus,hz,test to spot regressions.
+//
+// Layer 1 (shown) and layer 2 (BTE source) are 400x1280 16bpp, as in the
+// TFT_1280x400_test example. sfi_dma reads a frame from serial flash
+// address 0 and only means something with an image stored there.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#define BENCH_W             400
+#define BENCH_H             1280
+#define BENCH_FRAME_BYTES   ((uint32_t)BENCH_W * BENCH_H * 2)
+#define BENCH_LAYER1        0
+#define BENCH_LAYER2        1024000     // 400*1280*2
+#define BENCH_MIN_US        500000      // each test repeats for at least this long
+#define BENCH_PIC_SIDE      32          // show_picture block, pixels
+#define BENCH_GLYPH_W       16          // user font glyph, 1bpp
+#define BENCH_GLYPH_H       32
+#define BENCH_CLEAR_PIXELS  614400UL    // written by LCD_Clear()
+
+// Clock the tests are timed with; ra8876_bench -m times them with the bus
+// model's estimate instead.
+#ifndef BENCH_MICROS
+#define BENCH_MICROS()      micros()
+#endif
+
+// Pixel values do not matter for timing.
+static const uint16_t benchPixels[BENCH_PIC_SIDE * BENCH_PIC_SIDE] PROGMEM = { 0 };
+static const uint8_t benchGlyphBits[BENCH_GLYPH_W * BENCH_GLYPH_H / 8] PROGMEM = { 0 };
+static const char benchString[] = "The quick brown fox jumps over the lazy dog";
+
+static uint32_t benchSeed = 1;
+
+// Repeatable coordinates, so every run draws the same shapes.
+static uint16_t benchRand(uint16_t range)
+{
+    benchSeed = benchSeed * 1103515245UL + 12345;
+    return (benchSeed >> 16) % range;
+}
+
+static const char *benchBusName(uint8_t mode)
+{
+    switch (mode)
+    {
+    case 0: return "par16";
+    case 1: return "par8";
+    default: return "spi";
+    }
+}
+
+static void benchHeader(Print &out)
+{
+    out.println("version,bus,hz,test,count,us,rate,unit");
+}
+
+// 'amount' is operations or bytes, whichever 'unit' counts.
+static void benchRow(Print &out, uint8_t mode, uint32_t hz, const char *test,
+                     uint32_t count, uint32_t us, uint64_t amount, const char *unit)
+{
+    uint32_t rate;
+
+    if (us == 0)
+        us = 1;
+    if (unit[0] == 'K')     // KB/s
+        rate = amount * 1000000 / 1024 / us;
+    else if (unit[0] == 'u')    // us/op
+        rate = us / (count ? count : 1);
+    else
+        rate = amount * 1000000 / us;
+
+    out.print(ER_TFTM0784_VERSION);
+    out.print(",");
+    out.print(benchBusName(mode));
+    out.print(",");
+    out.print(hz);
+    out.print(",");
+    out.print(test);
+    out.print(",");
+    out.print(count);
+    out.print(",");
+    out.print(us);
+    out.print(",");
+    out.print(rate);
+    out.print(",");
+    out.println(unit);
+}
+
+//-----------------------------------------------------------------------------
+template<class TFT>
+static void benchCanvas(TFT &tft, uint32_t addr)
+{
+    tft.Select_Main_Window_16bpp();
+    tft.Main_Image_Start_Address(BENCH_LAYER1);
+    tft.Main_Image_Width(BENCH_W);
+    tft.Main_Window_Start_XY(0, 0);
+
+    tft.Canvas_Image_Start_address(addr);
+    tft.Canvas_image_width(BENCH_W);
+    tft.Active_Window_XY(0, 0);
+    tft.Active_Window_WH(BENCH_W, BENCH_H);
+}
+
+template<class TFT>
+static void benchFill(TFT &tft, uint8_t mode, uint32_t hz, Print &out)
+{
+    uint32_t n = 0, start = BENCH_MICROS(), us;
+
+    do
+    {
+        tft.Foreground_color_65k((n & 1) ? color65k_white : color65k_black);
+        tft.Line_Start_XY(0, 0);
+        tft.Line_End_XY(BENCH_W - 1, BENCH_H - 1);
+        tft.Start_Square_Fill();
+        n++;
+    } while ((us = BENCH_MICROS() - start) < BENCH_MIN_US);
+    tft.fence();                // the last fill is still running
+    us = BENCH_MICROS() - start;
+    benchRow(out, mode, hz, "fill_square", n, us, (uint64_t)n * BENCH_FRAME_BYTES, "KB/s");
+
+    // Pixel by pixel over the bus: once is enough at any clock.
+    start = BENCH_MICROS();
+    tft.LCD_Clear(color65k_black);
+    tft.Check_Mem_WR_FIFO_Empty();
+    us = BENCH_MICROS() - start;
+    benchRow(out, mode, hz, "fill_clear", 1, us, BENCH_CLEAR_PIXELS * 2, "KB/s");
+}
+
+template<class TFT>
+static void benchShapes(TFT &tft, uint8_t mode, uint32_t hz, Print &out)
+{
+    uint32_t n, start, us;
+
+    benchSeed = 1;
+    n = 0;
+    start = BENCH_MICROS();
+    do
+    {
+        tft.Foreground_color_65k(benchRand(0xFFFF));
+        tft.Line_Start_XY(benchRand(BENCH_W), benchRand(BENCH_H));
+        tft.Line_End_XY(benchRand(BENCH_W), benchRand(BENCH_H));
+        tft.Start_Line();
+        n++;
+    } while ((us = BENCH_MICROS() - start) < BENCH_MIN_US);
+    tft.fence();
+    us = BENCH_MICROS() - start;
+    benchRow(out, mode, hz, "lines", n, us, n, "lines/s");
+
+    n = 0;
+    start = BENCH_MICROS();
+    do
+    {
+        tft.Foreground_color_65k(benchRand(0xFFFF));
+        tft.Triangle_Point1_XY(benchRand(BENCH_W), benchRand(BENCH_H));
+        tft.Triangle_Point2_XY(benchRand(BENCH_W), benchRand(BENCH_H));
+        tft.Triangle_Point3_XY(benchRand(BENCH_W), benchRand(BENCH_H));
+        tft.Start_Triangle_Fill();
+        n++;
+    } while ((us = BENCH_MICROS() - start) < BENCH_MIN_US);
+    tft.fence();
+    us = BENCH_MICROS() - start;
+    benchRow(out, mode, hz, "triangles", n, us, n, "triangles/s");
+
+    n = 0;
+    start = BENCH_MICROS();
+    do
+    {
+        tft.Foreground_color_65k(benchRand(0xFFFF));
+        tft.Circle_Center_XY(100 + benchRand(BENCH_W - 200), 100 + benchRand(BENCH_H - 200));
+        tft.Circle_Radius_R(10 + benchRand(90));
+        tft.Start_Circle_or_Ellipse_Fill();
+        n++;
+    } while ((us = BENCH_MICROS() - start) < BENCH_MIN_US);
+    tft.fence();
+    us = BENCH_MICROS() - start;
+    benchRow(out, mode, hz, "circles", n, us, n, "circles/s");
+}
+
+template<class TFT>
+static void benchCgrom(TFT &tft, uint8_t mode, uint32_t hz, Print &out)
+{
+    uint32_t n = 0, start, us;
+
+    tft.Foreground_color_65k(color65k_white);
+    tft.Background_color_65k(color65k_black);
+    tft.CGROM_Select_Internal_CGROM();
+    tft.Font_Select_12x24_24x24();
+    start = BENCH_MICROS();
+    do
+    {
+        tft.Goto_Text_XY((n % 16) * 24, 0);
+        tft.Show_String(benchString);
+        n++;
+    } while ((us = BENCH_MICROS() - start) < BENCH_MIN_US);
+    tft.fence();
+    us = BENCH_MICROS() - start;
+    n *= sizeof(benchString) - 1;
+    benchRow(out, mode, hz, "cgrom_text", n, us, n, "chars/s");
+}
+
+// Glyphs drawn the way Show_user_font() in TFT_1280x400_test does: BTE
+// colour expansion of a 1bpp bitmap into layer 2.
+template<class TFT>
+static void benchGlyphs(TFT &tft, uint8_t mode, uint32_t hz, Print &out)
+{
+    uint32_t n = 0, start, us;
+
+    tft.BTE_S0_Color_16bpp();
+    tft.BTE_S1_Color_16bpp();
+    tft.BTE_Destination_Color_16bpp();
+    tft.BTE_Destination_Memory_Start_Address(BENCH_LAYER2);
+    tft.BTE_Destination_Image_Width(BENCH_W);
+    tft.BTE_Window_Size(BENCH_GLYPH_H, BENCH_GLYPH_W);
+    tft.Foreground_color_65k(color65k_white);
+    tft.Background_color_65k(color65k_black);
+    tft.BTE_ROP_Code(15);
+    tft.BTE_Operation_Code(8);  // colour expansion
+    start = BENCH_MICROS();
+    do
+    {
+        tft.BTE_Destination_Window_Start_XY((n % 12) * BENCH_GLYPH_H, (n / 12 % 80) * BENCH_GLYPH_W);
+        tft.BTE_Enable();
+        tft.Show_picture(sizeof(benchGlyphBits), benchGlyphBits);
+        tft.Check_Mem_WR_FIFO_Empty();
+        tft.Check_BTE_Busy();
+        n++;
+    } while ((us = BENCH_MICROS() - start) < BENCH_MIN_US);
+    benchRow(out, mode, hz, "bte_glyphs", n, us, n, "glyphs/s");
+}
+
+template<class TFT>
+static void benchPicture(TFT &tft, uint8_t mode, uint32_t hz, Print &out)
+{
+    uint32_t n = 0, start, us;
+
+    tft.Active_Window_XY(0, 0);
+    tft.Active_Window_WH(BENCH_PIC_SIDE, BENCH_PIC_SIDE);
+    start = BENCH_MICROS();
+    do
+    {
+        tft.Goto_Pixel_XY(0, 0);
+        tft.Show_picture(BENCH_PIC_SIDE * BENCH_PIC_SIDE, benchPixels);
+        n++;
+    } while ((us = BENCH_MICROS() - start) < BENCH_MIN_US);
+    tft.Check_Mem_WR_FIFO_Empty();
+    us = BENCH_MICROS() - start;
+    tft.Active_Window_WH(BENCH_W, BENCH_H);
+    benchRow(out, mode, hz, "show_picture", n, us, (uint64_t)n * sizeof(benchPixels), "KB/s");
+}
+
+template<class TFT>
+static void benchMove(TFT &tft, uint8_t mode, uint32_t hz, Print &out)
+{
+    uint32_t n = 0, start, us;
+
+    tft.BTE_S0_Color_16bpp();
+    tft.BTE_S0_Memory_Start_Address(BENCH_LAYER2);
+    tft.BTE_S0_Image_Width(BENCH_W);
+    tft.BTE_S0_Window_Start_XY(0, 0);
+    tft.BTE_Destination_Color_16bpp();
+    tft.BTE_Destination_Memory_Start_Address(BENCH_LAYER1);
+    tft.BTE_Destination_Image_Width(BENCH_W);
+    tft.BTE_Destination_Window_Start_XY(0, 0);
+    tft.BTE_Window_Size(BENCH_W, BENCH_H);
+    tft.BTE_ROP_Code(12);
+    tft.BTE_Operation_Code(2);  // move
+    start = BENCH_MICROS();
+    do
+    {
+        tft.BTE_Enable();
+        tft.Check_BTE_Busy();
+        n++;
+    } while ((us = BENCH_MICROS() - start) < BENCH_MIN_US);
+    benchRow(out, mode, hz, "bte_move", n, us, (uint64_t)n * BENCH_FRAME_BYTES, "KB/s");
+}
+
+// Serial flash set up as in DMA_Demo() of TFT_1280x400_test.
+template<class TFT>
+static void benchDma(TFT &tft, uint8_t mode, uint32_t hz, Print &out)
+{
+    uint32_t n = 0, start, us;
+
+    tft.Enable_SFlash_SPI();
+    tft.Select_SFI_1();
+    tft.Select_SFI_DMA_Mode();
+    tft.Select_SFI_24bit_Address();
+    tft.Select_SFI_Waveform_Mode_3();
+    tft.Select_SFI_8_DummyRead();
+    tft.Select_SFI_Dual_Mode0();
+    tft.SPI_Clock_Period(0);
+    tft.SFI_DMA_Destination_Upper_Left_Corner(0, 0);
+    tft.SFI_DMA_Transfer_Width_Height(BENCH_W, BENCH_H);
+    tft.SFI_DMA_Source_Width(BENCH_W);
+    start = BENCH_MICROS();
+    do
+    {
+        tft.SFI_DMA_Source_Start_Address(0);
+        tft.Start_SFI_DMA();
+        tft.Check_Busy_SFI_DMA();
+        n++;
+    } while ((us = BENCH_MICROS() - start) < BENCH_MIN_US);
+    benchRow(out, mode, hz, "sfi_dma", n, us, n, "us/frame");
+}
+
+//-----------------------------------------------------------------------------
+// All tests at the bus clock 'hz' (0: parallel bus, clock not applicable).
+// The display must be initialised; layer 1 is left cleared.
+template<class TFT>
+static void benchRun(TFT &tft, Print &out, uint32_t hz)
+{
+    uint8_t mode = tft.bus().mode();
+
+    if (hz)
+        tft.bus().setSpeed(hz, hz);
+    benchCanvas(tft, BENCH_LAYER1);
+    benchFill(tft, mode, hz, out);
+    benchShapes(tft, mode, hz, out);
+    benchCgrom(tft, mode, hz, out);
+    benchPicture(tft, mode, hz, out);
+    benchGlyphs(tft, mode, hz, out);
+    benchMove(tft, mode, hz, out);
+    benchCanvas(tft, BENCH_LAYER1);
+    benchDma(tft, mode, hz, out);
+    tft.Foreground_color_65k(color65k_black);
+    tft.Line_Start_XY(0, 0);
+    tft.Line_End_XY(BENCH_W - 1, BENCH_H - 1);
+    tft.Start_Square_Fill();
+}
+
+#endif
@@ -0,0 +1,126 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Two ER-TFTM0784-1 on one SPI bus
+//
+// Both RA8876 share SCLK, SDI and SDO and have their own CS and reset. They
+// join one RA8876_SpiGroup: the initialisation and the background are sent
+// once to both panels by broadcast, then each panel gets its own text, with
+// the whole frame in one SPI transaction.
+//
+// Each panel keeps its own SSD2828 bridge, wired as in TFT_1280x400_test.
+// The bridges are stepped together with Boot_Step(), and the RA8876s are
+// set up while the bridges wait, so start-up takes about as long as for one
+// panel rather than one bridge sequence per panel.
+//
+// The group only shares the transaction and the CS framing: it does not
+// queue or order work per display. Drawing for several panels from one
+// loop, as here, needs nothing more; with several threads, give each panel
+// an RA8876_Queue and drain them all inside one begin()/end().
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <ER-TFTM0784-1.h>
+#include <2828.h>
+
+#define SPI_HZ 30000000
+#define SDI_PIN 11
+#define SDO_PIN 12
+#define SCLK_PIN 13
+
+ER_TFTM0784 left = ER_TFTM0784(SPI_HZ, SDI_PIN, SDO_PIN, SCLK_PIN, 10, 9);
+ER_TFTM0784 right = ER_TFTM0784(SPI_HZ, SDI_PIN, SDO_PIN, SCLK_PIN, 8, 7);
+ER_TFTM0784 *const panels[] = { &left, &right };
+#define PANELS (sizeof(panels) / sizeof(panels[0]))
+
+SSD2828 bridges[] = {
+  SSD2828(26, 27, 25, 28),
+  SSD2828(30, 31, 29, 32),
+};
+
+RA8876_SpiGroup wall(SPI);
+
+#define BACKLIGHT_PIN 24
+
+// Runs every bridge step that is due; true once all bridges are done.
+bool bridgesStep(void)
+{
+  static uint32_t due[PANELS];
+  static bool done[PANELS];
+  bool all = true;
+
+  for (uint8_t i = 0; i < PANELS; i++)
+  {
+    if (done[i])
+      continue;
+    if ((int32_t)(millis() - due[i]) >= 0)
+    {
+      uint8_t ms = bridges[i].Boot_Step();
+      due[i] = millis() + ms;
+      done[i] = ms == 0;
+    }
+    all = all && done[i];
+  }
+  return all;
+}
+
+//-----------------------------------------------------------------------------
+void setup(void)
+{
+  pinMode(BACKLIGHT_PIN, OUTPUT);
+  digitalWrite(BACKLIGHT_PIN, HIGH);
+
+  for (uint8_t i = 0; i < PANELS; i++)
+  {
+    panels[i]->bus().setGroup(&wall);
+    bridges[i].Boot_Begin();
+  }
+  bridgesStep();                // reset pulses start
+
+  for (uint8_t i = 0; i < PANELS; i++)
+  {
+    panels[i]->RA8876_IO_Init();
+    panels[i]->RA8876_HW_Reset();
+    bridgesStep();
+  }
+
+  // Identical register sequences: send them once, to both panels. Reads
+  // are answered by 'left' alone.
+  wall.begin(SPI_HZ);
+  wall.broadcast(wall.all());
+  left.RA8876_initial();
+  left.Display_ON();
+  left.Foreground_color_65k(0x001F);
+  left.Square_Start_XY(0, 0);
+  left.Square_End_XY(RA8876_PANEL_WIDTH - 1, RA8876_PANEL_HEIGHT - 1);
+  left.Start_Square_Fill();
+  left.fence();                 // the others finish the fill with 'left'
+  wall.broadcast(0);
+  wall.end();
+  for (uint8_t i = 1; i < PANELS; i++)
+    panels[i]->LCD_ShadowInvalidate();
+
+  while (!bridgesStep())
+    delay(1);
+}
+
+void loop(void)
+{
+  static uint32_t frame;
+  char text[32];
+
+  // One transaction for the whole frame, CS alone switches panels.
+  wall.begin(SPI_HZ);
+  for (uint8_t i = 0; i < PANELS; i++)
+  {
+    snprintf(text, sizeof(text), "panel %u frame %lu", i, (unsigned long)frame);
+    panels[i]->Foreground_color_65k(0xFFFF);
+    panels[i]->Background_color_65k(0x001F);
+    panels[i]->Goto_Text_XY(40, 40);
+    panels[i]->Show_String(text);
+  }
+  wall.end();
+  frame++;
+  delay(100);
+}
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// ra8876_bench - run the Benchmark example's tests from Linux
+//
+//   ra8876_bench [-s HZ[,HZ...]] SPIDEV [GPIOCHIP LINE]
+//       Against a display on a spidev, at each SPI clock given (default
+//       4, 8, 12, 20 and 30 MHz). The SSD2828 is not touched, the tests
+//       run with or without a picture on the panel.
+//   ra8876_bench -n
+//       No hardware: every cycle is answered in-process with an idle
+//       RA8876, so the numbers are the driver's own CPU cost.
+//   ra8876_bench -m [-s HZ[,HZ...]]
+//       No hardware, RA8876_Model answers instead and the tests are timed
+//       on its estimated bus time, at each clock given. The model's counts
+//       for the whole run at each clock go to stderr.
+//
+// CSV goes to stdout, see examples/Benchmark/bench.h for the columns.
+//
+// Build on Linux from this directory:
+//   g++ -O2 -I../../src ra8876_bench.cpp ../../src/*.cpp -o ra8876_bench
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ER-TFTM0784-1.h"
+#include "RA8876_Model.h"
+
+// With -m the tests are timed on the model's bus time.
+static RA8876_Model *benchModel;
+static unsigned long benchMicros()
+{
+    return benchModel ? benchModel->now() / 1000 : micros();
+}
+#define BENCH_MICROS()  benchMicros()
+
+#include "../../examples/Benchmark/bench.h"
+
+#include <stdlib.h>
+
+#define BENCH_MAX_SPEEDS    16
+
+// Stands in for the RA8876: status idle with the write FIFO empty and SDRAM
+// ready, every register reads 0.
+static int benchIdle(void *, struct spi_ioc_transfer *xfer, unsigned count)
+{
+    for (unsigned i = 0; i < count; i++)
+    {
+        const uint8_t *tx = (const uint8_t *)(uintptr_t)xfer[i].tx_buf;
+        uint8_t *rx = (uint8_t *)(uintptr_t)xfer[i].rx_buf;
+        if (rx)
+            rx[1] = (tx[0] == RA8876_SPI_STATUSREAD) ? 0x44 : 0x00;
+    }
+    return 0;
+}
+
+static int usage()
+{
+    fprintf(stderr,
+            "usage: ra8876_bench [-s HZ[,HZ...]] SPIDEV [GPIOCHIP LINE]\n"
+            "       ra8876_bench -n\n"
+            "       ra8876_bench -m [-s HZ[,HZ...]]\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t speeds[BENCH_MAX_SPEEDS] = { 4000000, 8000000, 12000000, 20000000, 30000000 };
+    uint8_t count = 5;
+    bool dry = false, model = false;
+    int arg = 1;
+
+    if (arg < argc && strcmp(argv[arg], "-n") == 0)
+    {
+        dry = true;
+        arg++;
+    }
+    else if (arg < argc && strcmp(argv[arg], "-m") == 0)
+    {
+        dry = model = true;
+        arg++;
+    }
+    if ((!dry || model) && arg + 1 < argc && strcmp(argv[arg], "-s") == 0)
+    {
+        char *p = argv[arg + 1], *end;
+        for (count = 0; count < BENCH_MAX_SPEEDS; p = end + 1)
+        {
+            speeds[count++] = strtoul(p, &end, 0);
+            if (*end != ',')
+                break;
+        }
+        if (*end != '\0')
+            return usage();
+        arg += 2;
+    }
+    if (dry ? arg != argc : (argc - arg != 1 && argc - arg != 3))
+        return usage();
+
+    const char *dev = dry ? NULL : argv[arg];
+    const char *chip = (!dry && argc - arg == 3) ? argv[arg + 1] : NULL;
+    unsigned line = chip ? strtoul(argv[arg + 2], NULL, 0) : 0;
+    ER_TFTM0784 tft(dev, speeds[0], chip, line);
+    RA8876_FilePrint out(stdout), err(stderr);
+    RA8876_Model sim;
+
+    if (model)
+    {
+        sim.attach(tft.bus().spi());
+        benchModel = &sim;
+    }
+    else if (dry)
+    {
+        tft.bus().spi().setHook(benchIdle, NULL);
+        count = 1;
+    }
+    tft.RA8876_IO_Init();
+    if (!tft.bus().ok())
+    {
+        perror(dev);
+        return 1;
+    }
+    tft.RA8876_HW_Reset();
+    tft.RA8876_initial();
+    tft.Display_ON();
+
+    benchHeader(out);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        sim.clearStats();
+        benchRun(tft, out, speeds[i]);
+        if (model)
+        {
+            err.print("at ");
+            err.print((unsigned long)speeds[i]);
+            err.print(" Hz ");
+            sim.report(err);
+        }
+    }
+    return tft.bus().ok() ? 0 : 1;
+}
@@ -0,0 +1,708 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// ra8876_golden - draw the demo scenes into RA8876_Model and compare the
+// picture with a golden one
+//
+//   ra8876_golden [-f CGROM | -s | -n] render OUT.ppm
+//       Draw the scenes into the model and write the 400x1280 canvas.
+//   ra8876_golden [-n] render OUT.ppm SPIDEV [GPIOCHIP LINE]
+//       Draw the same scenes on a display and read the canvas back.
+//   ra8876_golden [-f CGROM | -s | -n] check GOLDEN.ppm
+//       Draw into the model and compare with GOLDEN.ppm: prints the number
+//       of differing pixels and their bounding box, then checks the probe
+//       pixels below; exits 1 if anything differs.
+//   ra8876_golden cgrom SPIDEV [GPIOCHIP LINE] > CGROM
+//       Read the internal CGROM glyphs off a display, for -f.
+//
+// The scenes cover what the demos draw: lines, rectangles, circles,
+// ellipses, curves and triangles, filled and not, CGROM text in three sizes
+// with enlargement and transparency, and BTE moves with ROP, pattern fill,
+// colour expansion, chroma key, alpha blending and solid fill. Serial flash
+// DMA is left out: its picture depends on what is in the flash.
+//
+// A golden picture is only as good as where it came from. One rendered
+// from a panel (render SPIDEV, with its CGROM read by cgrom for -f) checks
+// the model against the hardware. One rendered by the model itself only
+// catches changes: golden/synthetic.ppm in the repository is that kind,
+// so make check in extras/ would pass a model that had always drawn a
+// pixel wrong. After a change that is meant to alter the picture, render
+// it again with -s and check the new one in.
+//
+// The probes are what check knows without the model: pixels worked out by
+// hand from the scene and the RA8876 datasheet, such as line end points,
+// the edges of a fill, one alpha blended pixel and the bit order of colour
+// expansion. They are checked whatever the golden picture.
+//
+// -s draws the text with a made-up glyph table instead of the CGROM, so
+// make check covers the text path: every glyph has its top row and left
+// column set and its code, most significant bit first, in the second row,
+// and the text probes check those. -n leaves the text scene out.
+//
+// Build on Linux from this directory:
+//   g++ -O2 -I../../src ra8876_golden.cpp ../../src/*.cpp -o ra8876_golden
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ER-TFTM0784-1.h"
+#include "RA8876_Model.h"
+
+#include <stdlib.h>
+
+#define GOLDEN_WIDTH    400
+#define GOLDEN_HEIGHT   1280
+#define GOLDEN_SCRATCH  (GOLDEN_WIDTH * GOLDEN_HEIGHT * 2UL)
+
+static const uint16_t goldenPalette[8] = {
+    0xF800, 0x07E0, 0x001F, 0xFFE0, 0x07FF, 0xF81F, 0xFFFF, 0x8410
+};
+
+// Collects a PPM in memory for check.
+class GoldenBuffer : public Print {
+public:
+    GoldenBuffer(size_t size) : data((uint8_t *)malloc(size)), size(size), used(0) { }
+    ~GoldenBuffer() { free(data); }
+    size_t write(uint8_t c)
+    {
+        if (!data || used == size)
+            return 0;
+        data[used++] = c;
+        return 1;
+    }
+
+    uint8_t *data;
+    size_t size;
+    size_t used;
+};
+
+// A pixel whose colour follows from the scene and the datasheet alone.
+struct GoldenProbe {
+    uint16_t x, y;
+    uint16_t colour;
+    const char *what;
+};
+
+static const GoldenProbe goldenProbes[] = {
+    { 10, 10, 0xF800, "line 0 start" },
+    { 390, 120, 0xF800, "line 0 end" },
+    { 9, 10, 0x0000, "before line 0" },
+    { 391, 120, 0x0000, "after line 0" },
+    { 110, 71, 0x8410, "line 7 end" },
+    { 10, 130, 0xF800, "square corner" },
+    { 65, 165, 0x0000, "inside square" },
+    { 140, 130, 0x07E0, "fill top left" },
+    { 250, 200, 0x07E0, "fill bottom right" },
+    { 139, 165, 0x0000, "left of fill" },
+    { 251, 165, 0x0000, "right of fill" },
+    { 195, 129, 0x0000, "above fill" },
+    { 195, 201, 0x0000, "below fill" },
+    // S0 (31,10) is line 7's 0x8410, S1 (31,460) is black: half of each
+    // channel, exactly.
+    { 161, 910, 0x4208, "alpha blend 16/32" },
+    { 270, 910, 0xF81F, "solid fill top left" },
+    { 329, 989, 0xF81F, "solid fill bottom right" },
+    { 330, 950, 0x0000, "right of solid fill" },
+    // Rows 0-7 expand 0xFF00 0xFF00, rows 8-15 0x00FF 0x00FF, bit 15 of
+    // each word first: foreground, then background.
+    { 10, 1000, 0x07FF, "expansion bit 15" },
+    { 17, 1000, 0x07FF, "expansion bit 8" },
+    { 18, 1000, 0x001F, "expansion bit 7" },
+    { 26, 1000, 0x07FF, "expansion second word" },
+    { 10, 1008, 0x001F, "expansion row 8 bit 15" },
+    { 18, 1008, 0x07FF, "expansion row 8 bit 7" },
+    // The transparent one at (20,1010) draws 0xFF00 on its row 0 and keeps
+    // what is under its clear bits.
+    { 27, 1010, 0xFFE0, "transparent expansion set" },
+    { 28, 1010, 0x001F, "transparent expansion clear" },
+};
+
+// Text with the -s glyphs: 8x16 white on blue at (10,650), 12x24 two
+// pixels apart at (10,670), 16x32 yellow transparent at (10,730), 12x24
+// doubled red on black at (10,770).
+static const GoldenProbe goldenTextProbes[] = {
+    { 10, 650, 0xFFFF, "8x16 top row" },
+    { 17, 650, 0xFFFF, "8x16 top row end" },
+    { 10, 651, 0x001F, "8x16 '8' bit 7" },
+    { 12, 651, 0xFFFF, "8x16 '8' bit 5" },
+    { 15, 651, 0x001F, "8x16 '8' bit 2" },
+    { 11, 652, 0x001F, "8x16 column 1" },
+    { 10, 665, 0xFFFF, "8x16 last row" },
+    { 10, 666, 0x0000, "below 8x16" },
+    { 19, 651, 0xFFFF, "8x16 'x' bit 6" },
+    { 21, 670, 0xFFFF, "12x24 top row end" },
+    { 17, 671, 0xFFFF, "12x24 '1' bit 0" },
+    { 16, 671, 0x001F, "12x24 '1' bit 1" },
+    { 24, 670, 0xFFFF, "12x24 spacing" },
+    { 24, 671, 0x001F, "12x24 '2' bit 7" },
+    { 26, 671, 0xFFFF, "12x24 '2' bit 5" },
+    { 10, 730, 0xFFE0, "16x32 top row" },
+    { 25, 730, 0xFFE0, "16x32 top row end" },
+    { 10, 731, 0x0000, "16x32 transparent" },
+    { 12, 731, 0xFFE0, "16x32 '1' bit 5" },
+    { 10, 770, 0xF800, "x2 top row" },
+    { 33, 771, 0xF800, "x2 top row end" },
+    { 12, 772, 0xF800, "x2 'x' bit 6" },
+    { 13, 773, 0xF800, "x2 'x' bit 6 doubled" },
+    { 20, 772, 0x0000, "x2 'x' bit 2" },
+    { 33, 774, 0x0000, "x2 column 11" },
+    { 34, 774, 0xF800, "x2 next glyph" },
+    { 10, 817, 0xF800, "x2 last row" },
+};
+
+#define GOLDEN_COUNT(a) (sizeof(a) / sizeof((a)[0]))
+
+//-----------------------------------------------------------------------------
+static void goldenCanvas(ER_TFTM0784 &tft, uint32_t addr, uint16_t width, uint16_t w, uint16_t h)
+{
+    tft.Canvas_Image_Start_address(addr);
+    tft.Canvas_image_width(width);
+    tft.Active_Window_XY(0, 0);
+    tft.Active_Window_WH(w, h);
+}
+
+static void goldenFill(ER_TFTM0784 &tft, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t c)
+{
+    tft.Foreground_color_65k(c);
+    tft.Square_Start_XY(x1, y1);
+    tft.Square_End_XY(x2, y2);
+    tft.Start_Square_Fill();
+}
+
+static void goldenText(ER_TFTM0784 &tft, uint16_t x, uint16_t y, const char *str)
+{
+    tft.Goto_Text_XY(x, y);
+    tft.Show_String(str);
+}
+
+static void goldenGeometry(ER_TFTM0784 &tft)
+{
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        tft.Foreground_color_65k(goldenPalette[i]);
+        tft.Line_Start_XY(10 + i * 3, 10);
+        tft.Line_End_XY(390 - i * 40, 120 - i * 7);
+        tft.Start_Line();
+    }
+
+    tft.Foreground_color_65k(goldenPalette[0]);
+    tft.Square_Start_XY(10, 130);
+    tft.Square_End_XY(120, 200);
+    tft.Start_Square();
+    tft.Foreground_color_65k(goldenPalette[1]);
+    tft.Square_Start_XY(140, 130);
+    tft.Square_End_XY(250, 200);
+    tft.Start_Square_Fill();
+    tft.Foreground_color_65k(goldenPalette[2]);
+    tft.Square_Start_XY(270, 130);
+    tft.Square_End_XY(390, 200);
+    tft.Circle_Square_Radius_RxRy(20, 12);
+    tft.Start_Circle_Square_Fill();
+    tft.Foreground_color_65k(goldenPalette[6]);
+    tft.Start_Circle_Square();
+
+    tft.Foreground_color_65k(goldenPalette[3]);
+    tft.Circle_Center_XY(70, 270);
+    tft.Circle_Radius_R(55);
+    tft.Start_Circle_or_Ellipse();
+    tft.Foreground_color_65k(goldenPalette[4]);
+    tft.Ellipse_Center_XY(200, 270);
+    tft.Ellipse_Radius_RxRy(60, 35);
+    tft.Start_Circle_or_Ellipse_Fill();
+    tft.Foreground_color_65k(goldenPalette[5]);
+    tft.Ellipse_Center_XY(330, 270);
+    tft.Ellipse_Radius_RxRy(1, 50);
+    tft.Start_Circle_or_Ellipse();
+
+    // The four curves round one centre, filled and outlined.
+    tft.Ellipse_Center_XY(100, 400);
+    tft.Ellipse_Radius_RxRy(60, 40);
+    tft.Foreground_color_65k(goldenPalette[0]);
+    tft.Start_Left_Down_Curve_Fill();
+    tft.Foreground_color_65k(goldenPalette[1]);
+    tft.Start_Left_Up_Curve_Fill();
+    tft.Foreground_color_65k(goldenPalette[2]);
+    tft.Start_Right_Up_Curve_Fill();
+    tft.Foreground_color_65k(goldenPalette[3]);
+    tft.Start_Right_Down_Curve_Fill();
+    tft.Ellipse_Center_XY(300, 400);
+    tft.Foreground_color_65k(goldenPalette[4]);
+    tft.Start_Left_Down_Curve();
+    tft.Start_Left_Up_Curve();
+    tft.Foreground_color_65k(goldenPalette[5]);
+    tft.Start_Right_Up_Curve();
+    tft.Start_Right_Down_Curve();
+
+    tft.Foreground_color_65k(goldenPalette[6]);
+    tft.Triangle_Point1_XY(20, 550);
+    tft.Triangle_Point2_XY(180, 460);
+    tft.Triangle_Point3_XY(120, 590);
+    tft.Start_Triangle_Fill();
+    tft.Foreground_color_65k(goldenPalette[0]);
+    tft.Start_Triangle();
+    tft.Foreground_color_65k(goldenPalette[7]);
+    tft.Triangle_Point1_XY(390, 470);
+    tft.Triangle_Point2_XY(210, 500);
+    tft.Triangle_Point3_XY(300, 590);
+    tft.Start_Triangle_Fill();
+
+    // Clipped to the active window.
+    tft.Active_Window_XY(0, 600);
+    tft.Active_Window_WH(GOLDEN_WIDTH, 40);
+    tft.Foreground_color_65k(goldenPalette[1]);
+    tft.Circle_Center_XY(200, 620);
+    tft.Circle_Radius_R(60);
+    tft.Start_Circle_or_Ellipse_Fill();
+    tft.Active_Window_XY(0, 0);
+    tft.Active_Window_WH(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+}
+
+static void goldenTextScene(ER_TFTM0784 &tft)
+{
+    tft.CGROM_Select_Internal_CGROM();
+    tft.Font_Background_select_Color();
+    tft.Foreground_color_65k(goldenPalette[6]);
+    tft.Background_color_65k(goldenPalette[2]);
+    tft.Font_Select_8x16_16x16();
+    goldenText(tft, 10, 650, "8x16 ABCDEFGHIJKLMNOPQRSTUVWXYZ 0123456789");
+    tft.Font_Select_12x24_24x24();
+    tft.Set_Font_to_Font_Width(2);
+    goldenText(tft, 10, 670, "12x24 abcdefghijklmnopqrstuvwxyz !?#%&*()");
+    tft.Set_Font_to_Font_Width(0);
+    tft.Font_Select_16x32_32x32();
+    tft.Font_Background_select_Transparency();
+    tft.Foreground_color_65k(goldenPalette[3]);
+    goldenText(tft, 10, 730, "16x32 Transparent");
+    tft.Font_Background_select_Color();
+    tft.Font_Select_12x24_24x24();
+    tft.Font_Width_X2();
+    tft.Font_Height_X2();
+    tft.Foreground_color_65k(goldenPalette[0]);
+    tft.Background_color_65k(0x0000);
+    goldenText(tft, 10, 770, "x2 RA8876");
+    tft.Font_Width_X1();
+    tft.Font_Height_X1();
+}
+
+static void goldenBteScene(ER_TFTM0784 &tft)
+{
+    uint16_t pattern[16 * 16], expand[40 * 2], pixels[32];
+
+    // A 16x16 pattern, red background for the chroma key fill.
+    for (uint16_t i = 0; i < 16 * 16; i++)
+        pattern[i] = ((i / 16) ^ (i % 16)) & 4 ? goldenPalette[i % 8] : goldenPalette[0];
+    goldenCanvas(tft, GOLDEN_SCRATCH, 16, 16, 16);
+    tft.Goto_Pixel_XY(0, 0);
+    tft.Show_picture(16 * 16, pattern);
+    goldenCanvas(tft, 0, GOLDEN_WIDTH, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+
+    tft.BTE_S0_Color_16bpp();
+    tft.BTE_S1_Color_16bpp();
+    tft.BTE_Destination_Color_16bpp();
+    tft.BTE_S0_Memory_Start_Address(GOLDEN_SCRATCH);
+    tft.BTE_S0_Image_Width(16);
+    tft.BTE_S0_Window_Start_XY(0, 0);
+    tft.BTE_S1_Memory_Start_Address(0);
+    tft.BTE_S1_Image_Width(GOLDEN_WIDTH);
+    tft.BTE_S1_Window_Start_XY(0, 0);
+    tft.BTE_Destination_Memory_Start_Address(0);
+    tft.BTE_Destination_Image_Width(GOLDEN_WIDTH);
+    tft.Pattern_Format_16X16();
+    tft.BTE_ROP_Code(12);
+    tft.BTE_Operation_Code(6);
+    tft.BTE_Destination_Window_Start_XY(10, 840);
+    tft.BTE_Window_Size(120, 60);
+    tft.BTE_Enable();
+    tft.Check_BTE_Busy();
+    tft.Background_color_65k(goldenPalette[0]);
+    tft.BTE_Operation_Code(7);
+    tft.BTE_Destination_Window_Start_XY(140, 840);
+    tft.BTE_Enable();
+    tft.Check_BTE_Busy();
+
+    // Moves from the geometry scene: plain, then XOR with what is there,
+    // then blended half way.
+    tft.BTE_S0_Memory_Start_Address(0);
+    tft.BTE_S0_Image_Width(GOLDEN_WIDTH);
+    tft.BTE_S0_Window_Start_XY(140, 130);
+    tft.BTE_Window_Size(120, 80);
+    tft.BTE_Operation_Code(2);
+    tft.BTE_Destination_Window_Start_XY(270, 840);
+    tft.BTE_Enable();
+    tft.Check_BTE_Busy();
+    tft.BTE_S0_Window_Start_XY(10, 10);
+    tft.BTE_S1_Window_Start_XY(10, 220);
+    tft.BTE_Destination_Window_Start_XY(10, 910);
+    tft.BTE_ROP_Code(6);
+    tft.BTE_Enable();
+    tft.Check_BTE_Busy();
+    tft.BTE_S1_Window_Start_XY(10, 460);
+    tft.BTE_Destination_Window_Start_XY(140, 910);
+    tft.BTE_Alpha_Blending_Effect(16);
+    tft.BTE_Operation_Code(10);
+    tft.BTE_Enable();
+    tft.Check_BTE_Busy();
+    tft.BTE_S0_Window_Start_XY(0, 0);
+    tft.BTE_S1_Window_Start_XY(0, 0);
+
+    // Solid fill.
+    tft.Foreground_color_65k(goldenPalette[5]);
+    tft.BTE_Operation_Code(12);
+    tft.BTE_Destination_Window_Start_XY(270, 910);
+    tft.BTE_Window_Size(60, 80);
+    tft.BTE_Enable();
+    tft.Check_BTE_Busy();
+
+    // Colour expansion of a 40x40 checker, 16-bit units, then with chroma
+    // key over it, shifted.
+    for (uint16_t y = 0; y < 40; y++)
+    {
+        expand[y * 2] = (y & 8) ? 0x00FF : 0xFF00;
+        expand[y * 2 + 1] = (y & 8) ? 0x00FF : 0xFF00;
+    }
+    tft.Foreground_color_65k(goldenPalette[4]);
+    tft.Background_color_65k(goldenPalette[2]);
+    tft.BTE_Window_Size(32, 40);
+    tft.BTE_Destination_Window_Start_XY(10, 1000);
+    tft.BTE_ROP_Code(15);
+    tft.BTE_Operation_Code(8);
+    tft.BTE_Enable();
+    tft.Show_picture(40 * 2, expand);
+    tft.Check_Mem_WR_FIFO_Empty();
+    tft.Check_BTE_Busy();
+    tft.Foreground_color_65k(goldenPalette[3]);
+    tft.BTE_Destination_Window_Start_XY(20, 1010);
+    tft.BTE_Operation_Code(9);
+    tft.BTE_Enable();
+    tft.Show_picture(40 * 2, expand);
+    tft.Check_Mem_WR_FIFO_Empty();
+    tft.Check_BTE_Busy();
+
+    // MPU write with ROP over S1: a gradient ORed onto the canvas.
+    for (uint8_t i = 0; i < 32; i++)
+        pixels[i] = (uint16_t)(i << 11 | i << 6 | (31 - i));
+    tft.BTE_S1_Window_Start_XY(140, 130);
+    tft.BTE_Destination_Window_Start_XY(140, 1000);
+    tft.BTE_Window_Size(32, 1);
+    tft.BTE_ROP_Code(14);
+    tft.BTE_Operation_Code(0);
+    for (uint8_t y = 0; y < 40; y++)
+    {
+        tft.BTE_S1_Window_Start_XY(140, 130 + y);
+        tft.BTE_Destination_Window_Start_XY(140, 1000 + y);
+        tft.BTE_Enable();
+        tft.Show_picture(32, pixels);
+        tft.Check_Mem_WR_FIFO_Empty();
+        tft.Check_BTE_Busy();
+    }
+}
+
+static void goldenDraw(ER_TFTM0784 &tft, bool text)
+{
+    tft.Select_Main_Window_16bpp();
+    tft.Memory_XY_Mode();
+    tft.Memory_16bpp_Mode();
+    goldenCanvas(tft, 0, GOLDEN_WIDTH, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+    goldenFill(tft, 0, 0, GOLDEN_WIDTH - 1, GOLDEN_HEIGHT - 1, 0x0000);
+    goldenGeometry(tft);
+    if (text)
+        goldenTextScene(tft);
+    goldenBteScene(tft);
+    tft.Check_2D_Busy();
+}
+
+//-----------------------------------------------------------------------------
+static bool goldenOpen(ER_TFTM0784 &tft, const char *dev)
+{
+    tft.RA8876_IO_Init();
+    if (!tft.bus().ok())
+    {
+        perror(dev ? dev : "model");
+        return false;
+    }
+    tft.RA8876_HW_Reset();
+    tft.RA8876_initial();
+    tft.Display_ON();
+    return true;
+}
+
+// Draws on the display at 'dev', or into 'sim' without one; the canvas ends
+// up in sim's SDRAM either way.
+static bool goldenRender(RA8876_Model &sim, bool text, const char *dev, const char *chip, unsigned line)
+{
+    ER_TFTM0784 tft(dev, 20000000, chip, line);
+
+    if (!dev)
+        sim.attach(tft.bus().spi());
+    if (!goldenOpen(tft, dev))
+        return false;
+    goldenDraw(tft, text);
+    if (dev)
+    {
+        uint16_t *pixels = (uint16_t *)(sim.sdram());
+        goldenCanvas(tft, 0, GOLDEN_WIDTH, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+        tft.Read_Region(0, 0, GOLDEN_WIDTH, GOLDEN_HEIGHT, pixels);
+    }
+    return tft.bus().ok();
+}
+
+// 8x16, 12x24 and 16x32 glyphs of every code, drawn white on black and
+// read back, in the RA8876_MODEL_CGROM_SIZE layout.
+static bool goldenCgrom(const char *dev, const char *chip, unsigned line)
+{
+    ER_TFTM0784 tft(dev, 20000000, chip, line);
+    uint16_t pixels[16 * 32];
+    char str[2] = { 0, 0 };
+
+    if (!goldenOpen(tft, dev))
+        return false;
+    tft.Select_Main_Window_16bpp();
+    tft.Memory_XY_Mode();
+    tft.Memory_16bpp_Mode();
+    goldenCanvas(tft, GOLDEN_SCRATCH, 16, 16, 32);
+    tft.CGROM_Select_Internal_CGROM();
+    tft.Font_Background_select_Color();
+    tft.Font_Width_X1();
+    tft.Font_Height_X1();
+    tft.Foreground_color_65k(0xFFFF);
+    tft.Background_color_65k(0x0000);
+    for (uint8_t size = 0; size < 3; size++)
+    {
+        uint8_t h = 16 + 8 * size, w = h / 2;
+        if (size == 0)
+            tft.Font_Select_8x16_16x16();
+        else if (size == 1)
+            tft.Font_Select_12x24_24x24();
+        else
+            tft.Font_Select_16x32_32x32();
+        for (uint16_t code = 0; code < 256; code++)
+        {
+            // Code 0 ends a string: write it to the port by hand.
+            if (code)
+            {
+                str[0] = (char)code;
+                goldenText(tft, 0, 0, str);
+            }
+            else
+            {
+                tft.Goto_Text_XY(0, 0);
+                tft.Text_Mode();
+                tft.LCD_CmdWrite(0x04);
+                tft.LCD_DataWrite(0);
+                tft.Check_2D_Busy();
+                tft.Graphic_Mode();
+            }
+            tft.Read_Region(0, 0, w, h, pixels);
+            for (uint8_t y = 0; y < h; y++)
+                for (uint8_t x = 0; x < w; x += 8)
+                {
+                    uint8_t bits = 0;
+                    for (uint8_t i = 0; i < 8 && x + i < w; i++)
+                        if (pixels[y * w + x + i] & 0x8000)
+                            bits |= 0x80 >> i;
+                    putchar(bits);
+                }
+        }
+    }
+    return tft.bus().ok();
+}
+
+// Made-up glyphs for -s in the RA8876_MODEL_CGROM_SIZE layout: top row
+// and left column set, the code in the second row.
+static uint8_t *goldenSyntheticCgrom()
+{
+    uint8_t *data = (uint8_t *)malloc(RA8876_MODEL_CGROM_SIZE), *p = data;
+
+    if (!data)
+        return NULL;
+    for (uint8_t size = 0; size < 3; size++)
+    {
+        uint8_t h = 16 + 8 * size, w = h / 2, row = (w + 7) / 8;
+        for (uint16_t code = 0; code < 256; code++)
+            for (uint8_t y = 0; y < h; y++)
+                for (uint8_t x = 0; x < row * 8; x += 8, p++)
+                {
+                    if (y == 0)
+                        *p = w - x >= 8 ? 0xFF : (uint8_t)(0xFF00 >> (w - x));
+                    else if (y == 1)
+                        *p = x ? 0 : (uint8_t)code;
+                    else
+                        *p = x ? 0 : 0x80;
+                }
+    }
+    return data;
+}
+
+static uint8_t *goldenReadFile(const char *path, size_t size)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *data = (uint8_t *)malloc(size);
+
+    if (!f || !data || fread(data, 1, size, f) != size)
+    {
+        if (f)
+            fclose(f);
+        free(data);
+        perror(path);
+        return NULL;
+    }
+    fclose(f);
+    return data;
+}
+
+static int goldenCheck(RA8876_Model &sim, const char *path)
+{
+    GoldenBuffer ppm(64 + GOLDEN_WIDTH * GOLDEN_HEIGHT * 3UL);
+    FILE *f = fopen(path, "rb");
+    unsigned w, h, max;
+
+    sim.writePpm(ppm, 0, GOLDEN_WIDTH, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+    if (!f || fscanf(f, "P6 %u %u %u", &w, &h, &max) != 3 || fgetc(f) == EOF)
+    {
+        fprintf(stderr, "%s: not a PPM\n", path);
+        if (f)
+            fclose(f);
+        return 2;
+    }
+    if (w != GOLDEN_WIDTH || h != GOLDEN_HEIGHT || max != 255)
+    {
+        fprintf(stderr, "%s: %ux%u, want %ux%u\n", path, w, h, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+        fclose(f);
+        return 2;
+    }
+
+    const uint8_t *mine = ppm.data + ppm.used - GOLDEN_WIDTH * GOLDEN_HEIGHT * 3UL;
+    unsigned long diff = 0;
+    unsigned x1 = w, y1 = h, x2 = 0, y2 = 0;
+    for (unsigned y = 0; y < h; y++)
+        for (unsigned x = 0; x < w; x++)
+        {
+            uint8_t rgb[3];
+            if (fread(rgb, 1, 3, f) != 3)
+            {
+                fprintf(stderr, "%s: short\n", path);
+                fclose(f);
+                return 2;
+            }
+            if (memcmp(rgb, mine + (y * w + x) * 3, 3) == 0)
+                continue;
+            diff++;
+            if (x < x1) x1 = x;
+            if (y < y1) y1 = y;
+            if (x > x2) x2 = x;
+            if (y > y2) y2 = y;
+        }
+    fclose(f);
+    if (diff)
+        printf("%lu pixels differ in (%u,%u)-(%u,%u)\n", diff, x1, y1, x2, y2);
+    else
+        printf("match\n");
+    return diff ? 1 : 0;
+}
+
+static unsigned goldenProbe(RA8876_Model &sim, const GoldenProbe *probe, size_t n)
+{
+    const uint16_t *pixels = (const uint16_t *)sim.sdram();
+    unsigned bad = 0;
+
+    for (size_t i = 0; i < n; i++)
+    {
+        uint16_t got = pixels[probe[i].y * GOLDEN_WIDTH + probe[i].x];
+        if (got == probe[i].colour)
+            continue;
+        printf("(%u,%u) %s: %04X, want %04X\n", probe[i].x, probe[i].y,
+               probe[i].what, got, probe[i].colour);
+        bad++;
+    }
+    return bad;
+}
+
+static int usage()
+{
+    fprintf(stderr,
+            "usage: ra8876_golden [-f CGROM | -s | -n] render OUT.ppm\n"
+            "       ra8876_golden [-n] render OUT.ppm SPIDEV [GPIOCHIP LINE]\n"
+            "       ra8876_golden [-f CGROM | -s | -n] check GOLDEN.ppm\n"
+            "       ra8876_golden cgrom SPIDEV [GPIOCHIP LINE] > CGROM\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    RA8876_Model sim;
+    uint8_t *cgrom = NULL;
+    bool text = true, synthetic = false;
+    int arg = 1;
+
+    if (arg + 1 < argc && strcmp(argv[arg], "-f") == 0)
+    {
+        cgrom = goldenReadFile(argv[arg + 1], RA8876_MODEL_CGROM_SIZE);
+        if (!cgrom)
+            return 2;
+        sim.setCgrom(cgrom);
+        arg += 2;
+    }
+    else if (arg < argc && strcmp(argv[arg], "-s") == 0)
+    {
+        cgrom = goldenSyntheticCgrom();
+        if (!cgrom)
+            return 2;
+        sim.setCgrom(cgrom);
+        synthetic = true;
+        arg++;
+    }
+    else if (arg < argc && strcmp(argv[arg], "-n") == 0)
+    {
+        text = false;
+        arg++;
+    }
+    if (arg + 1 >= argc)
+        return usage();
+
+    const char *cmd = argv[arg], *file = argv[arg + 1];
+    int extra = argc - arg - 2;
+    const char *chip = extra == 3 ? argv[arg + 3] : NULL;
+    unsigned line = chip ? strtoul(argv[arg + 4], NULL, 0) : 0;
+    int rc;
+
+    if (strcmp(cmd, "cgrom") == 0 && (extra == 0 || extra == 2))
+    {
+        chip = extra == 2 ? argv[arg + 2] : NULL;
+        line = chip ? strtoul(argv[arg + 3], NULL, 0) : 0;
+        rc = goldenCgrom(file, chip, line) ? 0 : 1;
+    }
+    else if (strcmp(cmd, "render") == 0 && (extra == 0 || extra == 1 || extra == 3))
+    {
+        const char *dev = extra ? argv[arg + 2] : NULL;
+        FILE *f;
+        if (!goldenRender(sim, text, dev, chip, line))
+            rc = 1;
+        else if (!(f = fopen(file, "wb")))
+        {
+            perror(file);
+            rc = 1;
+        }
+        else
+        {
+            RA8876_FilePrint out(f);
+            sim.writePpm(out, 0, GOLDEN_WIDTH, GOLDEN_WIDTH, GOLDEN_HEIGHT);
+            rc = fclose(f) == 0 ? 0 : 1;
+        }
+    }
+    else if (strcmp(cmd, "check") == 0 && extra == 0)
+    {
+        rc = goldenRender(sim, text, NULL, NULL, 0) ? goldenCheck(sim, file) : 1;
+        if (rc < 2)
+        {
+            unsigned bad = goldenProbe(sim, goldenProbes, GOLDEN_COUNT(goldenProbes));
+            if (synthetic)
+                bad += goldenProbe(sim, goldenTextProbes, GOLDEN_COUNT(goldenTextProbes));
+            if (bad)
+                rc = 1;
+            else
+                printf("probes ok\n");
+        }
+    }
+    else
+        rc = usage();
+    free(cgrom);
+    return rc;
+}
@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// ra8876_queue - drive RA8876_Queue from several threads into RA8876_Model
+// and check that nothing is lost or reordered
+//
+//   ra8876_queue [-p PRODUCERS] [-n COMMANDS]
+//
+// Each producer thread owns a square of the canvas and fills it again and
+// again, the colour counting up, with a call() after every second fill that
+// checks, on the display task, that the square shows the last fill the
+// producer had accepted. A small queue keeps it full, so there are drops
+// (a producer yields after one), and back-to-back fills of one square are
+// merged. At the end every square must show its producer's last accepted
+// fill, and the counters must add up: every command offered is run, merged
+// or dropped. Exits 1 otherwise.
+//
+// Build on Linux from this directory:
+//   g++ -O2 -pthread -I../../src ra8876_queue.cpp ../../src/*.cpp -o ra8876_queue
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ER-TFTM0784-1.h"
+#include "RA8876_Model.h"
+#include "RA8876_Queue.h"
+
+#include <stdlib.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define QUEUE_DEPTH         16
+#define QUEUE_WIDTH         400     // canvas width
+#define QUEUE_SQUARE        8       // producer squares, a pixel apart
+#define QUEUE_PRODUCERS_MAX 40
+
+typedef RA8876_Queue<ER_TFTM0784, QUEUE_DEPTH> Queue;
+
+static RA8876_Model sim;
+static uint32_t queueBad;           // display task only
+
+struct Producer {
+    unsigned index;
+    uint16_t last;                  // colour of the last accepted fill
+    uint32_t offered;               // commands pushed or dropped
+};
+
+static uint16_t queuePixel(unsigned index)
+{
+    const uint16_t *pixels = (const uint16_t *)sim.sdram();
+    return pixels[index * (QUEUE_SQUARE + 1)];
+}
+
+// Runs on the display task: ctx holds the producer and the colour it
+// expects.
+static void queueCheck(ER_TFTM0784 &, void *ctx)
+{
+    uintptr_t v = (uintptr_t)ctx;
+    unsigned index = v >> 16;
+    uint16_t want = v & 0xFFFF;
+    uint16_t got = queuePixel(index);
+
+    if (got != want)
+    {
+        if (queueBad++ < 10)
+            printf("producer %u: square shows %u, last fill %u\n", index, got, want);
+    }
+}
+
+static void queueProduce(Queue &queue, Producer &p, uint32_t commands)
+{
+    uint16_t x = p.index * (QUEUE_SQUARE + 1);
+    uint16_t colour = 0;
+
+    while (p.offered < commands)
+    {
+        for (int i = 0; i < 2; i++)
+        {
+            colour++;
+            if (queue.fill(x, 0, x + QUEUE_SQUARE - 1, QUEUE_SQUARE - 1, colour))
+                p.last = colour;
+            else
+                std::this_thread::yield();
+            p.offered++;
+        }
+        if (!queue.call(queueCheck, (void *)((uintptr_t)p.index << 16 | p.last)))
+            std::this_thread::yield();
+        p.offered++;
+    }
+}
+
+static int usage()
+{
+    fprintf(stderr, "usage: ra8876_queue [-p PRODUCERS] [-n COMMANDS]\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned producers = 4;
+    uint32_t commands = 3000;           // per producer; at most 90000, so the
+                                        // colours do not wrap
+
+    for (int arg = 1; arg < argc; arg += 2)
+    {
+        if (arg + 1 >= argc)
+            return usage();
+        if (strcmp(argv[arg], "-p") == 0)
+            producers = strtoul(argv[arg + 1], NULL, 0);
+        else if (strcmp(argv[arg], "-n") == 0)
+            commands = strtoul(argv[arg + 1], NULL, 0);
+        else
+            return usage();
+    }
+    if (producers == 0 || producers > QUEUE_PRODUCERS_MAX || commands > 90000)
+        return usage();
+
+    ER_TFTM0784 tft((const char *)NULL, 20000000, (const char *)NULL, 0);
+    sim.attach(tft.bus().spi());
+    tft.RA8876_IO_Init();
+    tft.RA8876_HW_Reset();
+    tft.RA8876_initial();
+    tft.Canvas_Image_Start_address(0);
+    tft.Canvas_image_width(QUEUE_WIDTH);
+    tft.Active_Window_XY(0, 0);
+    tft.Active_Window_WH(QUEUE_WIDTH, QUEUE_SQUARE);
+    tft.Foreground_color_65k(0);
+    tft.Square_Start_XY(0, 0);
+    tft.Square_End_XY(QUEUE_WIDTH - 1, QUEUE_SQUARE - 1);
+    tft.Start_Square_Fill();
+    tft.Check_2D_Busy();
+
+    Queue queue(tft);
+    std::vector<Producer> p(producers);
+    std::vector<std::thread> threads;
+    std::atomic<unsigned> running(producers);
+
+    for (unsigned i = 0; i < producers; i++)
+    {
+        p[i].index = i;
+        p[i].last = 0;
+        p[i].offered = 0;
+        threads.push_back(std::thread([&queue, &p, &running, i, commands] {
+            queueProduce(queue, p[i], commands);
+            running--;
+        }));
+    }
+    while (running)
+        queue.drain();
+    for (unsigned i = 0; i < producers; i++)
+        threads[i].join();
+    queue.drain();
+
+    RA8876_QueueStats s = queue.stats();
+    uint32_t offered = 0;
+
+    for (unsigned i = 0; i < producers; i++)
+    {
+        uint16_t got = queuePixel(i);
+        offered += p[i].offered;
+        if (got != p[i].last)
+        {
+            printf("producer %u: square ends at %u, last fill %u\n", i, got, p[i].last);
+            queueBad++;
+        }
+    }
+    printf("%u producers: offered %u, pushed %u, dropped %u, run %u, merged %u, max depth %u\n",
+           producers, offered, s.pushed, s.dropped, s.executed, s.merged, s.max_depth);
+    if (s.pushed + s.dropped != offered || s.executed + s.merged + s.dropped != offered)
+    {
+        printf("counters do not add up\n");
+        queueBad++;
+    }
+    if (queueBad)
+    {
+        printf("%u errors\n", queueBad);
+        return 1;
+    }
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 register names for the host tools, from the datasheet register
+// table. ra8876_reg() returns NULL for reserved addresses.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_REGS_H__
+#define __RA8876_REGS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+struct RA8876_RegName {
+    uint8_t reg;
+    const char *name;
+    const char *desc;
+};
+
+static const RA8876_RegName ra8876_regs[] =
+{
+    {0x00, "SRR",       "Software Reset"},
+    {0x01, "CCR",       "Chip Configuration"},
+    {0x02, "MACR",      "Memory Access Control"},
+    {0x03, "ICR",       "Input Control"},
+    {0x04, "MRWDP",     "Memory Data Read/Write Port"},
+    {0x05, "PPLLC1",    "SCLK PLL Control 1"},
+    {0x06, "PPLLC2",    "SCLK PLL Control 2"},
+    {0x07, "MPLLC1",    "MCLK PLL Control 1"},
+    {0x08, "MPLLC2",    "MCLK PLL Control 2"},
+    {0x09, "SPLLC1",    "CCLK PLL Control 1"},
+    {0x0A, "SPLLC2",    "CCLK PLL Control 2"},
+    {0x0B, "INTEN",     "Interrupt Enable"},
+    {0x0C, "INTF",      "Interrupt Event Flag"},
+    {0x0D, "MINTFR",    "Mask Interrupt Flag"},
+    {0x0E, "PUENR",     "Pull-high Control"},
+    {0x0F, "PSFSR",     "PDAT for PIO/Key Function Select"},
+    {0x10, "MPWCTR",    "Main/PIP Window Control"},
+    {0x11, "PIPCDEP",   "PIP Window Color Depth"},
+    {0x12, "DPCR",      "Display Configuration"},
+    {0x13, "PCSR",      "Panel Scan Clock and Data Setting"},
+    {0x14, "HDWR",      "Horizontal Display Width"},
+    {0x15, "HDWFTR",    "Horizontal Display Width Fine Tune"},
+    {0x16, "HNDR",      "Horizontal Non-Display Period"},
+    {0x17, "HNDFTR",    "Horizontal Non-Display Period Fine Tune"},
+    {0x18, "HSTR",      "HSYNC Start Position"},
+    {0x19, "HPWR",      "HSYNC Pulse Width"},
+    {0x1A, "VDHR0",     "Vertical Display Height [7:0]"},
+    {0x1B, "VDHR1",     "Vertical Display Height [10:8]"},
+    {0x1C, "VNDR0",     "Vertical Non-Display Period [7:0]"},
+    {0x1D, "VNDR1",     "Vertical Non-Display Period [9:8]"},
+    {0x1E, "VSTR",      "VSYNC Start Position"},
+    {0x1F, "VPWR",      "VSYNC Pulse Width"},
+    {0x20, "MISA0",     "Main Image Start Address [7:2]"},
+    {0x21, "MISA1",     "Main Image Start Address [15:8]"},
+    {0x22, "MISA2",     "Main Image Start Address [23:16]"},
+    {0x23, "MISA3",     "Main Image Start Address [31:24]"},
+    {0x24, "MIW0",      "Main Image Width [7:0]"},
+    {0x25, "MIW1",      "Main Image Width [12:8]"},
+    {0x26, "MWULX0",    "Main Window Upper-Left X [7:0]"},
+    {0x27, "MWULX1",    "Main Window Upper-Left X [12:8]"},
+    {0x28, "MWULY0",    "Main Window Upper-Left Y [7:0]"},
+    {0x29, "MWULY1",    "Main Window Upper-Left Y [12:8]"},
+    {0x2A, "PWDULX0",   "PIP Window Display Upper-Left X [7:0]"},
+    {0x2B, "PWDULX1",   "PIP Window Display Upper-Left X [12:8]"},
+    {0x2C, "PWDULY0",   "PIP Window Display Upper-Left Y [7:0]"},
+    {0x2D, "PWDULY1",   "PIP Window Display Upper-Left Y [12:8]"},
+    {0x2E, "PISA0",     "PIP Image Start Address [7:2]"},
+    {0x2F, "PISA1",     "PIP Image Start Address [15:8]"},
+    {0x30, "PISA2",     "PIP Image Start Address [23:16]"},
+    {0x31, "PISA3",     "PIP Image Start Address [31:24]"},
+    {0x32, "PIW0",      "PIP Image Width [7:0]"},
+    {0x33, "PIW1",      "PIP Image Width [12:8]"},
+    {0x34, "PWIULX0",   "PIP Window Image Upper-Left X [7:0]"},
+    {0x35, "PWIULX1",   "PIP Window Image Upper-Left X [12:8]"},
+    {0x36, "PWIULY0",   "PIP Window Image Upper-Left Y [7:0]"},
+    {0x37, "PWIULY1",   "PIP Window Image Upper-Left Y [12:8]"},
+    {0x38, "PWW0",      "PIP Window Width [7:0]"},
+    {0x39, "PWW1",      "PIP Window Width [10:8]"},
+    {0x3A, "PWH0",      "PIP Window Height [7:0]"},
+    {0x3B, "PWH1",      "PIP Window Height [10:8]"},
+    {0x3C, "GTCCR",     "Graphic/Text Cursor Control"},
+    {0x3D, "BTCR",      "Blink Time Control"},
+    {0x3E, "CURHS",     "Text Cursor Horizontal Size"},
+    {0x3F, "CURVS",     "Text Cursor Vertical Size"},
+    {0x40, "GCHP0",     "Graphic Cursor Horizontal Position [7:0]"},
+    {0x41, "GCHP1",     "Graphic Cursor Horizontal Position [12:8]"},
+    {0x42, "GCVP0",     "Graphic Cursor Vertical Position [7:0]"},
+    {0x43, "GCVP1",     "Graphic Cursor Vertical Position [12:8]"},
+    {0x44, "GCC0",      "Graphic Cursor Color 0"},
+    {0x45, "GCC1",      "Graphic Cursor Color 1"},
+    {0x50, "CVSSA0",    "Canvas Start Address [7:2]"},
+    {0x51, "CVSSA1",    "Canvas Start Address [15:8]"},
+    {0x52, "CVSSA2",    "Canvas Start Address [23:16]"},
+    {0x53, "CVSSA3",    "Canvas Start Address [31:24]"},
+    {0x54, "CVS_IMWTH0", "Canvas Image Width [7:2]"},
+    {0x55, "CVS_IMWTH1", "Canvas Image Width [12:8]"},
+    {0x56, "AWUL_X0",   "Active Window Upper-Left X [7:0]"},
+    {0x57, "AWUL_X1",   "Active Window Upper-Left X [12:8]"},
+    {0x58, "AWUL_Y0",   "Active Window Upper-Left Y [7:0]"},
+    {0x59, "AWUL_Y1",   "Active Window Upper-Left Y [12:8]"},
+    {0x5A, "AW_WTH0",   "Active Window Width [7:0]"},
+    {0x5B, "AW_WTH1",   "Active Window Width [12:8]"},
+    {0x5C, "AW_HT0",    "Active Window Height [7:0]"},
+    {0x5D, "AW_HT1",    "Active Window Height [12:8]"},
+    {0x5E, "AW_COLOR",  "Canvas/Active Window Color Depth"},
+    {0x5F, "CURH0",     "Graphic Read/Write X [7:0]"},
+    {0x60, "CURH1",     "Graphic Read/Write X [12:8]"},
+    {0x61, "CURV0",     "Graphic Read/Write Y [7:0]"},
+    {0x62, "CURV1",     "Graphic Read/Write Y [12:8]"},
+    {0x63, "F_CURX0",   "Text Write X [7:0]"},
+    {0x64, "F_CURX1",   "Text Write X [12:8]"},
+    {0x65, "F_CURY0",   "Text Write Y [7:0]"},
+    {0x66, "F_CURY1",   "Text Write Y [12:8]"},
+    {0x67, "DCR0",      "Draw Line/Triangle Control"},
+    {0x68, "DLHSR0",    "Line start X [7:0]"},
+    {0x69, "DLHSR1",    "Line start X [12:8]"},
+    {0x6A, "DLVSR0",    "Line start Y [7:0]"},
+    {0x6B, "DLVSR1",    "Line start Y [12:8]"},
+    {0x6C, "DLHER0",    "Line end X [7:0]"},
+    {0x6D, "DLHER1",    "Line end X [12:8]"},
+    {0x6E, "DLVER0",    "Line end Y [7:0]"},
+    {0x6F, "DLVER1",    "Line end Y [12:8]"},
+    {0x70, "DTPH0",     "Triangle point 3 X [7:0]"},
+    {0x71, "DTPH1",     "Triangle point 3 X [12:8]"},
+    {0x72, "DTPV0",     "Triangle point 3 Y [7:0]"},
+    {0x73, "DTPV1",     "Triangle point 3 Y [12:8]"},
+    {0x76, "DCR1",      "Draw Circle/Ellipse/Rectangle Control"},
+    {0x77, "ELL_A0",    "Major radius [7:0]"},
+    {0x78, "ELL_A1",    "Major radius [12:8]"},
+    {0x79, "ELL_B0",    "Minor radius [7:0]"},
+    {0x7A, "ELL_B1",    "Minor radius [12:8]"},
+    {0x7B, "DEHR0",     "Circle/Ellipse center X [7:0]"},
+    {0x7C, "DEHR1",     "Circle/Ellipse center X [12:8]"},
+    {0x7D, "DEVR0",     "Circle/Ellipse center Y [7:0]"},
+    {0x7E, "DEVR1",     "Circle/Ellipse center Y [12:8]"},
+    {0x84, "PSCLR",     "PWM Prescaler"},
+    {0x85, "PMUXR",     "PWM Clock Mux"},
+    {0x86, "PCFGR",     "PWM Configuration"},
+    {0x87, "DZ_LENGTH", "Timer 0 Dead Zone Length"},
+    {0x88, "TCMPB0L",   "Timer 0 Compare Buffer [7:0]"},
+    {0x89, "TCMPB0H",   "Timer 0 Compare Buffer [15:8]"},
+    {0x8A, "TCNTB0L",   "Timer 0 Count Buffer [7:0]"},
+    {0x8B, "TCNTB0H",   "Timer 0 Count Buffer [15:8]"},
+    {0x8C, "TCMPB1L",   "Timer 1 Compare Buffer [7:0]"},
+    {0x8D, "TCMPB1H",   "Timer 1 Compare Buffer [15:8]"},
+    {0x8E, "TCNTB1L",   "Timer 1 Count Buffer [7:0]"},
+    {0x8F, "TCNTB1H",   "Timer 1 Count Buffer [15:8]"},
+    {0x90, "BTE_CTRL0", "BTE Function Control 0"},
+    {0x91, "BTE_CTRL1", "BTE Function Control 1"},
+    {0x92, "BTE_COLR",  "BTE Source/Destination Color Depth"},
+    {0x93, "S0_STR0",   "Source 0 Start Address [7:2]"},
+    {0x94, "S0_STR1",   "Source 0 Start Address [15:8]"},
+    {0x95, "S0_STR2",   "Source 0 Start Address [23:16]"},
+    {0x96, "S0_STR3",   "Source 0 Start Address [31:24]"},
+    {0x97, "S0_WTH0",   "Source 0 Image Width [7:0]"},
+    {0x98, "S0_WTH1",   "Source 0 Image Width [12:8]"},
+    {0x99, "S0_X0",     "Source 0 X [7:0]"},
+    {0x9A, "S0_X1",     "Source 0 X [12:8]"},
+    {0x9B, "S0_Y0",     "Source 0 Y [7:0]"},
+    {0x9C, "S0_Y1",     "Source 0 Y [12:8]"},
+    {0x9D, "S1_STR0",   "Source 1 Start Address [7:2]"},
+    {0x9E, "S1_STR1",   "Source 1 Start Address [15:8]"},
+    {0x9F, "S1_STR2",   "Source 1 Start Address [23:16]"},
+    {0xA0, "S1_STR3",   "Source 1 Start Address [31:24]"},
+    {0xA1, "S1_WTH0",   "Source 1 Image Width [7:0]"},
+    {0xA2, "S1_WTH1",   "Source 1 Image Width [12:8]"},
+    {0xA3, "S1_X0",     "Source 1 X [7:0]"},
+    {0xA4, "S1_X1",     "Source 1 X [12:8]"},
+    {0xA5, "S1_Y0",     "Source 1 Y [7:0]"},
+    {0xA6, "S1_Y1",     "Source 1 Y [12:8]"},
+    {0xA7, "DT_STR0",   "Destination Start Address [7:2]"},
+    {0xA8, "DT_STR1",   "Destination Start Address [15:8]"},
+    {0xA9, "DT_STR2",   "Destination Start Address [23:16]"},
+    {0xAA, "DT_STR3",   "Destination Start Address [31:24]"},
+    {0xAB, "DT_WTH0",   "Destination Image Width [7:0]"},
+    {0xAC, "DT_WTH1",   "Destination Image Width [12:8]"},
+    {0xAD, "DT_X0",     "Destination X [7:0]"},
+    {0xAE, "DT_X1",     "Destination X [12:8]"},
+    {0xAF, "DT_Y0",     "Destination Y [7:0]"},
+    {0xB0, "DT_Y1",     "Destination Y [12:8]"},
+    {0xB1, "BTE_WTH0",  "BTE Window Width [7:0]"},
+    {0xB2, "BTE_WTH1",  "BTE Window Width [12:8]"},
+    {0xB3, "BTE_HIG0",  "BTE Window Height [7:0]"},
+    {0xB4, "BTE_HIG1",  "BTE Window Height [12:8]"},
+    {0xB5, "APB_CTRL",  "Alpha Blending"},
+    {0xB6, "DMA_CTRL",  "Serial Flash DMA Control"},
+    {0xB7, "SFL_CTRL",  "Serial Flash/ROM Control"},
+    {0xB8, "SPIDR",     "SPI Master Tx/Rx FIFO Data"},
+    {0xB9, "SPIMCR2",   "SPI Master Control"},
+    {0xBA, "SPIMSR",    "SPI Master Status"},
+    {0xBB, "SPI_DIVSOR", "SPI Master Clock Period"},
+    {0xBC, "DMA_SSTR0", "Serial Flash DMA Source Address [7:0]"},
+    {0xBD, "DMA_SSTR1", "Serial Flash DMA Source Address [15:8]"},
+    {0xBE, "DMA_SSTR2", "Serial Flash DMA Source Address [23:16]"},
+    {0xBF, "DMA_SSTR3", "Serial Flash DMA Source Address [31:24]"},
+    {0xC0, "DMA_DX0",   "DMA Destination X [7:0]"},
+    {0xC1, "DMA_DX1",   "DMA Destination X [12:8]"},
+    {0xC2, "DMA_DY0",   "DMA Destination Y [7:0]"},
+    {0xC3, "DMA_DY1",   "DMA Destination Y [12:8]"},
+    {0xC6, "DMAW_WTH0", "DMA Block Width [7:0]"},
+    {0xC7, "DMAW_WTH1", "DMA Block Width [12:8]"},
+    {0xC8, "DMAW_HIGH0", "DMA Block Height [7:0]"},
+    {0xC9, "DMAW_HIGH1", "DMA Block Height [12:8]"},
+    {0xCA, "DMA_SWTH0", "DMA Source Picture Width [7:0]"},
+    {0xCB, "DMA_SWTH1", "DMA Source Picture Width [12:8]"},
+    {0xCC, "CCR0",      "Character Control 0"},
+    {0xCD, "CCR1",      "Character Control 1"},
+    {0xCE, "GTFNT_SEL", "GT Character ROM Select"},
+    {0xCF, "GTFNT_CR",  "GT Character ROM Control"},
+    {0xD0, "FLDR",      "Character Line Gap"},
+    {0xD1, "F2FSSR",    "Character to Character Space"},
+    {0xD2, "FGCR",      "Foreground Color Red"},
+    {0xD3, "FGCG",      "Foreground Color Green"},
+    {0xD4, "FGCB",      "Foreground Color Blue"},
+    {0xD5, "BGCR",      "Background Color Red"},
+    {0xD6, "BGCG",      "Background Color Green"},
+    {0xD7, "BGCB",      "Background Color Blue"},
+    {0xDB, "CGRAM_STR0", "CGRAM Start Address [7:0]"},
+    {0xDC, "CGRAM_STR1", "CGRAM Start Address [15:8]"},
+    {0xDD, "CGRAM_STR2", "CGRAM Start Address [23:16]"},
+    {0xDE, "CGRAM_STR3", "CGRAM Start Address [31:24]"},
+    {0xDF, "PMU",       "Power Management"},
+    {0xE0, "SDRAR",     "SDRAM Attribute"},
+    {0xE1, "SDRMD",     "SDRAM Mode/Extended Mode"},
+    {0xE2, "SDR_REF_ITVL0", "SDRAM Auto Refresh Interval [7:0]"},
+    {0xE3, "SDR_REF_ITVL1", "SDRAM Auto Refresh Interval [15:8]"},
+    {0xE4, "SDRCR",     "SDRAM Control"},
+    {0xE5, "I2CMCPR0",  "I2C Master Clock Prescaler [7:0]"},
+    {0xE6, "I2CMCPR1",  "I2C Master Clock Prescaler [15:8]"},
+    {0xE7, "I2CMTXR",   "I2C Master Transmit"},
+    {0xE8, "I2CMRXR",   "I2C Master Receive"},
+    {0xE9, "I2CMCMDR",  "I2C Master Command"},
+    {0xEA, "I2CMSTUR",  "I2C Master Status"},
+    {0xF0, "GPIOAD",    "GPIO-A Direction"},
+    {0xF1, "GPIOA",     "GPIO-A"},
+    {0xF2, "GPIOB",     "GPIO-B"},
+    {0xF3, "GPIOCD",    "GPIO-C Direction"},
+    {0xF4, "GPIOC",     "GPIO-C"},
+    {0xF5, "GPIODD",    "GPIO-D Direction"},
+    {0xF6, "GPIOD",     "GPIO-D"},
+    {0xF7, "GPIOED",    "GPIO-E Direction"},
+    {0xF8, "GPIOE",     "GPIO-E"},
+    {0xF9, "GPIOFD",    "GPIO-F Direction"},
+    {0xFA, "GPIOF",     "GPIO-F"},
+    {0xFB, "KSCR1",     "Key-Scan Control 1"},
+    {0xFC, "KSCR2",     "Key-Scan Control 2"},
+    {0xFD, "KSDR0",     "Key-Scan Data 0"},
+    {0xFE, "KSDR1",     "Key-Scan Data 1"},
+    {0xFF, "KSDR2",     "Key-Scan Data 2"},
+};
+
+static inline const RA8876_RegName *ra8876_reg(uint8_t reg)
+{
+    for (size_t i = 0; i < sizeof(ra8876_regs) / sizeof(ra8876_regs[0]); i++)
+        if (ra8876_regs[i].reg == reg)
+            return &ra8876_regs[i];
+    return NULL;
+}
+
+#endif
@@ -0,0 +1,457 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// ra8876_trace - decode, summarise and replay RA8876 bus traces
+//
+// Reads the files written by RA8876_Trace (dump() or setFile(), see
+// src/RA8876_Trace.h).
+//
+//   ra8876_trace decode  FILE
+//       One line per bus cycle with register names from the datasheet.
+//   ra8876_trace summary FILE
+//       Cycle counts, bytes on the wire, registers written over and over with
+//       the value they already hold, and status/register polling loops.
+//   ra8876_trace replay  FILE SPIDEV HZ [GPIOCHIP LINE]
+//       Plays the trace against a display on a Linux spidev. A polling loop
+//       is replayed as "poll until the value the trace ended with", so it
+//       takes as long as the device needs. Burst payloads are not recorded
+//       and are sent as zero bytes; read bursts are read and dropped.
+//   ra8876_trace replay  FILE -m [HZ]
+//       The same without hardware: RA8876_Model answers instead (at HZ for
+//       its bus time, 20 MHz by default) and its counts are printed after.
+//
+// Build on Linux from this directory:
+//   g++ -O2 -I../../src ra8876_trace.cpp ../../src/*.cpp -o ra8876_trace
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ER-TFTM0784-1.h"
+#include "RA8876_Model.h"
+#include "RA8876_Trace.h"
+#include "ra8876_regs.h"
+
+#include <stdlib.h>
+#include <vector>
+
+#define POLL_MIN        2           // repeats before reads count as a polling loop
+#define POLL_TIMEOUT_MS 1000        // replay gives up on a polling loop after this
+
+typedef std::vector<RA8876_TraceRec> Trace;
+
+static const char *const typeNames[] =
+{
+    "CMD", "DATA", "DATA16", "READ", "STATUS", "BURST", "RESET", "TIME", "RDBURST"
+};
+
+//-----------------------------------------------------------------------------
+static bool load(const char *path, Trace &trace)
+{
+    uint8_t buf[8];
+    FILE *f = fopen(path, "rb");
+
+    if (f == NULL)
+    {
+        perror(path);
+        return false;
+    }
+    if (fread(buf, 1, 8, f) != 8 || memcmp(buf, "RA8T", 4) != 0 ||
+        buf[4] != RA8876_TRACE_VERSION || buf[5] != RA8876_TRACE_RECSIZE)
+    {
+        fprintf(stderr, "%s: not an RA8876 trace\n", path);
+        fclose(f);
+        return false;
+    }
+    while (fread(buf, 1, RA8876_TRACE_RECSIZE, f) == RA8876_TRACE_RECSIZE)
+    {
+        RA8876_TraceRec rec;
+        rec.type = buf[0];
+        rec.reg = buf[1];
+        rec.value = buf[2] | buf[3] << 8;
+        rec.dt = buf[4] | buf[5] << 8;
+        trace.push_back(rec);
+    }
+    fclose(f);
+    return true;
+}
+
+static uint32_t burstBytes(const RA8876_TraceRec &rec)
+{
+    return rec.value | (uint32_t)rec.reg << 16;
+}
+
+static const char *regName(uint8_t reg)
+{
+    const RA8876_RegName *r = ra8876_reg(reg);
+    return r ? r->name : "-";
+}
+
+// Writing these has a side effect (start an engine, clear a flag, push a
+// byte), so writing the same value again is not redundant.
+static bool triggerReg(uint8_t reg)
+{
+    switch (reg)
+    {
+    case 0x00: case 0x04: case 0x0C: case 0x67: case 0x76: case 0x90:
+    case 0xB6: case 0xB8: case 0xE7: case 0xE9:
+        return true;
+    }
+    return false;
+}
+
+// A polling unit is a status read, or a register read with or without the
+// command cycle selecting the register (memory reads through [04h] are data,
+// not polls). Returns the records it spans, 0 when the trace does not hold
+// one at 'i'.
+static unsigned pollUnit(const Trace &t, size_t i, uint8_t &type, uint8_t &reg)
+{
+    if (t[i].type == RA8876_TRACE_STATUS ||
+        (t[i].type == RA8876_TRACE_READ && t[i].reg != 0x04))
+    {
+        type = t[i].type;
+        reg = t[i].reg;
+        return 1;
+    }
+    if (t[i].type == RA8876_TRACE_CMD && t[i].value != 0x04 && i + 1 < t.size() &&
+        t[i + 1].type == RA8876_TRACE_READ && t[i + 1].reg == t[i].value)
+    {
+        type = RA8876_TRACE_READ;
+        reg = t[i].value;
+        return 2;
+    }
+    return 0;
+}
+
+// Length in records of the polling loop starting at 'i', 0 if none; 'polls'
+// gets the number of reads in it.
+static size_t pollRun(const Trace &t, size_t i, uint8_t &type, uint8_t &reg, uint32_t &polls)
+{
+    uint8_t type2, reg2;
+    unsigned len = pollUnit(t, i, type, reg);
+    size_t j = i;
+
+    polls = 0;
+    while (len && j < t.size())
+    {
+        unsigned n = pollUnit(t, j, type2, reg2);
+        if (n != len || type2 != type || reg2 != reg)
+            break;
+        j += n;
+        polls++;
+    }
+    return polls >= POLL_MIN ? j - i : 0;
+}
+
+//-----------------------------------------------------------------------------
+static int decode(const Trace &t)
+{
+    uint64_t us = 0;
+
+    printf("%12s %7s  %-7s %-22s %s\n", "time(us)", "dt", "cycle", "register", "value");
+    for (size_t i = 0; i < t.size(); i++)
+    {
+        const RA8876_TraceRec &rec = t[i];
+        const RA8876_RegName *r = ra8876_reg(rec.reg);
+        char reg[32];
+
+        if (rec.type == RA8876_TRACE_TIME)
+        {
+            us += (uint64_t)rec.value * 1000;
+            printf("%12s %7s  %-7s %u ms\n", "", "", "TIME", rec.value);
+            continue;
+        }
+        us += rec.dt;
+        if (rec.type == RA8876_TRACE_BURST || rec.type == RA8876_TRACE_READBURST)
+            r = ra8876_reg(0x04);   // reg holds the high count bits
+        snprintf(reg, sizeof(reg), "[%02Xh] %s", r ? r->reg : rec.reg, r ? r->name : "");
+        printf("%12llu %7u  %-7s ", (unsigned long long)us, rec.dt,
+               rec.type < RA8876_TRACE_TYPES ? typeNames[rec.type] : "?");
+        switch (rec.type)
+        {
+        case RA8876_TRACE_CMD:
+            printf("%-22s %s\n", reg, r ? r->desc : "");
+            break;
+        case RA8876_TRACE_DATA:
+        case RA8876_TRACE_READ:
+        case RA8876_TRACE_STATUS:
+            printf("%-22s %02Xh\n", reg, rec.value);
+            break;
+        case RA8876_TRACE_DATA16:
+            printf("%-22s %04Xh\n", reg, rec.value);
+            break;
+        case RA8876_TRACE_BURST:
+        case RA8876_TRACE_READBURST:
+            printf("%-22s %lu bytes\n", reg, (unsigned long)burstBytes(rec));
+            break;
+        default:
+            printf("\n");
+            break;
+        }
+    }
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+struct PollStat {
+    uint32_t runs;
+    uint32_t polls;
+    uint32_t longest;
+    uint64_t us;
+};
+
+static int summary(const Trace &t)
+{
+    uint32_t types[RA8876_TRACE_TYPES] = {0};
+    uint32_t writes[256] = {0};
+    uint32_t redundant[256] = {0};
+    int16_t held[256];          // last value written, -1 unknown
+    PollStat status = {0, 0, 0, 0};
+    PollStat reads[256];
+    uint64_t us = 0, bytes = 0;
+    size_t i;
+
+    memset(reads, 0, sizeof(reads));
+    for (i = 0; i < 256; i++)
+        held[i] = -1;
+
+    for (i = 0; i < t.size(); i++)
+    {
+        const RA8876_TraceRec &rec = t[i];
+        uint8_t type, reg;
+        uint32_t polls;
+        size_t run = pollRun(t, i, type, reg, polls);
+
+        if (run)
+        {
+            PollStat &s = (type == RA8876_TRACE_STATUS) ? status : reads[reg];
+            s.runs++;
+            s.polls += polls;
+            if (polls > s.longest)
+                s.longest = polls;
+            for (size_t j = i; j < i + run; j++)
+            {
+                s.us += t[j].dt;
+                us += t[j].dt;
+                types[t[j].type]++;
+                bytes += 2;
+            }
+            held[reg] = -1;
+            i += run - 1;
+            continue;
+        }
+
+        if (rec.type < RA8876_TRACE_TYPES)
+            types[rec.type]++;
+        switch (rec.type)
+        {
+        case RA8876_TRACE_TIME:
+            us += (uint64_t)rec.value * 1000;
+            continue;
+        case RA8876_TRACE_DATA:
+            writes[rec.reg]++;
+            if (!triggerReg(rec.reg) && held[rec.reg] == rec.value)
+                redundant[rec.reg]++;
+            held[rec.reg] = rec.value;
+            bytes += 2;
+            break;
+        case RA8876_TRACE_READ:
+            held[rec.reg] = -1;
+            bytes += 2;
+            break;
+        case RA8876_TRACE_DATA16:
+            bytes += 3;
+            break;
+        case RA8876_TRACE_BURST:
+        case RA8876_TRACE_READBURST:
+            bytes += 1 + burstBytes(rec);
+            break;
+        case RA8876_TRACE_CMD:
+        case RA8876_TRACE_STATUS:
+            bytes += 2;
+            break;
+        }
+        us += rec.dt;
+    }
+
+    printf("%lu records over %.3f ms, %llu bytes on the wire (SPI)\n\n",
+           (unsigned long)t.size(), us / 1000.0, (unsigned long long)bytes);
+    for (i = 0; i < RA8876_TRACE_TYPES; i++)
+        if (types[i])
+            printf("  %-7s %10lu\n", typeNames[i], (unsigned long)types[i]);
+
+    printf("\nRedundant writes (same value as the last write):\n");
+    for (i = 0; i < 256; i++)
+        if (redundant[i])
+            printf("  [%02Xh] %-12s %8lu of %lu\n", (unsigned)i, regName(i),
+                   (unsigned long)redundant[i], (unsigned long)writes[i]);
+
+    printf("\nPolling loops:\n");
+    if (status.runs)
+        printf("  %-19s %6lu loops %8lu polls, longest %lu, %.3f ms\n", "status",
+               (unsigned long)status.runs, (unsigned long)status.polls,
+               (unsigned long)status.longest, status.us / 1000.0);
+    for (i = 0; i < 256; i++)
+        if (reads[i].runs)
+            printf("  [%02Xh] %-13s %6lu loops %8lu polls, longest %lu, %.3f ms\n",
+                   (unsigned)i, regName(i), (unsigned long)reads[i].runs,
+                   (unsigned long)reads[i].polls, (unsigned long)reads[i].longest,
+                   reads[i].us / 1000.0);
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+// Plays the trace on any transport with the RA8876_Driver bus interface.
+template<class Bus>
+static int replay(Bus &bus, const Trace &t)
+{
+    uint32_t mismatches = 0, timeouts = 0;
+
+    for (size_t i = 0; i < t.size(); i++)
+    {
+        const RA8876_TraceRec &rec = t[i];
+        uint8_t type, reg;
+        uint32_t polls;
+        size_t run = pollRun(t, i, type, reg, polls);
+
+        if (rec.type == RA8876_TRACE_TIME)
+        {
+            delay(rec.value);
+            continue;
+        }
+        if (rec.dt >= 1000)
+            delayMicroseconds(rec.dt);
+
+        if (run)
+        {
+            uint16_t want = t[i + run - 1].value;
+            unsigned long start = millis();
+            bool select = (t[i].type == RA8876_TRACE_CMD);
+
+            for (;;)
+            {
+                uint16_t got;
+                if (type == RA8876_TRACE_STATUS)
+                    got = bus.statusRead();
+                else
+                {
+                    if (select)
+                        bus.cmdWrite(reg);
+                    got = bus.dataRead();
+                }
+                if (got == want)
+                    break;
+                if (millis() - start > POLL_TIMEOUT_MS)
+                {
+                    fprintf(stderr, "record %lu: polling %s stuck at %02Xh, want %02Xh\n",
+                            (unsigned long)i, type == RA8876_TRACE_STATUS ? "status" : regName(reg),
+                            got, want);
+                    timeouts++;
+                    break;
+                }
+            }
+            i += run - 1;
+            continue;
+        }
+
+        switch (rec.type)
+        {
+        case RA8876_TRACE_RESET:
+            bus.hwReset();
+            break;
+        case RA8876_TRACE_CMD:
+            bus.cmdWrite(rec.value);
+            break;
+        case RA8876_TRACE_DATA:
+            bus.dataWrite(rec.value);
+            break;
+        case RA8876_TRACE_DATA16:
+            bus.dataWrite16(rec.value);
+            break;
+        case RA8876_TRACE_READ:
+        {
+            uint16_t got = bus.dataRead();
+            if (got != rec.value && mismatches++ < 20)
+                fprintf(stderr, "record %lu: [%02Xh] %s read %02Xh, trace has %02Xh\n",
+                        (unsigned long)i, rec.reg, regName(rec.reg), got, rec.value);
+            break;
+        }
+        case RA8876_TRACE_STATUS:
+            bus.statusRead();
+            break;
+        case RA8876_TRACE_BURST:
+        {
+            uint32_t n = burstBytes(rec);
+            bus.burstBegin();
+            while (n--)
+                bus.burstWrite8(0);
+            bus.burstEnd();
+            break;
+        }
+        case RA8876_TRACE_READBURST:
+        {
+            uint16_t pixels[256];
+            uint32_t n = burstBytes(rec) / 2;
+            while (n)
+            {
+                uint32_t k = n < 256 ? n : 256;
+                bus.burstReadPixels(pixels, k);
+                n -= k;
+            }
+            break;
+        }
+        }
+    }
+    printf("replayed %lu records, %lu read mismatches, %lu polling timeouts\n",
+           (unsigned long)t.size(), (unsigned long)mismatches, (unsigned long)timeouts);
+    return (mismatches || timeouts) ? 1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+static int usage()
+{
+    fprintf(stderr,
+            "usage: ra8876_trace decode FILE\n"
+            "       ra8876_trace summary FILE\n"
+            "       ra8876_trace replay FILE SPIDEV HZ [GPIOCHIP LINE]\n"
+            "       ra8876_trace replay FILE -m [HZ]\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    Trace trace;
+
+    if (argc < 3)
+        return usage();
+    if (!load(argv[2], trace))
+        return 1;
+
+    if (strcmp(argv[1], "decode") == 0)
+        return decode(trace);
+    if (strcmp(argv[1], "summary") == 0)
+        return summary(trace);
+    if (strcmp(argv[1], "replay") == 0 && (argc == 4 || argc == 5) && strcmp(argv[3], "-m") == 0)
+    {
+        RA8876_LinuxSpiBus bus(NULL, argc == 5 ? strtoul(argv[4], NULL, 0) : 20000000, NULL, 0);
+        RA8876_Model sim;
+        RA8876_FilePrint out(stdout);
+
+        sim.attach(bus.spi());
+        bus.begin();
+        int rc = replay(bus, trace);
+        sim.report(out);
+        return rc;
+    }
+    if (strcmp(argv[1], "replay") == 0 && (argc == 5 || argc == 7))
+    {
+        RA8876_LinuxSpiBus bus(argv[3], strtoul(argv[4], NULL, 0),
+                               argc == 7 ? argv[5] : NULL,
+                               argc == 7 ? strtoul(argv[6], NULL, 0) : 0);
+        bus.begin();
+        if (!bus.ok())
+        {
+            perror(argv[3]);
+            return 1;
+        }
+        return replay(bus, trace);
+    }
+    return usage();
+}
@@ -8,24 +8,38 @@
 // Model: ER-TFTM0784-1
 //        ( 400 x 1280 dots 7.84" color IPS tft lcd )
 //
-// This code was only slightly modified from the 8051 example code
-// written by JAVEN LIU. In his example, he bit-bangs the SPI to the
-// SSD2828, and since this only needs to be done on powerup and doesnt
-// need to be performant,  I decided to keep it that way to save resources.
-//
-// I did change the GPIO stuff to be Arduino-oriented rather than Keil 8051.
+// The register and panel command sequence comes from the 8051 example code
+// written by JAVEN LIU, kept as a table that Initial() walks. On Arduino the
+// 3-wire SPI is bit-banged through the pins' port registers at
+// SSD2828_SPI_HZ.
 //
 ///////////////////////////////////////////////////////////////////////////////
 #include "2828.h"
+
+#ifdef ARDUINO
+#define SSD2828_SDI     0
+#define SSD2828_SCLK    1
+#define SSD2828_CS      2
+
+// spi_delay() loop count for half an SSD2828_SPI_HZ clock. A volatile loop
+// iteration is taken as at least 4 MCU cycles.
+#ifdef F_CPU
+#define SSD2828_HALF_LOOPS  (F_CPU / SSD2828_SPI_HZ / 8 + 1)
+#else
+#define SSD2828_HALF_LOOPS  50
+#endif
+
 //-----------------------------------------------------------------------------
 SSD2828::SSD2828(uint8_t sdi_pin, uint8_t sclk_pin, uint8_t cs_pin, uint8_t rst_pin) {
   SDI_2828 = sdi_pin;
   SCLK_2828 = sclk_pin;
   CS_2828 = cs_pin;
   RST_2828 = rst_pin;
+  init_2828 = NULL;
+  step_2828 = 0;
 }
 
-void SSD2828::Reset(void)
+void SSD2828::Pin_Init(void)
 {
 
   // GPIO init
@@ -42,83 +56,101 @@ void SSD2828::Reset(void)
   pinMode(RST_2828, OUTPUT);
   digitalWrite(RST_2828, 1);
 
-  // chip reset
-
-  digitalWrite(RST_2828, 0);
-  delay(30);
-
-  digitalWrite(RST_2828, 1);
-  delay(50);
+#ifdef portOutputRegister
+  const uint8_t pins[3] = { SDI_2828, SCLK_2828, CS_2828 };
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    out_2828[i] = (RA8876_PortReg *)portOutputRegister(digitalPinToPort(pins[i]));
+    mask_2828[i] = digitalPinToBitMask(pins[i]);
+  }
+#endif
+}
 
+inline void SSD2828::Reset_Line(uint8_t level)
+{
+  digitalWrite(RST_2828, level);
 }
 //-----------------------------------------------------------------------------
 inline void SSD2828::spi_delay(void)
 {
-  // 128 NOPS should bring the SPI speed well below 2.3 MHz on
-  // a Teensy 4.0. On AVR devices, even slower.
+  for (volatile uint16_t i = SSD2828_HALF_LOOPS; i; i--);
+}
 
-  // Source: https://forum.pjrc.com/threads/42865-A-set-of-scope-tested-100-500-ns-delay-macros
-  for (uint32_t i = 0; i < 50; i++) __asm__("nop\n\t"); // Delay of 213 ns
+inline void SSD2828::pinWrite(uint8_t sig, uint8_t level)
+{
+#ifdef portOutputRegister
+  if (level)
+    *out_2828[sig] |= mask_2828[sig];
+  else
+    *out_2828[sig] &= ~mask_2828[sig];
+#else
+  digitalWrite(sig == SSD2828_SDI ? SDI_2828 : sig == SSD2828_SCLK ? SCLK_2828 : CS_2828, level);
+#endif
 }
 //-----------------------------------------------------------------------------
-void SSD2828::SPI_3W_SET_Cmd(uint16_t Sdata)
+// One 9-bit word, D/C bit first, sampled on the rising SCLK edge, framed by
+// CS.
+void SSD2828::SPI_3W_Word(uint16_t word)
 {
-  uint8_t i;
-  digitalWrite(CS_2828, 0);
-  spi_delay();
-  digitalWrite(SDI_2828, 0);
-  spi_delay();
-  digitalWrite(SCLK_2828 , 0);
-  spi_delay();
-  digitalWrite(SCLK_2828 , 1);
-  spi_delay();
-  for (i = 8; i > 0; i--)
+  pinWrite(SSD2828_CS, 0);
+  for (uint16_t bit = 0x100; bit; bit >>= 1)
   {
-    if (Sdata & 0x80)
-      digitalWrite(SDI_2828, 1);
-    else
-      digitalWrite(SDI_2828, 0);
+    pinWrite(SSD2828_SCLK, 0);
+    pinWrite(SSD2828_SDI, word & bit);
     spi_delay();
-    digitalWrite(SCLK_2828 , 0);
+    pinWrite(SSD2828_SCLK, 1);
     spi_delay();
-    digitalWrite(SCLK_2828 , 1);
-    spi_delay();
-    Sdata <<= 1;
   }
-  digitalWrite(SCLK_2828 , 0);
-  spi_delay();
-  digitalWrite(CS_2828, 1);
+  pinWrite(SSD2828_SCLK, 0);
+  pinWrite(SSD2828_CS, 1);
   spi_delay();
 }
 //-----------------------------------------------------------------------------
+inline void SSD2828::Flush(void)
+{
+}
+#else
+//-----------------------------------------------------------------------------
+// Linux: the 9-bit words are queued, one transfer each so CS still frames
+// every word, and sent in one SPI_IOC_MESSAGE before each delay().
+SSD2828::SSD2828(const char *spidev, const char *gpiochip, unsigned rst_line) {
+  DEV_2828 = spidev;
+  CHIP_2828 = gpiochip;
+  RST_2828 = rst_line;
+  init_2828 = NULL;
+  step_2828 = 0;
+}
+
+void SSD2828::Pin_Init(void)
+{
+  spi_2828.open(DEV_2828, 9);
+  rst_2828.open(CHIP_2828, RST_2828, 1);
+}
+
+inline void SSD2828::Reset_Line(uint8_t level)
+{
+  rst_2828.write(level);
+}
+//-----------------------------------------------------------------------------
+void SSD2828::SPI_3W_Word(uint16_t word)
+{
+  memcpy(spi_2828.tx(spi_2828.add(2, SSD2828_SPI_HZ, false)), &word, 2);
+}
+
+void SSD2828::Flush(void)
+{
+  spi_2828.flush();
+}
+#endif
+//-----------------------------------------------------------------------------
+void SSD2828::SPI_3W_SET_Cmd(uint16_t Sdata)
+{
+  SPI_3W_Word(Sdata & 0xFF);
+}
+
 void SSD2828::SPI_3W_SET_PAs(uint16_t Sdata)
 {
-  uint8_t i;
-  digitalWrite(CS_2828, 0);
-  spi_delay();
-  digitalWrite(SDI_2828, 1);
-  spi_delay();
-  digitalWrite(SCLK_2828 , 0);
-  spi_delay();
-  digitalWrite(SCLK_2828 , 1);
-  spi_delay();
-  for (i = 8; i > 0; i--)
-  {
-    if (Sdata & 0x80)
-      digitalWrite(SDI_2828, 1);
-    else
-      digitalWrite(SDI_2828, 0);
-    spi_delay();
-    digitalWrite(SCLK_2828 , 0);
-    spi_delay();
-    digitalWrite(SCLK_2828 , 1);
-    spi_delay();
-    Sdata <<= 1;
-  }
-  digitalWrite(SCLK_2828 , 0);
-  spi_delay();
-  digitalWrite(CS_2828, 1);
-  spi_delay();
+  SPI_3W_Word(0x100 | (Sdata & 0xFF));
 }
 //-----------------------------------------------------------------------------
 void SSD2828::SPI_WriteData(uint8_t value)
@@ -139,165 +171,173 @@ void SSD2828::GP_COMMAD_PA(uint16_t num)
   SPI_WriteCmd(PACKET_DROP_REGISTER);
 }
 //-----------------------------------------------------------------------------
-void SSD2828::SendCmd(uint8_t cmd, uint8_t data1, uint8_t data2) {
-    SPI_WriteCmd(cmd);
-    SPI_WriteData(data1);
-    SPI_WriteData(data2);
-}
+// Bring-up sequence for Initial(). Each entry is a command byte, a count
+// and that many parameter bytes: SSD2828 registers take their 16-bit value
+// low byte first, PACKET_DROP_REGISTER entries are generic packets to the
+// panel (the count goes to PACKET_SIZE_CONTROL_REGISTER_1 first). With
+// SSD2828_WAIT in the count, one more byte follows: milliseconds to wait
+// once the entry is sent.
+#define SSD2828_WAIT            0x80
+#define SSD2828_REG(reg, v)     reg, 2, (uint8_t)(v), (uint8_t)((v) >> 8)
+#define SSD2828_PKT(n, ...)     PACKET_DROP_REGISTER, n, __VA_ARGS__
+
+static const uint8_t ssd2828Init[] PROGMEM =
+{
+    // LP mode at a slow PLL for the panel commands.
+    SSD2828_REG(CONFIGURATION_REGISTER, 0x0050),        // 50=TX_CLK 70=PCLK
+    SSD2828_REG(VC_CONTROL_REGISTER, 0x0000),           // VC(Virtual ChannelID) Control Register
+    SSD2828_REG(PLL_CONTROL_REGISTER, 0x0000),          // 0=PLL off while it is configured
+    SSD2828_REG(PLL_CONFIGURATION_REGISTER, 0x8220),    // NS=1, PLL00=62.5-125, MS=1
+    SSD2828_REG(CLOCK_CONTROL_REGISTER, 0x0007),        // LP Clock Divider LP clock = 400MHz / LPD / 8 = 480 / 8/ 8 = 7MHz
+    SSD2828_REG(PLL_CONTROL_REGISTER, 0x0001),          // 1=PLL enable
+
+    SSD2828_PKT(1, 0x10),
+    SSD2828_PKT(2, 0xCD, 0xAA),
+    SSD2828_PKT(2, 0x41, 0x34),
+    SSD2828_PKT(2, 0x30, 0x00),
+    SSD2828_PKT(2, 0x39, 0x11),
+    SSD2828_PKT(2, 0x32, 0x00),
+    SSD2828_PKT(2, 0x33, 0x38),
+    SSD2828_PKT(2, 0x35, 0x24),
+    SSD2828_PKT(2, 0x4F, 0x35),
+    SSD2828_PKT(2, 0x4E, 0x27),
+    SSD2828_PKT(2, 0x41, 0x56),
+    SSD2828_PKT(9, 0x55, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F),
+    SSD2828_PKT(17, 0x56, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F),
+    SSD2828_PKT(2, 0x65, 0x08),
+    SSD2828_PKT(2, 0x3A, 0x08),
+    SSD2828_PKT(2, 0x36, 0x49),
+    SSD2828_PKT(2, 0x67, 0x82),
+    SSD2828_PKT(2, 0x69, 0x20),
+    SSD2828_PKT(2, 0x6C, 0x80),
+    SSD2828_PKT(2, 0x6D, 0x01),
+    SSD2828_PKT(20, 0x53, 0x1F, 0x19, 0x15, 0x11, 0x11, 0x11, 0x12, 0x14, 0x15, 0x11, 0x0D, 0x0B, 0x0B, 0x0D, 0x0C, 0x0C, 0x08, 0x04, 0x00),
+    SSD2828_PKT(20, 0x54, 0x1F, 0x19, 0x15, 0x11, 0x11, 0x11, 0x13, 0x15, 0x16, 0x11, 0x0D, 0x0C, 0x0C, 0x0E, 0x0C, 0x0C, 0x08, 0x04, 0x00),
+    SSD2828_PKT(2, 0x6B, 0x00),
+    SSD2828_PKT(2, 0x58, 0x00),
+    SSD2828_PKT(2, 0x73, 0xF0),
+    SSD2828_PKT(2, 0x76, 0x40),
+    SSD2828_PKT(2, 0x77, 0x04),
+    SSD2828_PKT(2, 0x74, 0x17),
+    SSD2828_PKT(2, 0x5E, 0x03),
+    SSD2828_PKT(2, 0x68, 0x10),
+    SSD2828_PKT(2, 0x6A, 0x00),
+    SSD2828_PKT(2, 0x28, 0x31),
+    SSD2828_PKT(2, 0x29, 0x21),
+    SSD2828_PKT(2, 0x63, 0x04),
+    SSD2828_PKT(2, 0x27, 0x00),
+    SSD2828_PKT(2, 0x7C, 0x80),
+    SSD2828_PKT(2, 0x2E, 0x05),
+    SSD2828_PKT(2, 0x4C, 0x80),
+    SSD2828_PKT(2, 0x50, 0xC0),
+    SSD2828_PKT(2, 0x78, 0x6E),
+    SSD2828_PKT(2, 0x2D, 0x31),
+    SSD2828_PKT(2, 0x49, 0x00),
+    SSD2828_PKT(2, 0x4D, 0x00),
+    PACKET_DROP_REGISTER, 1 | SSD2828_WAIT, 0x11, 120,  // sleep out
+    PACKET_DROP_REGISTER, 1 | SSD2828_WAIT, 0x29, 120,  // display on
+
+    // PLL up to the HS video clock.
+    SSD2828_REG(PLL_CONTROL_REGISTER, 0x0000),
+    SSD2828_REG(PLL_CONFIGURATION_REGISTER, 0x822D),    // NS=1, PLL00=62.5-125, MS=1
+    SSD2828_REG(CLOCK_CONTROL_REGISTER, 0x0007),
+    SSD2828_REG(PLL_CONTROL_REGISTER, 0x0001),
+    DELAY_ADJUSTMENT_REGISTER_1, 2 | SSD2828_WAIT, 0x02, 0x23, 100, // p1: HS-Data-zero  p2: HS-Data- prepare  --> 8031 issue
 
-void SSD2828::WriteDataPacket(uint16_t num, ...) {
-    va_list args;
-    va_start(args, num);
+    SSD2828_REG(DELAY_ADJUSTMENT_REGISTER_2, 0x2301),   // CLK Prepare, Clk Zero
+    SSD2828_REG(DELAY_ADJUSTMENT_REGISTER_3, 0x0510),   // Clk Post, Clk Per
+    SSD2828_REG(DELAY_ADJUSTMENT_REGISTER_4, 0x1005),   // HS Trail, Clk Trail
+    SSD2828_REG(LP_RX_TIMER_REGISTER_2, 0x0000),
 
-    SPI_WriteCmd(PACKET_SIZE_CONTROL_REGISTER_1);
-    SPI_WriteData(num & 0xff);
-    SPI_WriteData((num >> 8) & 0xff);
-    SPI_WriteCmd(PACKET_DROP_REGISTER);
+    // RGB interface
+    SSD2828_REG(RGB_INTERFACE_CONTROL_REGISTER_1, LCD_VSPW << 8 | LCD_HSPW),   // HSA, VSA
+    SSD2828_REG(RGB_INTERFACE_CONTROL_REGISTER_2, LCD_VBPD << 8 | LCD_HBPD),   // HBP, VBP
+    SSD2828_REG(RGB_INTERFACE_CONTROL_REGISTER_3, LCD_VFPD << 8 | LCD_HFPD),   // HFP, VFP
+    SSD2828_REG(RGB_INTERFACE_CONTROL_REGISTER_4, 0x0190),  // Horizontal active period 400
+    SSD2828_REG(RGB_INTERFACE_CONTROL_REGISTER_5, 0x0500),  // Vertical active period 1280
+    SSD2828_REG(RGB_INTERFACE_CONTROL_REGISTER_6, 0xC00B),  // D1-0=11 24bpp, D15=VS D14=HS D13=CLK, D8=0 video with blanking packet
+
+    // MIPI lanes, then video mode on.
+    SSD2828_REG(LANE_CONFIGURATION_REGISTER, 0x0003),   // 11=4LANE 10=3LANE 01=2LANE 00=1LANE
+    SSD2828_REG(RGB_CONTROL_REGISTER, 0x0001),          // D0=0=RGB 1:BGR D1=1=Most significant byte sent first
+    SSD2828_REG(PULL_CONTROL_REGISTER_3, 0x0058),
+    SSD2828_REG(CONFIGURATION_REGISTER, 0x024B),
+    0x2C, 0,
+};
+
+// Sends the table from init_2828 up to the next wait and returns its
+// milliseconds, or 0 at the end of the table.
+uint8_t SSD2828::Init_Step(void)
+{
+  const uint8_t *end = ssd2828Init + sizeof(ssd2828Init);
+
+  while (init_2828 < end)
+  {
+    uint8_t cmd = pgm_read_byte(init_2828++);
+    uint8_t count = pgm_read_byte(init_2828++);
+    uint8_t n = count & ~SSD2828_WAIT;
 
-    for (uint16_t i = 0; i < num; ++i) {
-        uint8_t data = va_arg(args, int);
-        SPI_WriteData(data);
+    if (cmd == PACKET_DROP_REGISTER)
+      GP_COMMAD_PA(n);
+    else
+      SPI_WriteCmd(cmd);
+    while (n--)
+      SPI_WriteData(pgm_read_byte(init_2828++));
+    if (count & SSD2828_WAIT)
+    {
+      Flush();
+      return pgm_read_byte(init_2828++);
     }
-    
-    va_end(args);
+  }
+  Flush();
+  return 0;
+}
+
+void SSD2828::Reset(void)
+{
+  Pin_Init();
+
+  // chip reset
+
+  Reset_Line(0);
+  delay(SSD2828_RESET_LOW_MS);
+
+  Reset_Line(1);
+  delay(SSD2828_RESET_WAIT_MS);
 }
 
 void SSD2828::Initial(void)
 {
-    SendCmd(CONFIGURATION_REGISTER, 0x50, 0x00);  // 50=TX_CLK 70=PCLK
-    SendCmd(VC_CONTROL_REGISTER, 0x00, 0x00);  // VC(Virtual ChannelID) Control Register
-    SendCmd(PLL_CONTROL_REGISTER, 0x00, 0x00);  // 1=PLL disable
-    SendCmd(PLL_CONFIGURATION_REGISTER, 0x20, 0x82);  // NS=1, PLL00=62.5-125, MS=1
-    SendCmd(CLOCK_CONTROL_REGISTER, 0x07, 0x00);  // LP Clock Divider LP clock = 400MHz / LPD / 8 = 480 / 8/ 8 = 7MHz
-    SendCmd(PLL_CONTROL_REGISTER, 0x01, 0x00);  // 1=PLL disable
-
-    WriteDataPacket(1, 0x10);
-    WriteDataPacket(2, 0xCD, 0xAA);
-    WriteDataPacket(2, 0x41, 0x34);
-    WriteDataPacket(2, 0x30, 0x00);
-    WriteDataPacket(2, 0x39, 0x11);
-    WriteDataPacket(2, 0x32, 0x00);
-    WriteDataPacket(2, 0x33, 0x38);
-    WriteDataPacket(2, 0x35, 0x24);
-    WriteDataPacket(2, 0x4F, 0x35);
-    WriteDataPacket(2, 0x4E, 0x27);
-    WriteDataPacket(2, 0x41, 0x56);
-    WriteDataPacket(9, 0x55, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F);
-    WriteDataPacket(17, 0x56, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F);
-    WriteDataPacket(2, 0x65, 0x08);
-    WriteDataPacket(2, 0x3A, 0x08);
-    WriteDataPacket(2, 0x36, 0x49);
-    WriteDataPacket(2, 0x67, 0x82);
-    WriteDataPacket(2, 0x69, 0x20);
-    WriteDataPacket(2, 0x6C, 0x80);
-    WriteDataPacket(2, 0x6D, 0x01);
-    WriteDataPacket(20, 0x53, 0x1F, 0x19, 0x15, 0x11, 0x11, 0x11, 0x12, 0x14, 0x15, 0x11, 0x0D, 0x0B, 0x0B, 0x0D, 0x0C, 0x0C, 0x08, 0x04, 0x00);
-    WriteDataPacket(20, 0x54, 0x1F, 0x19, 0x15, 0x11, 0x11, 0x11, 0x13, 0x15, 0x16, 0x11, 0x0D, 0x0C, 0x0C, 0x0E, 0x0C, 0x0C, 0x08, 0x04, 0x00);
-    WriteDataPacket(2, 0x6B, 0x00);
-    WriteDataPacket(2, 0x58, 0x00);
-    WriteDataPacket(2, 0x73, 0xF0);
-    WriteDataPacket(2, 0x76, 0x40);
-    WriteDataPacket(2, 0x77, 0x04);
-    WriteDataPacket(2, 0x74, 0x17);
-    WriteDataPacket(2, 0x5E, 0x03);
-    WriteDataPacket(2, 0x68, 0x10);
-    WriteDataPacket(2, 0x6A, 0x00);
-    WriteDataPacket(2, 0x28, 0x31);
-    WriteDataPacket(2, 0x29, 0x21);
-    WriteDataPacket(2, 0x63, 0x04);
-    WriteDataPacket(2, 0x27, 0x00);
-    WriteDataPacket(2, 0x7C, 0x80);
-    WriteDataPacket(2, 0x2E, 0x05);
-    WriteDataPacket(2, 0x4C, 0x80);
-    WriteDataPacket(2, 0x50, 0xC0);
-    WriteDataPacket(2, 0x78, 0x6E);
-    WriteDataPacket(2, 0x2D, 0x31);
-    WriteDataPacket(2, 0x49, 0x00);
-    WriteDataPacket(2, 0x4D, 0x00);
-    WriteDataPacket(1, 0x11);
-    delay(120);
-    WriteDataPacket(1, 0x29);
-    delay(120);
-
-    SendCmd(CONFIGURATION_REGISTER, 0x50, 0x00);  // Configuration Register
-    SendCmd(VC_CONTROL_REGISTER, 0x00, 0x00);  // VC(Virtual ChannelID) Control Register
-    SendCmd(PLL_CONTROL_REGISTER, 0x00, 0x00);  // 1=PLL disable
-    SendCmd(PLL_CONFIGURATION_REGISTER, 0x20, 0x82);  // NS=1, PLL00=62.5-125, MS=1
-    SendCmd(CLOCK_CONTROL_REGISTER, 0x07, 0x00);  // LP Clock Divider LP clock = 400MHz / LPD / 8 = 480 / 8/ 8 = 7MHz
-    SendCmd(PLL_CONTROL_REGISTER, 0x01, 0x00);  // 1=PLL disable
-    SendCmd(DELAY_ADJUSTMENT_REGISTER_1, 0x02, 0x23);  // p1: HS-Data-zero  p2: HS-Data- prepare  --> 8031 issue
-    delay(100);
-
-    SendCmd(DELAY_ADJUSTMENT_REGISTER_2, 0x01, 0x23);  // CLK Prepare, Clk Zero
-    SendCmd(DELAY_ADJUSTMENT_REGISTER_3, 0x10, 0x05);  // Clk Post, Clk Per
-    SendCmd(DELAY_ADJUSTMENT_REGISTER_4, 0x05, 0x10);  // HS Trail, Clk Trail
-    SendCmd(LP_RX_TIMER_REGISTER_2, 0x00, 0x00);
-
-
-    //RGB interface configuration
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_1, 0x18, 0x02);  // HSPW 07, VSPW 05
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_2, 0xA0, 0x0A);  // HBPD 0x64=100, VBPD 8
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_3, 0xA0, 0x0C);  // HFPD 8, VFPD 10
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_4, 0x90, 0x01);  // Horizontal active period 720=02D0, 013F=319 02D0=720
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_5, 0x00, 0x05);  // Vertical active period 1280=0500
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_6, 0x0B, 0x00);  // RGB CLK 16BPP=00 18BPP=01, D7=0 D6=0 D5=0  D1-0=11 ¨C 24bpp, D15=VS D14=HS D13=CLK D12-9=NC D8=0=Video with blanking packet. 00-F0
-
-
-    //MIPI lane configuration
-    SendCmd(LANE_CONFIGURATION_REGISTER, 0x03, 0x00);  // 11=4LANE 10=3LANE 01=2LANE 00=1LANE
-    SendCmd(RGB_CONTROL_REGISTER, 0x05, 0x00);  // 05=BGR 04=RGB, D0=0=RGB 1:BGR D1=1=Most significant byte sent first
-    SendCmd(PULL_CONTROL_REGISTER_3, 0x58, 0x00);
-    SendCmd(CONFIGURATION_REGISTER, 0x6B, 0x02);
-    SendCmd(CONFIGURATION_REGISTER, 0x50, 0x00); //50=TX_CLK 70=PCLK
-    SendCmd(VC_CONTROL_REGISTER, 0x00, 0x00);  // VC(Virtual ChannelID) Control Register
-    SendCmd(PLL_CONTROL_REGISTER, 0x00, 0x00);  // 1=PLL disable
-    SendCmd(PLL_CONFIGURATION_REGISTER, 0x14, 0x42);  //0x14,D7-0=NS(0x01 : NS=1), 0x42,D15-14=PLL00=62.5-125 01=126-250 10=251-500 11=501-1000  DB12-8=MS(01:MS=1)
-    SendCmd(CLOCK_CONTROL_REGISTER, 0x03, 0x00);  // LP Clock Divider LP clock = 400MHz / LPD / 8 = 480 / 8/ 8 = 7MHz
-    SendCmd(PLL_CONTROL_REGISTER, 0x01, 0x00);  // 1=PLL disable
-    
-    // MIPI lane configuration
-    SendCmd(LANE_CONFIGURATION_REGISTER, 0x00, 0x00);
-    SendCmd(DELAY_ADJUSTMENT_REGISTER_1, 0x02, 0x23);  // p1: HS-Data-zero  p2: HS-Data- prepare  --> 8031 issue
-
-  //    delay(100);
-
-  //    LCD_initial();
-    SendCmd(CONFIGURATION_REGISTER, 0x50, 0x00);
-    SendCmd(VC_CONTROL_REGISTER, 0x00, 0x00);  // VC(Virtual ChannelID) Control Register
-    SendCmd(PLL_CONTROL_REGISTER, 0x00, 0x00);  // 1=PLL disable
-    SendCmd(PLL_CONFIGURATION_REGISTER, 0x2D, 0x82);  // NS=1, PLL00=62.5-125, MS=1
-    SendCmd(CLOCK_CONTROL_REGISTER, 0x07, 0x00);  // LP Clock Divider LP clock = 400MHz / LPD / 8 = 480 / 8/ 8 = 7MHz
-    SendCmd(PLL_CONTROL_REGISTER, 0x01, 0x00);  // 1=PLL disable
-    SendCmd(DELAY_ADJUSTMENT_REGISTER_1, 0x02, 0x23);  // p1: HS-Data-zero  p2: HS-Data- prepare  --> 8031 issue
-    delay(100);
-    
-    SendCmd(DELAY_ADJUSTMENT_REGISTER_2, 0x01, 0x23);  // CLK Prepare, Clk Zero
-    SendCmd(DELAY_ADJUSTMENT_REGISTER_3, 0x10, 0x05);  // local_write_reg(addr=0xCB,data=0x0510), Clk Post, Clk Per
-    SendCmd(DELAY_ADJUSTMENT_REGISTER_4, 0x05, 0x10);  // local_write_reg(addr=0xCC,data=0x100A), HS Trail, Clk Trail
-    SendCmd(LP_RX_TIMER_REGISTER_2, 0x00, 0x00);
-
-    /*
-      // RGB interface configuration
-      SendCmd(RGB_INTERFACE_CONTROL_REGISTER_1, 0x18, 0x02);  // HSPW 07, VSPW 05
-      SendCmd(RGB_INTERFACE_CONTROL_REGISTER_2, 0xA0, 0x0A);  // HBPD 0x64=100, VBPD 8
-      SendCmd(RGB_INTERFACE_CONTROL_REGISTER_3, 0xA0, 0x0C);  // HFPD 8, VFPD 10
-    */
-
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_1, LCD_HSPW, LCD_VSPW);  // HSA, VSA
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_2, LCD_HBPD, LCD_VBPD);  // HBP, VBP
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_3, LCD_HFPD, LCD_VFPD);  // HFP, VFP
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_4, 0x90, 0x01);  // Horizontal active period 400, 013F=319 02D0=72
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_5, 0x00, 0x05);  // Vertical active period 1280
-    SendCmd(RGB_INTERFACE_CONTROL_REGISTER_6, 0x0B, 0xC0);  // RGB CLK 16BPP=00 18BPP=01 / D7=0 D6=0 D5=0  D1-0=11 ®C 24bpp / D15=VS D14=HS D13=CLK D12-9=NC D8=0=Video with blanking packet. 00-F0
-    
-    // MIPI lane configuration
-    SendCmd(LANE_CONFIGURATION_REGISTER, 0x03, 0x00); //11=4LANE 10=3LANE 01=2LANE 00=1LANE
-    SendCmd(RGB_CONTROL_REGISTER, 0x01, 0x00);  // 05=BGR 04=RGB, D0=0=RGB 1:BGR D1=1=Most significant byte sent first
-    SendCmd(PULL_CONTROL_REGISTER_3, 0x58, 0x00);
-    SendCmd(CONFIGURATION_REGISTER, 0x4B, 0x02);
-    SPI_WriteCmd(0x2c);
+  uint8_t ms;
+
+  init_2828 = ssd2828Init;
+  while ((ms = Init_Step()))
+    delay(ms);
+}
+//-----------------------------------------------------------------------------
+void SSD2828::Boot_Begin(void)
+{
+  step_2828 = 0;
+}
+
+uint8_t SSD2828::Boot_Step(void)
+{
+  if (step_2828 == 0)
+  {
+    Pin_Init();
+    Reset_Line(0);
+    step_2828 = 1;
+    return SSD2828_RESET_LOW_MS;
+  }
+  if (step_2828 == 1)
+  {
+    Reset_Line(1);
+    init_2828 = ssd2828Init;
+    step_2828 = 2;
+    return SSD2828_RESET_WAIT_MS;
+  }
+  return Init_Step();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
-
@@ -1,7 +1,7 @@
 #ifndef __2828_H__
 #define __2828_H__
 
-#include <Arduino.h>
+#include "ER-TFTM0784-1.h"  // bus configuration, port types, RA8876_LinuxSpi
 #include <stdint.h>
 
 #define DEVICE_IDENTIFICATION_REGISTER 0xB0
@@ -78,27 +78,66 @@
 #define LCD_HFPD    160    //    20    // 130
 #define LCD_HSPW    24    //    24  // 10
 
+// 3-wire SPI clock, from spidev on Linux and bit-banged on Arduino.
+#define SSD2828_SPI_HZ  1000000
+
+// Reset pulse, and the wait after it before the first command.
+#define SSD2828_RESET_LOW_MS    30
+#define SSD2828_RESET_WAIT_MS   50
+
 class SSD2828 {
 public:
+#ifdef ARDUINO
     SSD2828(uint8_t sdi_pin, uint8_t sclk_pin, uint8_t cs_pin, uint8_t rst_pin);
+#else
+    // 'spidev' must take 9-bit words (D/C bit + 8 data bits).
+    SSD2828(const char *spidev, const char *gpiochip, unsigned rst_line);
+    RA8876_LinuxSpi &spi() { return spi_2828; }
+#endif
     void Reset(void);
     void Initial(void);
 
+    // Reset() then Initial() without their delay()s, for RA8876_Boot:
+    // after Boot_Begin(), each Boot_Step() sends what it can and returns
+    // the milliseconds to wait before the next one, 0 once done.
+    void Boot_Begin(void);
+    uint8_t Boot_Step(void);
+
 private:
+    void Pin_Init(void);
+    void Reset_Line(uint8_t level);
+    uint8_t Init_Step(void);
+    void SPI_3W_Word(uint16_t word);
     void SPI_3W_SET_Cmd(uint16_t Sdata);
     void SPI_3W_SET_PAs(uint16_t Sdata);
     uint8_t SPI_ReadData(void);
     void SPI_WriteData(uint8_t value);
     void SPI_WriteCmd(uint8_t value);
-    void SendCmd(uint8_t cmd, uint8_t data1, uint8_t data2);
-    void WriteDataPacket(uint16_t num, ...);
     void GP_COMMAD_PA(uint16_t num);
+    void Flush(void);
+
+    const uint8_t *init_2828;   // next Initial() table entry
+    uint8_t step_2828;          // Boot_Step(): 0, 1 reset, 2 table
+
+#ifdef ARDUINO
     void spi_delay(void);
+    void pinWrite(uint8_t sig, uint8_t level);
 
     uint8_t CS_2828;
     uint8_t RST_2828;
     uint8_t SDI_2828;
     uint8_t SCLK_2828;
+#ifdef portOutputRegister
+    RA8876_PortReg *out_2828[3];    // SDI, SCLK, CS
+    RA8876_PortMask mask_2828[3];
+#endif
+#else
+    const char *DEV_2828;
+    const char *CHIP_2828;
+    unsigned RST_2828;
+    RA8876_LinuxSpi spi_2828;
+    RA8876_LinuxGpio rst_2828;
+#endif
 };
 
 #endif
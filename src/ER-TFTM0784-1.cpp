@@ -19,500 +19,708 @@
 
 #include "ER-TFTM0784-1.h"
 
+#ifdef ARDUINO
 #include <SPI.h>    // Arduino SPI Library
+#endif
+
+// Bus statistics hooks, see RA8876_Stats.h. RA8876_WAIT() opens the
+// counters of a wait loop, RA8876_POLL() counts one pass.
+#ifdef RA8876_STATS
+#define RA8876_COUNT(call)      stats_8876.call
+#define RA8876_WAIT(which)      RA8876_StatsWait wait_8876(stats_8876, which)
+#define RA8876_POLL()           wait_8876.poll()
+#else
+#define RA8876_COUNT(call)
+#define RA8876_WAIT(which)
+#define RA8876_POLL()
+#endif
 
 //-----------------------------------------------------------------------------
-ER_TFTM0784::ER_TFTM0784(uint8_t rs_pin, uint8_t cs_pin, uint8_t wr_pin, uint8_t rd_pin, uint8_t next_pin, uint8_t d0_pin, uint8_t d1_pin, uint8_t d2_pin, uint8_t d3_pin, uint8_t d4_pin, uint8_t d5_pin, uint8_t d6_pin, uint8_t d7_pin, uint8_t d8_pin, uint8_t d9_pin, uint8_t d10_pin, uint8_t d11_pin, uint8_t d12_pin, uint8_t d13_pin, uint8_t d14_pin, uint8_t d15_pin, uint8_t rst_pin)
-{
-    RS_8876 = rs_pin;
-    CS_PAR_8876  = cs_pin;
-    WR_8876  = wr_pin;
-    RD_8876  = rd_pin;
-    NEXT_8876  = next_pin;
-    RST_8876  = rst_pin;
-    D0  = d0_pin;
-    D1  = d1_pin;
-    D2  = d2_pin;
-    D3  = d3_pin;
-    D4  = d4_pin;
-    D5  = d5_pin;
-    D6  = d6_pin;
-    D7  = d7_pin;
-    D8  = d8_pin;
-    D9  = d9_pin;
-    D10  = d10_pin;
-    D11  = d11_pin;
-    D12  = d12_pin;
-    D13  = d13_pin;
-    D14  = d14_pin;
-    D15  = d15_pin;
-    mode_8876 = 0;
-}
-
-ER_TFTM0784::ER_TFTM0784(uint32_t spi_speed, uint8_t sdi_pin, uint8_t sdo_pin, uint8_t sclk_pin, uint8_t cs_pin, uint8_t rst_pin)
-{
-    SPI_SPEED_8876 = spi_speed;
-    SDI_8876 = sdi_pin;
-    SDO_8876 = sdo_pin;
-    SCLK_8876 = sclk_pin;
-    CS_SER_8876 = cs_pin;
-    RST_8876 = rst_pin;
-    mode_8876 = 2;
-}
-
-inline void ER_TFTM0784::bus_delay()
-{
-    for (volatile uint32_t i = 0; i < 1000; i++);
-}
-
-// I'm leaving these crap functions up top
-// as a reminder to deserialize the parallel bus. ;)
-
-void ER_TFTM0784::dataBusSetDirection8(uint8_t dir)
-{
-    // 0: inputs, 1: outputs
-    if (dir)
+// Bus cycles. The transport does the actual work; with a fixed transport
+// these inline to straight-line code.
+
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_BatchBegin()
+{
+    bus_8876.batchBegin();
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_BatchEnd()
+{
+    bus_8876.batchEnd();
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_DataWrite(uint8_t data)
+{
+    if (list_8876)
     {
-        pinMode(D0, OUTPUT);
-        pinMode(D1, OUTPUT);
-        pinMode(D2, OUTPUT);
-        pinMode(D3, OUTPUT);
-        pinMode(D4, OUTPUT);
-        pinMode(D5, OUTPUT);
-        pinMode(D6, OUTPUT);
-        pinMode(D7, OUTPUT);
+        list_8876->write(data, shadowKeepMask(list_8876->selected()));
+        return;
     }
-    else
+#ifdef RA8876_SHADOW_REGISTERS
+    uint8_t keep = shadowKeepMask(reg_8876);
+    if (keep)
     {
-        pinMode(D0, INPUT);
-        pinMode(D1, INPUT);
-        pinMode(D2, INPUT);
-        pinMode(D3, INPUT);
-        pinMode(D4, INPUT);
-        pinMode(D5, INPUT);
-        pinMode(D6, INPUT);
-        pinMode(D7, INPUT);
-        digitalWrite(D0, 0);
-        digitalWrite(D1, 0);
-        digitalWrite(D2, 0);
-        digitalWrite(D3, 0);
-        digitalWrite(D4, 0);
-        digitalWrite(D5, 0);
-        digitalWrite(D6, 0);
-        digitalWrite(D7, 0);
-        
+        // Bits outside 'keep' are self-clearing triggers, always send them.
+        if ((shadow_valid_8876[reg_8876 >> 3] & (1 << (reg_8876 & 7))) &&
+            shadow_8876[reg_8876] == data && (data & ~keep) == 0)
+            return;
+        shadowSelect();
+        shadow_8876[reg_8876] = data & keep;
+        shadow_valid_8876[reg_8876 >> 3] |= 1 << (reg_8876 & 7);
     }
-    bus_delay();
+#endif
+    RA8876_COUNT(countWrite(1));
+    bus_8876.dataWrite(data);
 }
 
-void ER_TFTM0784::dataBusSetDirection16(uint8_t dir)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_DataWrite16(uint16_t data)
 {
-    // 0: inputs, 1: outputs
-    if (dir)
+    if (list_8876)
     {
-        pinMode(D0, OUTPUT);
-        pinMode(D1, OUTPUT);
-        pinMode(D2, OUTPUT);
-        pinMode(D3, OUTPUT);
-        pinMode(D4, OUTPUT);
-        pinMode(D5, OUTPUT);
-        pinMode(D6, OUTPUT);
-        pinMode(D7, OUTPUT);
-        pinMode(D8, OUTPUT);
-        pinMode(D9, OUTPUT);
-        pinMode(D10, OUTPUT);
-        pinMode(D11, OUTPUT);
-        pinMode(D12, OUTPUT);
-        pinMode(D13, OUTPUT);
-        pinMode(D14, OUTPUT);
-        pinMode(D15, OUTPUT);
+        list_8876->write16(data);
+        return;
     }
-    else
+#ifdef RA8876_SHADOW_REGISTERS
+    if (shadowKeepMask(reg_8876))
     {
-        pinMode(D0, INPUT);
-        pinMode(D1, INPUT);
-        pinMode(D2, INPUT);
-        pinMode(D3, INPUT);
-        pinMode(D4, INPUT);
-        pinMode(D5, INPUT);
-        pinMode(D6, INPUT);
-        pinMode(D7, INPUT);
-        pinMode(D8, INPUT);
-        pinMode(D9, INPUT);
-        pinMode(D10, INPUT);
-        pinMode(D11, INPUT);
-        pinMode(D12, INPUT);
-        pinMode(D13, INPUT);
-        pinMode(D14, INPUT);
-        pinMode(D15, INPUT);
-        digitalWrite(D0, 0);
-        digitalWrite(D1, 0);
-        digitalWrite(D2, 0);
-        digitalWrite(D3, 0);
-        digitalWrite(D4, 0);
-        digitalWrite(D5, 0);
-        digitalWrite(D6, 0);
-        digitalWrite(D7, 0);
-        digitalWrite(D8, 0);
-        digitalWrite(D9, 0);
-        digitalWrite(D10, 0);
-        digitalWrite(D11, 0);
-        digitalWrite(D12, 0);
-        digitalWrite(D13, 0);
-        digitalWrite(D14, 0);
-        digitalWrite(D15, 0);
+        shadowSelect();
+        shadow_valid_8876[reg_8876 >> 3] &= ~(1 << (reg_8876 & 7));
     }
-    bus_delay();
-    
-}
-
-uint8_t ER_TFTM0784::dataBusRead8()
-{
-    uint8_t res = 0;
-    res |= digitalRead(D7);
-    res <<= 1;
-    res |= digitalRead(D6);
-    res <<= 1;
-    res |= digitalRead(D5);
-    res <<= 1;
-    res |= digitalRead(D4);
-    res <<= 1;
-    res |= digitalRead(D3);
-    res <<= 1;
-    res |= digitalRead(D2);
-    res <<= 1;
-    res |= digitalRead(D1);
-    res <<= 1;
-    res |= digitalRead(D0);
-    return res;
-}
-
-uint16_t ER_TFTM0784::dataBusRead16()
-{
-    uint16_t res = 0;
-    res |= digitalRead(D15);
-    res <<= 1;
-    res |= digitalRead(D14);
-    res <<= 1;
-    res |= digitalRead(D13);
-    res <<= 1;
-    res |= digitalRead(D12);
-    res <<= 1;
-    res |= digitalRead(D11);
-    res <<= 1;
-    res |= digitalRead(D10);
-    res <<= 1;
-    res |= digitalRead(D9);
-    res <<= 1;
-    res |= digitalRead(D8);
-    res <<= 1;
-    res |= digitalRead(D7);
-    res <<= 1;
-    res |= digitalRead(D6);
-    res <<= 1;
-    res |= digitalRead(D5);
-    res <<= 1;
-    res |= digitalRead(D4);
-    res <<= 1;
-    res |= digitalRead(D3);
-    res <<= 1;
-    res |= digitalRead(D2);
-    res <<= 1;
-    res |= digitalRead(D1);
-    res <<= 1;
-    res |= digitalRead(D0);
-    
-    return res;
-}
-
-void ER_TFTM0784::dataBusWrite8(uint8_t x)
-{
-    
-    digitalWrite(D0, x & 1);
-    x >>= 1;
-    digitalWrite(D1, x & 1);
-    x >>= 1;
-    digitalWrite(D2, x & 1);
-    x >>= 1;
-    digitalWrite(D3, x & 1);
-    x >>= 1;
-    digitalWrite(D4, x & 1);
-    x >>= 1;
-    digitalWrite(D5, x & 1);
-    x >>= 1;
-    digitalWrite(D6, x & 1);
-    x >>= 1;
-    digitalWrite(D7, x & 1);
-}
-
-void ER_TFTM0784::dataBusWrite16(uint16_t x)
-{
-    digitalWrite(D0, x & 1);
-    x >>= 1;
-    digitalWrite(D1, x & 1);
-    x >>= 1;
-    digitalWrite(D2, x & 1);
-    x >>= 1;
-    digitalWrite(D3, x & 1);
-    x >>= 1;
-    digitalWrite(D4, x & 1);
-    x >>= 1;
-    digitalWrite(D5, x & 1);
-    x >>= 1;
-    digitalWrite(D6, x & 1);
-    x >>= 1;
-    digitalWrite(D7, x & 1);
-    x >>= 1;
-    digitalWrite(D8, x & 1);
-    x >>= 1;
-    digitalWrite(D9, x & 1);
-    x >>= 1;
-    digitalWrite(D10, x & 1);
-    x >>= 1;
-    digitalWrite(D11, x & 1);
-    x >>= 1;
-    digitalWrite(D12, x & 1);
-    x >>= 1;
-    digitalWrite(D13, x & 1);
-    x >>= 1;
-    digitalWrite(D14, x & 1);
-    x >>= 1;
-    digitalWrite(D15, x & 1);
-}
-
-// b7 = a0: 0:cmd/status 1:data
-// b6 = /wr 0:write 1:read
-
-#define RA8876_SPI_CMDWRITE    0x00
-#define RA8876_SPI_DATAWRITE   0x80
-#define RA8876_SPI_DATAREAD    0xc0
-#define RA8876_SPI_STATUSREAD  0x40
-
-inline __attribute__((always_inline))
-void ER_TFTM0784::startSend()
-{
-    if (mode_8876 == 2)
+#endif
+    RA8876_COUNT(countWrite(2));
+    bus_8876.dataWrite16(data);
+}
+
+template<class Bus>
+uint16_t RA8876_Driver<Bus>::LCD_DataRead()
+{
+    if (list_8876)
+        return listRead(list_8876->selected(), false);
+#ifdef RA8876_SHADOW_REGISTERS
+    uint8_t keep = shadowKeepMask(reg_8876);
+    if (keep)
     {
-        SPI.beginTransaction(SPISettings(SPI_SPEED_8876, MSBFIRST, SPI_MODE0));
-        pinMode(CS_SER_8876, OUTPUT);
-        digitalWrite(CS_SER_8876, LOW);
-    } else
+        if (shadow_valid_8876[reg_8876 >> 3] & (1 << (reg_8876 & 7)))
+            return shadow_8876[reg_8876];
+        shadowSelect();
+        RA8876_COUNT(countRead());
+        uint8_t data = bus_8876.dataRead() & keep;
+        shadow_8876[reg_8876] = data;
+        shadow_valid_8876[reg_8876 >> 3] |= 1 << (reg_8876 & 7);
+        return data;
+    }
+#endif
+    RA8876_COUNT(countRead());
+    return bus_8876.dataRead();
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_CmdWrite(uint8_t Cmd)
+{
+    if (engine_8876 != RA8876_ENGINE_IDLE && engineDepends(Cmd))
+        fence();
+    if (list_8876)
     {
-        
+        list_8876->select(Cmd);
+        return;
     }
+#ifdef RA8876_SHADOW_REGISTERS
+    reg_8876 = Cmd;
+    if (shadowKeepMask(Cmd))
+        return;     // addressed by shadowSelect() once a data cycle needs it
+    latch_8876 = Cmd;
+#endif
+    RA8876_COUNT(countCmd());
+    bus_8876.cmdWrite(Cmd);
 }
 
-inline __attribute__((always_inline))
-void ER_TFTM0784::endSend()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>:: LCD_StatusRead()
+{
+    if (list_8876)
+        return 0x44;    // while recording: FIFO empty, SDRAM ready, idle
+    RA8876_COUNT(countStatus());
+    return bus_8876.statusRead();
+}
+
+//==============================================================================
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_RegisterWrite(uint8_t cmd, uint8_t data)
 {
-    if (mode_8876 == 2)
+    LCD_CmdWrite(cmd);
+    LCD_DataWrite(data);
+}
+
+// Write a list of {register, value} pairs in a single SPI transaction.
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_RegisterWriteList(const uint8_t (*pairs)[2], uint8_t count)
+{
+    LCD_BatchBegin();
+    for (uint8_t i = 0; i < count; i++)
     {
-        digitalWrite(CS_SER_8876, HIGH);
-        SPI.endTransaction();
-    } else
+        LCD_CmdWrite(pairs[i][0]);
+        LCD_DataWrite(pairs[i][1]);
+    }
+    LCD_BatchEnd();
+}
+
+// The same from a PROGMEM table.
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_RegisterWriteList_P(const uint8_t (*pairs)[2], uint8_t count)
+{
+    LCD_BatchBegin();
+    for (uint8_t i = 0; i < count; i++)
     {
-        
+        LCD_CmdWrite(pgm_read_byte(&pairs[i][0]));
+        LCD_DataWrite(pgm_read_byte(&pairs[i][1]));
     }
+    LCD_BatchEnd();
 }
 
-void ER_TFTM0784::LCD_DataWrite(uint8_t data)
+// [reg] = value[7:0], [reg+1] = value[15:8]
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_RegisterWrite16(uint8_t reg, uint16_t value)
 {
-    if (mode_8876 == 2)
+    const uint8_t regs[2][2] =
     {
-        // b0 = 0b10000000
-        // b1   reg_dat / mem_dat
-        startSend();
-        SPI.transfer(RA8876_SPI_DATAWRITE);
-        SPI.transfer(data);
-        endSend();
-    } else
+        {reg,                      (uint8_t)value},
+        {(uint8_t)(reg + 1),       (uint8_t)(value >> 8)},
+    };
+    LCD_RegisterWriteList(regs, 2);
+}
+
+// [reg] .. [reg+3] = value[7:0] .. value[31:24]
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_RegisterWrite32(uint8_t reg, uint32_t value)
+{
+    const uint8_t regs[4][2] =
     {
-        digitalWrite(RD_8876, 1);
-        digitalWrite(RS_8876, 1);
-        bus_delay();
-        digitalWrite(CS_PAR_8876, 0);
-        bus_delay();
-        dataBusSetDirection8(1);
-        dataBusWrite8(data);
-        digitalWrite(WR_8876, 0);
-        bus_delay();
-        digitalWrite(WR_8876, 1);
-        bus_delay();
-        digitalWrite(CS_PAR_8876, 1);
-        digitalWrite(RS_8876, 0);
-        dataBusSetDirection16(0);
-    }
+        {reg,                      (uint8_t)value},
+        {(uint8_t)(reg + 1),       (uint8_t)(value >> 8)},
+        {(uint8_t)(reg + 2),       (uint8_t)(value >> 16)},
+        {(uint8_t)(reg + 3),       (uint8_t)(value >> 24)},
+    };
+    LCD_RegisterWriteList(regs, 4);
 }
 
-void ER_TFTM0784::LCD_DataWrite16(uint16_t data)
+// [reg] .. [reg+3] = X[7:0], X[12:8], Y[7:0], Y[12:8]
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_RegisterWriteXY(uint8_t reg, uint16_t WX, uint16_t HY)
 {
-    if (mode_8876 == 2)
+    const uint8_t regs[4][2] =
     {
-        // b0 = 0b10000000
-        // b1   reg_dat / mem_dat
-        startSend();
-        SPI.transfer(RA8876_SPI_DATAWRITE);
-        SPI.transfer(data & 0xFF); // LSB first!!!
-        SPI.transfer(data>>8);
-        //SPI.transfer16(data);
-        endSend();
-    } else
+        {reg,                      (uint8_t)WX},
+        {(uint8_t)(reg + 1),       (uint8_t)(WX >> 8)},
+        {(uint8_t)(reg + 2),       (uint8_t)HY},
+        {(uint8_t)(reg + 3),       (uint8_t)(HY >> 8)},
+    };
+    LCD_RegisterWriteList(regs, 4);
+}
+
+template<class Bus>
+uint8_t RA8876_Driver<Bus>:: LCD_RegisterRead(uint8_t cmd)
+{
+    uint8_t temp;
+    LCD_CmdWrite(cmd);
+    temp = LCD_DataRead();
+    return temp;
+}
+
+// Always read the register from the RA8876, bypassing the shadow copy.
+// Use this to poll busy/start bits such as [90h] b4 or [B6h] b0.
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::LCD_RegisterReadDirect(uint8_t cmd)
+{
+    if (list_8876)
+        return listRead(cmd, true);
+    LCD_CmdWrite(cmd);
+#ifdef RA8876_SHADOW_REGISTERS
+    shadowSelect();
+#endif
+    RA8876_COUNT(countRead());
+    return bus_8876.dataRead();
+}
+
+// Forget all shadowed register values, e.g. after the RA8876 was reset
+// or reprogrammed behind the driver's back.
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_ShadowInvalidate()
+{
+    bteOp_8876 = RA8876_BTE_OP_UNKNOWN;
+#ifdef RA8876_SHADOW_REGISTERS
+    memset(shadow_valid_8876, 0, sizeof(shadow_valid_8876));
+    latch_8876 = 0x100;
+#endif
+}
+
+//==============================================================================
+// Display lists, see RA8876_List.h. While recording, the bus cycle functions
+// above hand writes to list_8876, status reads report an idle display, and
+// the Check_ functions record a wait instead of polling. engine_8876 then
+// follows the recorded operations, not the display, which stays idle.
+
+template<class Bus>
+void RA8876_Driver<Bus>::List_Record(RA8876_ListRecorder *rec)
+{
+    if (list_8876)
     {
-        digitalWrite(RD_8876, 1);
-        digitalWrite(RS_8876, 1);
-        bus_delay();
-        digitalWrite(CS_PAR_8876, 0);
-        bus_delay();
-        dataBusSetDirection16(1);
-        dataBusWrite16(data);
-        digitalWrite(WR_8876, 0);
-        bus_delay();
-        digitalWrite(WR_8876, 1);
-        bus_delay();
-        digitalWrite(CS_PAR_8876, 1);
-        digitalWrite(RS_8876, 0);
-        dataBusSetDirection16(0);
+        if (engine_8876 != RA8876_ENGINE_IDLE)
+            list_8876->running(engine_8876);
+        engine_8876 = RA8876_ENGINE_IDLE;
+        list_8876 = NULL;
+        bteOp_8876 = RA8876_BTE_OP_UNKNOWN;     // the recorded one, not the display's
     }
+    if (rec)
+    {
+        fence();
+        rec->begin();
+        list_8876 = rec;
+    }
+}
+
+// A register read while recording: the value the list gave it, else the
+// display's own.
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::listRead(uint8_t reg, bool direct)
+{
+    RA8876_ListRecorder *list = list_8876;
+    uint8_t engine = engine_8876;
+    uint8_t data;
+
+    if (!direct && list->read(reg, &data))
+        return data;
+    list_8876 = NULL;
+    engine_8876 = RA8876_ENGINE_IDLE;
+    data = direct ? LCD_RegisterReadDirect(reg) : LCD_RegisterRead(reg);
+    engine_8876 = engine;
+    list_8876 = list;
+    return data;
 }
 
-uint16_t ER_TFTM0784::LCD_DataRead()
+// Register writes go straight to the bus; the waits recorded in the list
+// stand in for the engine checks LCD_CmdWrite() would make. Played while
+// recording, the list is recorded like any other drawing.
+template<class Bus>
+template<class Get>
+void RA8876_Driver<Bus>::listPlay(const uint8_t *list, uint16_t len, uint32_t canvas, Get get)
 {
-    uint16_t data = 0;
-    if (mode_8876 == 2)
+    const uint8_t *end = list + len;
+    bool retarget = canvas != RA8876_LIST_SAME_CANVAS;
+
+    fence();
+    if (retarget)
+        Canvas_Image_Start_address(canvas);
+    LCD_BatchBegin();
+    while (list < end)
     {
-        // b0=0b11000000
-        // b1 reg dat/mem dat
-        startSend();
-        SPI.transfer(RA8876_SPI_DATAREAD);
-        data = SPI.transfer(0xff);
-        //data|=SPI.transfer(0xff);
-        endSend();
-    } else
+        uint8_t op = get(list++);
+        if (op < RA8876_LIST_WAIT)
+        {
+            uint8_t reg = get(list++);
+            for (; op; op--, reg++)
+            {
+                uint8_t data = get(list++);
+                if (retarget && reg >= 0x50 && reg <= 0x53)
+                    continue;       // canvas start address
+                if (reg == 0x91)
+                    bteOp_8876 = data & 0x0F;
+                if (list_8876)
+                {
+                    LCD_RegisterWrite(reg, data);
+                    continue;
+                }
+#ifdef RA8876_SHADOW_REGISTERS
+                uint8_t keep = shadowKeepMask(reg);
+                if (keep)
+                {
+                    shadow_8876[reg] = data & keep;
+                    shadow_valid_8876[reg >> 3] |= 1 << (reg & 7);
+                }
+                latch_8876 = reg;
+#endif
+                RA8876_COUNT(countCmd());
+                RA8876_COUNT(countWrite(1));
+                bus_8876.cmdWrite(reg);
+                bus_8876.dataWrite(data);
+            }
+        }
+        else if (op == RA8876_LIST_PORT || op == RA8876_LIST_PORT16)
+        {
+            uint8_t n = get(list++);
+            LCD_CmdWrite(0x04);
+            Mem_WR_FIFO_Reset();
+            for (; n; n--)
+            {
+                Mem_WR_FIFO_Reserve();
+                if (op == RA8876_LIST_PORT16)
+                {
+                    LCD_DataWrite16(get(list) | get(list + 1) << 8);
+                    list += 2;
+                }
+                else
+                    LCD_DataWrite(get(list++));
+            }
+        }
+        else
+        {
+            engine_8876 = op & 0x07;
+            if ((op & 0xF8) == RA8876_LIST_WAIT)
+                fence();
+        }
+    }
+    LCD_BatchEnd();
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::List_Play(const uint8_t *list, uint16_t len, uint32_t canvas)
+{
+    listPlay(list, len, canvas, [](const uint8_t *p) { return *p; });
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::List_Play_P(const uint8_t *list, uint16_t len, uint32_t canvas)
+{
+    listPlay(list, len, canvas, [](const uint8_t *p) { return (uint8_t)pgm_read_byte(p); });
+}
+
+//==============================================================================
+// SPI clock calibration. Test data goes to the BTE source 1 start address
+// [9Dh]..[A0h], which nothing uses while BTE is idle, and to
+// RA8876_SPI_CAL_BYTES of SDRAM at RA8876_SPI_CAL_ADDR through the memory
+// port in linear mode. The bus is driven directly so the shadow copy is not
+// disturbed; registers touched are saved first and put back after.
+
+// Clocks tried, fastest first. The SPI core rounds each down to what its
+// divider can make.
+static const uint32_t spiCalSteps[] PROGMEM =
+{
+    80000000, 60000000, 50000000, 42000000, 36000000, 30000000, 24000000,
+    20000000, 16000000, 12000000, 8000000, 4000000, 2000000, RA8876_SPI_SAFE_HZ
+};
+#define SPI_CAL_STEPS   ((uint8_t)(sizeof(spiCalSteps) / sizeof(spiCalSteps[0])))
+
+// Registers saved around calibration: memory select, memory mode,
+// cursor / linear address and the scratch registers.
+static const uint8_t spiCalRegs[10] = {0x03, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x9D, 0x9E, 0x9F, 0xA0};
+#define SPI_CAL_SCRATCH 6   // spiCalRegs[6..9] hold test data
+
+// Byte 'i' of test pattern 'seed': bit toggling patterns first, then
+// pseudo random data.
+static uint8_t spiCalByte(uint8_t seed, uint16_t i)
+{
+    static const uint8_t fixed[4] = {0x00, 0xFF, 0x55, 0xAA};
+    if (seed < 4)
+        return (i & 1) ? ~fixed[seed] : fixed[seed];
+    uint16_t x = (uint16_t)(seed * 251u + i) * 40503u;
+    return (uint8_t)(x >> 8) ^ (uint8_t)x;
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::spiCalSave(uint8_t *save)
+{
+    for (uint8_t i = 0; i < sizeof(spiCalRegs); i++)
     {
-        digitalWrite(WR_8876, 1);
-        digitalWrite(CS_PAR_8876, 0);
-        digitalWrite(RS_8876, 1);
-        digitalWrite(RD_8876, 0);
-        bus_delay();
-        data = dataBusRead16();
-        digitalWrite(RD_8876, 1);
-        digitalWrite(CS_PAR_8876, 1);
-        digitalWrite(RS_8876, 0);
+        bus_8876.cmdWrite(spiCalRegs[i]);
+        save[i] = bus_8876.dataRead();
     }
-    return data;
-    
 }
 
-void ER_TFTM0784::LCD_CmdWrite(uint8_t Cmd)
+template<class Bus>
+void RA8876_Driver<Bus>::spiCalRestore(const uint8_t *save)
 {
-    if (mode_8876 == 2)
+    for (uint8_t i = 0; i < sizeof(spiCalRegs); i++)
     {
-        // b0=0b00000000
-        // b1 reg_num
-        startSend();
-        SPI.transfer(RA8876_SPI_CMDWRITE);
-        SPI.transfer(Cmd);
-        endSend();
-    } else
+        bus_8876.cmdWrite(spiCalRegs[i]);
+        bus_8876.dataWrite(save[i]);
+    }
+    LCD_ShadowInvalidate();
+}
+
+// Scratch register bits that actually store what is written.
+template<class Bus>
+void RA8876_Driver<Bus>::spiCalMask(uint8_t *mask)
+{
+    for (uint8_t i = 0; i < 4; i++)
     {
-        digitalWrite(RD_8876, 1);
-        digitalWrite(RS_8876, 0);
-        digitalWrite(CS_PAR_8876, 0);
-        bus_delay();
-        dataBusSetDirection16(1);
-        dataBusWrite16(Cmd);
-        bus_delay();
-        digitalWrite(WR_8876, 0);
-        bus_delay();
-        digitalWrite(WR_8876, 1);
-        bus_delay();
-        digitalWrite(CS_PAR_8876, 1);
-        digitalWrite(RS_8876, 1);
-        dataBusSetDirection16(0);
+        bus_8876.cmdWrite(spiCalRegs[SPI_CAL_SCRATCH + i]);
+        bus_8876.dataWrite(0xFF);
+        mask[i] = bus_8876.dataRead();
+        bus_8876.dataWrite(0x00);
+        mask[i] &= ~bus_8876.dataRead();
     }
-    
 }
 
-uint8_t ER_TFTM0784:: LCD_StatusRead()
+// Write pattern 'seed' at the current write clock.
+template<class Bus>
+void RA8876_Driver<Bus>::spiCalFill(uint8_t seed)
 {
-    uint8_t data = 0;
-    if (mode_8876 == 2)
+    uint16_t i;
+
+    for (i = 0; i < 4; i++)
     {
-        // b0=0b01000000
-        startSend();
-        SPI.transfer(RA8876_SPI_STATUSREAD);
-        data = SPI.transfer(0xff);
-        endSend();
-    } else
+        bus_8876.cmdWrite(spiCalRegs[SPI_CAL_SCRATCH + i]);
+        bus_8876.dataWrite(spiCalByte(seed, i));
+    }
+    for (i = 0; i < 4; i++)
     {
-        digitalWrite(RS_8876, 0);
-        digitalWrite(WR_8876, 1);
-        digitalWrite(RD_8876, 0);
-        bus_delay();
-        digitalWrite(CS_PAR_8876, 0);
-        data = dataBusRead8();
-        digitalWrite(RD_8876, 1);
-        digitalWrite(CS_PAR_8876, 1);
-        digitalWrite(RS_8876, 1);
+        bus_8876.cmdWrite(0x5F + i);
+        bus_8876.dataWrite((uint8_t)(RA8876_SPI_CAL_ADDR >> (8 * i)));
     }
-    return data;
+    bus_8876.cmdWrite(0x04);
+    bus_8876.burstBegin();
+    for (i = 0; i < RA8876_SPI_CAL_BYTES; i++)
+        bus_8876.burstWrite8(spiCalByte(seed, i + 4));
+    bus_8876.burstEnd();
+    for (i = 0; i < 1000 && !(bus_8876.statusRead() & 0x40); i++);
 }
 
-//==============================================================================
-void ER_TFTM0784::LCD_RegisterWrite(uint8_t cmd, uint8_t data)
+// Read pattern 'seed' back at the current read clock, return miscompares.
+template<class Bus>
+uint16_t RA8876_Driver<Bus>::spiCalCheck(uint8_t seed, const uint8_t *mask, bool sdram)
 {
-    LCD_CmdWrite(cmd);
-    LCD_DataWrite(data);
+    uint16_t i, tries, errors = 0;
+
+    for (i = 0; i < 4; i++)
+    {
+        bus_8876.cmdWrite(spiCalRegs[SPI_CAL_SCRATCH + i]);
+        if ((bus_8876.dataRead() ^ spiCalByte(seed, i)) & mask[i])
+            errors++;
+    }
+    if (!sdram)
+        return errors;
+    for (i = 0; i < 4; i++)
+    {
+        bus_8876.cmdWrite(0x5F + i);
+        bus_8876.dataWrite((uint8_t)(RA8876_SPI_CAL_ADDR >> (8 * i)));
+    }
+    bus_8876.cmdWrite(0x04);
+    bus_8876.dataRead();    // dummy read
+    for (i = 0; i < RA8876_SPI_CAL_BYTES; i++)
+    {
+        for (tries = 0; tries < 1000 && (bus_8876.statusRead() & 0x10); tries++);
+        if ((uint8_t)bus_8876.dataRead() != spiCalByte(seed, i + 4))
+            errors++;
+    }
+    return errors;
 }
 
-uint8_t ER_TFTM0784:: LCD_RegisterRead(uint8_t cmd)
+// Walk down spiCalSteps from max_hz and return the index of the first clock
+// that passes every pattern, or SPI_CAL_STEPS if even the safe clock fails.
+// For reads the data is written at the safe clock; for writes it is read
+// back at the read clock already set. '*errors' gets the miscompares of the
+// last failing step.
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::spiCalSearch(uint32_t max_hz, bool read, const uint8_t *mask, uint16_t *errors)
 {
-    uint8_t temp;
-    LCD_CmdWrite(cmd);
-    temp = LCD_DataRead();
-    return temp;
+    uint32_t read_hz = bus_8876.readSpeed();
+    uint16_t e;
+    uint8_t step, seed;
+
+    *errors = 0;
+    for (step = 0; step < SPI_CAL_STEPS; step++)
+    {
+        uint32_t hz = pgm_read_dword(&spiCalSteps[step]);
+        if (hz > max_hz && hz != RA8876_SPI_SAFE_HZ)
+            continue;
+        e = 0;
+        for (seed = 0; seed < RA8876_SPI_CAL_PASSES; seed++)
+        {
+            bus_8876.setSpeed(read ? RA8876_SPI_SAFE_HZ : hz, read ? RA8876_SPI_SAFE_HZ : read_hz);
+            spiCalFill(seed);
+            bus_8876.setSpeed(RA8876_SPI_SAFE_HZ, read ? hz : read_hz);
+            e += spiCalCheck(seed, mask, true);
+        }
+        if (e == 0)
+            return step;
+        *errors = e;
+    }
+    return SPI_CAL_STEPS;
 }
 
-void ER_TFTM0784::LCD_WriteRAM_Prepare()
+template<class Bus>
+RA8876_SpiCal RA8876_Driver<Bus>::LCD_SpiCalibrate(uint32_t max_hz)
 {
-    LCD_CmdWrite(0x04); //
+    RA8876_SpiCal cal;
+    uint8_t save[sizeof(spiCalRegs)], mask[4];
+    uint32_t old_write = bus_8876.writeSpeed();
+    uint32_t old_read = bus_8876.readSpeed();
+    uint8_t r, w;
+
+    memset(&cal, 0, sizeof(cal));
+    if (bus_8876.mode() != 2)
+        return cal;
+
+    fence();
+    bus_8876.setSpeed(RA8876_SPI_SAFE_HZ, RA8876_SPI_SAFE_HZ);
+    spiCalSave(save);
+    spiCalMask(mask);
+    bus_8876.cmdWrite(0x03);                    // memory port to SDRAM
+    bus_8876.dataWrite(save[0] & cClrb1 & cClrb0);
+    bus_8876.cmdWrite(0x5E);                    // linear addressing
+    bus_8876.dataWrite(save[1] | cSetb2);
+
+    r = spiCalSearch(max_hz, true, mask, &cal.read_errors);
+    if (r < SPI_CAL_STEPS)
+    {
+        cal.read_max_hz = pgm_read_dword(&spiCalSteps[r]);
+        if (cal.read_errors && r + 1 < SPI_CAL_STEPS)
+            r++;
+        cal.read_hz = pgm_read_dword(&spiCalSteps[r]);
+
+        bus_8876.setSpeed(RA8876_SPI_SAFE_HZ, cal.read_hz);
+        w = spiCalSearch(max_hz, false, mask, &cal.write_errors);
+        if (w < SPI_CAL_STEPS)
+        {
+            cal.write_max_hz = pgm_read_dword(&spiCalSteps[w]);
+            if (cal.write_errors && w + 1 < SPI_CAL_STEPS)
+                w++;
+            cal.write_hz = pgm_read_dword(&spiCalSteps[w]);
+            cal.magic = RA8876_SPI_CAL_MAGIC;
+        }
+    }
+
+    bus_8876.setSpeed(RA8876_SPI_SAFE_HZ, RA8876_SPI_SAFE_HZ);
+    spiCalRestore(save);
+    if (cal.magic == RA8876_SPI_CAL_MAGIC)
+        bus_8876.setSpeed(cal.write_hz, cal.read_hz);
+    else
+        bus_8876.setSpeed(old_write, old_read);
+    return cal;
+}
+
+// Use a stored calibration result. A quick register pattern check at the
+// stored clocks guards against changed wiring; returns false (and keeps the
+// current clocks) if it fails, the caller should calibrate again.
+template<class Bus>
+bool RA8876_Driver<Bus>::LCD_SpiRestore(const RA8876_SpiCal &cal)
+{
+    uint8_t save[sizeof(spiCalRegs)], mask[4], seed;
+    uint32_t old_write = bus_8876.writeSpeed();
+    uint32_t old_read = bus_8876.readSpeed();
+    uint16_t errors = 0;
+
+    if (bus_8876.mode() != 2 || cal.magic != RA8876_SPI_CAL_MAGIC ||
+        cal.write_hz == 0 || cal.read_hz == 0)
+        return false;
+
+    fence();
+    bus_8876.setSpeed(RA8876_SPI_SAFE_HZ, RA8876_SPI_SAFE_HZ);
+    spiCalSave(save);
+    spiCalMask(mask);
+    for (seed = 0; seed < 4; seed++)
+    {
+        bus_8876.setSpeed(cal.write_hz, cal.read_hz);
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            bus_8876.cmdWrite(spiCalRegs[SPI_CAL_SCRATCH + i]);
+            bus_8876.dataWrite(spiCalByte(seed, i));
+        }
+        errors += spiCalCheck(seed, mask, false);
+    }
+    bus_8876.setSpeed(RA8876_SPI_SAFE_HZ, RA8876_SPI_SAFE_HZ);
+    spiCalRestore(save);
+    if (errors)
+    {
+        bus_8876.setSpeed(old_write, old_read);
+        return false;
+    }
+    bus_8876.setSpeed(cal.write_hz, cal.read_hz);
+    return true;
 }
 
-void ER_TFTM0784::RA8876_IO_Init()
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_SpiCalReport(Print &out, const RA8876_SpiCal &cal)
 {
-    if (mode_8876 == 2) {
-        digitalWrite(RST_8876, 1);
-        pinMode(RST_8876, OUTPUT);
-        digitalWrite(CS_SER_8876, 1);
-        pinMode(CS_SER_8876, OUTPUT);
-        SPI.begin();
+    if (cal.magic != RA8876_SPI_CAL_MAGIC)
+    {
+        out.println("RA8876: SPI calibration failed");
+        return;
     }
-    else {
-        digitalWrite(RST_8876, 1);
-        pinMode(RST_8876, OUTPUT);
-        digitalWrite(CS_PAR_8876, 1);
-        digitalWrite(WR_8876, 1);
-        pinMode(RS_8876, OUTPUT);
-        pinMode(CS_PAR_8876, OUTPUT);
-        pinMode(RD_8876, OUTPUT);
-        pinMode(WR_8876, OUTPUT);
-        
-        if (mode_8876 == 0) // 16 bit mode
-            dataBusSetDirection16(0); // make databus inputs
-        else   // 8 bit mode
-            dataBusSetDirection8(0);
+    out.print("RA8876: SPI write ");
+    out.print(cal.write_hz);
+    out.print(" Hz, passes up to ");
+    out.print(cal.write_max_hz);
+    out.print(" Hz, ");
+    out.print(cal.write_errors);
+    out.println(" errors one step above");
+    out.print("RA8876: SPI read  ");
+    out.print(cal.read_hz);
+    out.print(" Hz, passes up to ");
+    out.print(cal.read_max_hz);
+    out.print(" Hz, ");
+    out.print(cal.read_errors);
+    out.println(" errors one step above");
+}
+
+// Bits of 'reg' that may be served from the shadow copy, or left out of a
+// display list when written unchanged. 0 means the register is never
+// cached: memory port, status/flag and FIFO registers, cursors that move
+// while drawing, live counters and busy bits.
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::shadowKeepMask(uint8_t reg)
+{
+    if (reg <= 0x01)                    // SRR, CCR (PLL reconfigure status)
+        return 0x00;
+    if (reg == 0x04 || reg == 0x0C)     // MRWDP, INTF
+        return 0x00;
+    if (reg >= 0x5F && reg <= 0x67)     // memory/text cursor, DCR0 busy
+        return 0x00;
+    if (reg == 0x76)                    // DCR1 busy
+        return 0x00;
+    if (reg == 0x86 || reg == 0x8A || reg == 0x8B || reg == 0x8E || reg == 0x8F) // PWM control, timer counters
+        return 0x00;
+    if (reg == 0x90)                    // BTE enable, clears itself when done
+        return (uint8_t)~cSetb4;
+    if (reg == 0xB6)                    // DMA start, clears itself when done
+        return (uint8_t)~cSetb0;
+    if (reg == 0xB8 || reg == 0xBA)     // SPI master data/status
+        return 0x00;
+    if (reg == 0xDF || reg == 0xE4)     // power saving, SDRAM init
+        return 0x00;
+    if (reg >= 0xE7)                    // I2C master, GPIO, key scan
+        return 0x00;
+    return 0xFF;
+}
+
+#ifdef RA8876_SHADOW_REGISTERS
+// Point the RA8876 address latch at the register selected by the last
+// LCD_CmdWrite(), skipping the command cycle if it already does.
+template<class Bus>
+void RA8876_Driver<Bus>::shadowSelect()
+{
+    if (latch_8876 != reg_8876)
+    {
+        latch_8876 = reg_8876;
+        RA8876_COUNT(countCmd());
+        bus_8876.cmdWrite(reg_8876);
     }
 }
+#endif
 
-void ER_TFTM0784::RA8876_HW_Reset()
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_WriteRAM_Prepare()
+{
+    LCD_CmdWrite(0x04); //
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_IO_Init()
+{
+    bus_8876.begin();
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_HW_Reset()
 {
     //Serial.print("RA8876: Reset...");
-    pinMode(RST_8876, OUTPUT);
-    digitalWrite(RST_8876, 1);
-    delay(1);
-    digitalWrite(RST_8876, 0);
-    delay(1);
-    digitalWrite(RST_8876, 1);
+    bus_8876.hwReset();
+    bus_8876.setCoreClock(OSC_FREQ);
+    LCD_ShadowInvalidate();
+    engine_8876 = RA8876_ENGINE_IDLE;
     //delay(50);
     //uint32_t a = millis();
     while (LCD_StatusRead() & 0x02); //Initial_Display_test and  set SW2 pin2 = 1
@@ -525,14 +733,16 @@ void ER_TFTM0784::RA8876_HW_Reset()
 }
 
 
-void ER_TFTM0784::LCD_SetPoint(uint16_t x, uint16_t y, uint16_t point)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_SetPoint(uint16_t x, uint16_t y, uint16_t point)
 {
     LCD_SetCursor(x, y);
     LCD_WriteRAM_Prepare();
     LCD_DataWrite16(point);
 }
 
-void ER_TFTM0784::LCD_PutChar(uint16_t x, uint16_t y, uint8_t c, uint16_t charColor, uint16_t bkColor)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_PutChar(uint16_t x, uint16_t y, uint8_t c, uint16_t charColor, uint16_t bkColor)
 {
     uint16_t i = 0;
     uint16_t j = 0;
@@ -558,7 +768,8 @@ void ER_TFTM0784::LCD_PutChar(uint16_t x, uint16_t y, uint8_t c, uint16_t charCo
 }
 
 
-void ER_TFTM0784::LCD_DisplayString(uint16_t X, uint16_t Y, char *ptr, uint16_t charColor, uint16_t bkColor)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_DisplayString(uint16_t X, uint16_t Y, char *ptr, uint16_t charColor, uint16_t bkColor)
 {
     uint32_t i = 0;
     
@@ -577,19 +788,14 @@ void ER_TFTM0784::LCD_DisplayString(uint16_t X, uint16_t Y, char *ptr, uint16_t
     
 }
 
-void ER_TFTM0784::LCD_SetCursor(uint16_t Xpos, uint16_t Ypos)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_SetCursor(uint16_t Xpos, uint16_t Ypos)
 {
-    LCD_CmdWrite(0x5F);
-    LCD_DataWrite(Xpos);
-    LCD_CmdWrite(0x60);
-    LCD_DataWrite(Xpos >> 8);
-    LCD_CmdWrite(0x61);
-    LCD_DataWrite(Ypos);
-    LCD_CmdWrite(0x62);
-    LCD_DataWrite(Ypos >> 8);
+    LCD_RegisterWriteXY(0x5F, Xpos, Ypos);
 }
 
-void ER_TFTM0784::LCD_Clear(uint16_t Color)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_Clear(uint16_t Color)
 {
     uint32_t index = 0;
     LCD_SetCursor(0, 0);
@@ -601,216 +807,193 @@ void ER_TFTM0784::LCD_Clear(uint16_t Color)
     // while(1);
 }
 
-void ER_TFTM0784::RA8876_initial()
-{
-    //Serial.println("  SW Reset");
+// Everything RA8876_initial() sets after the PLL and SDRAM, as the whole
+// register values the setters it used to call would leave on a freshly
+// reset chip: 16bpp canvas and main window at 0, RGB565 host data written
+// top down then left to right, graphic mode on SDRAM, fonts rotated, bottom
+// to top scan, RGB order, PCLK rising, DE high and HSYNC/VSYNC low active.
+// [01h] is left as RA8876_PLL_Initial() wrote it: 24-bit panel output and
+// 8-bit host bus.
+static const uint8_t initRegs[][2] PROGMEM =
+{
+    {0x02, 0x44},                                           // MACR
+    {0x03, 0x00},                                           // ICR
+    {0x10, 0x04},                                           // MPWCTR
+    {0x12, 0x08},                                           // DPCR
+    {0x13, 0x00},                                           // PCSR
+    {0x14, RA8876_HDWR},
+    {0x15, RA8876_HDWFTR},
+    {0x16, RA8876_HNDR},
+    {0x17, RA8876_HNDFTR},
+    {0x18, RA8876_HSTR},
+    {0x19, RA8876_HPWR},
+    {0x1A, (uint8_t)RA8876_VDHR},
+    {0x1B, (uint8_t)(RA8876_VDHR >> 8)},
+    {0x1C, (uint8_t)RA8876_VNDR},
+    {0x1D, (uint8_t)(RA8876_VNDR >> 8)},
+    {0x1E, RA8876_VSTR},
+    {0x1F, RA8876_VPWR},
+    {0x20, 0x00}, {0x21, 0x00}, {0x22, 0x00}, {0x23, 0x00}, // main image at 0
+    {0x24, (uint8_t)RA8876_PANEL_WIDTH},
+    {0x25, (uint8_t)(RA8876_PANEL_WIDTH >> 8)},
+    {0x26, 0x00}, {0x27, 0x00}, {0x28, 0x00}, {0x29, 0x00}, // main window at 0, 0
+    {0x50, 0x00}, {0x51, 0x00}, {0x52, 0x00}, {0x53, 0x00}, // canvas at 0
+    {0x54, (uint8_t)RA8876_PANEL_WIDTH},
+    {0x55, (uint8_t)(RA8876_PANEL_WIDTH >> 8)},
+    {0x56, 0x00}, {0x57, 0x00}, {0x58, 0x00}, {0x59, 0x00}, // active window
+    {0x5A, (uint8_t)RA8876_PANEL_WIDTH},
+    {0x5B, (uint8_t)(RA8876_PANEL_WIDTH >> 8)},
+    {0x5C, (uint8_t)RA8876_PANEL_HEIGHT},
+    {0x5D, (uint8_t)(RA8876_PANEL_HEIGHT >> 8)},
+    {0x5E, 0x01},                                           // AW_COLOR: XY, 16bpp
+    {0x5F, 0x00}, {0x60, 0x00}, {0x61, 0x00}, {0x62, 0x00}, // cursor at 0, 0
+    {0xCD, 0x10},                                           // font 90 degrees
+};
+#define INIT_REGS   ((uint8_t)(sizeof(initRegs) / sizeof(initRegs[0])))
+
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_initial()
+{
+    LCD_ShadowInvalidate();
     RA8876_SW_Reset();
-    //Serial.println("  PLL Init");
     RA8876_PLL_Initial();
-    //Serial.println("  SDRAM Init");
     RA8876_SDRAM_initial();
-    //Serial.println("  TFT_24bit");
-    //**[01h]**//
-    TFT_24bit();
-    //Serial.println("  Host_bus_16bit");
-    //Host_Bus_16bit();
-    //**[02h]**//
-    //Serial.println("  RGB_16bpp");
-    RGB_16b_16bpp();
-    //RGB_16b_24bpp_mode1();
-    //  MemWrite_Left_Right_Top_Down();
-    //  MemWrite_Right_Left_Top_Down();
-      MemWrite_Top_Down_Left_Right();
-    //  MemWrite_Down_Top_Left_Right(); // This was it
-    
-    //**[03h]**//
-    //Serial.println("  Graphic_mode");
-    Graphic_Mode();
-    //Serial.println("  Memsel");
-    Memory_Select_SDRAM();
-    //Serial.println("  Font");
-    
-    Font_90_degree();
-    VSCAN_B_to_T();
-    
-    //  VSCAN_T_to_B();
-    
-    
-    PDATA_Set_RGB();
-    //PDATA_Set_GRB();
-    
-    PCLK_Rising();
-    //    PCLK_Falling();
-    DE_High_Active();
-    HSYNC_Low_Active();
-    //  HSYNC_High_Active();
-    VSYNC_Low_Active();
-    //  VSYNC_High_Active();
-    LCD_HorizontalWidth_VerticalHeight(400, 1280);
-    
-    LCD_Horizontal_Non_Display(160);
-    LCD_HSYNC_Start_Position(160);
-    LCD_HSYNC_Pulse_Width(24);
-    LCD_Vertical_Non_Display(10);
-    LCD_VSYNC_Start_Position(12);
-    LCD_VSYNC_Pulse_Width(2);
-    
-    
-    
-    Select_Main_Window_16bpp();
-    Main_Image_Start_Address(0);
-    Main_Image_Width(400);
-    Main_Window_Start_XY(0, 0);
-    Canvas_Image_Start_address(0);
-    Canvas_image_width(400);//
-    Active_Window_XY(0, 0);
-    Active_Window_WH(400, 1280);
-    
-    Memory_XY_Mode();
-    Memory_16bpp_Mode();
-    //Memory_24bpp_Mode();
-    Select_Main_Window_16bpp();
-    
+    RA8876_Register_Initial();
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_Register_Initial()
+{
+    uint16_t tag[RA8876_WARM_BYTES / 2];
+
+    warmTag(tag);
+    warmSeek();
+    for (uint8_t i = 0; i < RA8876_WARM_BYTES / 2; i++)
+        LCD_DataWrite16(tag[i]);
+    Check_Mem_WR_FIFO_Empty();
+    LCD_RegisterWriteList_P(initRegs, INIT_REGS);
+}
+
+// Signature for RA8876_WarmStart(): a magic number and a Fletcher-16 sum
+// of the PLL dividers and initRegs, so that firmware built with other
+// clocks or panel timing starts cold.
+template<class Bus>
+void RA8876_Driver<Bus>::warmTag(uint16_t *tag)
+{
+    static const uint8_t pll[6] =
+    {
+        RA8876_SCAN_DIVK << 1 | RA8876_SCAN_DIVM, (uint8_t)RA8876_SCAN_DIVN,
+        RA8876_DRAM_DIVK << 1 | RA8876_DRAM_DIVM, (uint8_t)RA8876_DRAM_DIVN,
+        RA8876_CORE_DIVK << 1 | RA8876_CORE_DIVM, (uint8_t)RA8876_CORE_DIVN,
+    };
+    uint16_t a = 0, b = 0;
+
+    for (uint16_t i = 0; i < sizeof(pll) + sizeof(initRegs); i++)
+    {
+        a = (a + (i < sizeof(pll) ? pll[i] : pgm_read_byte(&initRegs[0][0] + i - sizeof(pll)))) % 255;
+        b = (b + a) % 255;
+    }
+    tag[0] = 0x8876;
+    tag[1] = 0x5A17;
+    tag[2] = b << 8 | a;
+    tag[3] = ~tag[2];
+}
+
+// Memory port to the signature: linear addressing, 16bpp.
+template<class Bus>
+void RA8876_Driver<Bus>::warmSeek()
+{
+    const uint8_t regs[5][2] =
+    {
+        {0x5E, 0x05},
+        {0x5F, (uint8_t)RA8876_WARM_ADDR},
+        {0x60, (uint8_t)(RA8876_WARM_ADDR >> 8)},
+        {0x61, (uint8_t)(RA8876_WARM_ADDR >> 16)},
+        {0x62, (uint8_t)(RA8876_WARM_ADDR >> 24)},
+    };
+    LCD_RegisterWriteList(regs, 5);
+    LCD_CmdWrite(0x04);
+}
+
+// Only reads the chip, apart from the memory port set-up for the signature
+// read, which is put back. Engines an earlier run left going are waited
+// for, as the driver no longer knows about them.
+template<class Bus>
+bool RA8876_Driver<Bus>::RA8876_WarmStart()
+{
+    uint16_t tag[RA8876_WARM_BYTES / 2], want[RA8876_WARM_BYTES / 2];
+    uint8_t save[5][2];
+    uint8_t status, i;
+
+    bus_8876.setCoreClock(OSC_FREQ);
+    LCD_ShadowInvalidate();
+    fifo_8876.reset();
+    engine_8876 = RA8876_ENGINE_IDLE;
+
+    // Held in reset or power saving, or SDRAM not up (a bus with nothing on
+    // it reads all ones or all zeros and fails here too).
+    status = LCD_StatusRead();
+    if ((status & 0x02) || !(status & 0x04))
+        return false;
+    if (!(LCD_RegisterReadDirect(0x01) & 0x80))
+        return false;
+    bus_8876.setCoreClock(RA8876_CORE_KHZ / 1000);
+
+    Check_2D_Busy();
+    Check_Busy_SFI_DMA();
+
+    for (i = 0; i < 5; i++)
+    {
+        save[i][0] = 0x5E + i;
+        save[i][1] = LCD_RegisterReadDirect(0x5E + i);
+    }
+    warmSeek();
+    LCD_DataRead();     // dummy read
+    Readback_Chunk(tag, RA8876_WARM_BYTES / 2);
+    LCD_RegisterWriteList(save, 5);
+
+    warmTag(want);
+    for (i = 0; i < RA8876_WARM_BYTES / 2; i++)
+    {
+        if (tag[i] != want[i])
+        {
+            bus_8876.setCoreClock(OSC_FREQ);
+            return false;
+        }
+    }
+    return true;
 }
 
 //==============================================================================
-void ER_TFTM0784::RA8876_PLL_Initial()
-{
-    ;
-    uint16_t plldivn_sclk, plldivn_cclk, plldivn_mclk;
-    uint16_t plldivk_sclk, plldivk_cclk, plldivk_mclk;
-    uint16_t plldivk_sclkpow, plldivk_cclkpow, plldivk_mclkpow;
-    uint16_t temp_sclk, temp_cclk, temp_mclk;
-    uint16_t plldivm_sclk, plldivm_cclk, plldivm_mclk = 0;
-    
-    //=====[05h] b3-b1
-#ifdef SCAN_DIVK1           // 000
-    plldivk_sclk = 0;
-    plldivk_sclkpow = 1;
-#endif
-#ifdef SCAN_DIVK2     // 001
-    plldivk_sclk = 1;
-    plldivk_sclkpow = 2;
-#endif
-#ifdef SCAN_DIVK4       // 010
-    plldivk_sclk = 2;
-    plldivk_sclkpow = 4;
-#endif
-#ifdef SCAN_DIVK8       // 011
-    plldivk_sclk = 3;
-    plldivk_sclkpow = 8;
-#endif
-#ifdef SCAN_DIVK16      // 100
-    plldivk_sclk = 4;
-    plldivk_sclkpow = 16;
-#endif
-#ifdef SCAN_DIVK32      // 101
-    plldivk_sclk = 5;
-    plldivk_sclkpow = 32;
-#endif
-#ifdef SCAN_DIVK64      // 110
-    plldivk_sclk = 6;
-    plldivk_sclkpow = 64;
-#endif
-#ifdef SCAN_DIVK128     // 111
-    plldivk_sclk = 7;
-    plldivk_sclkpow = 128;
-#endif
-    //=====[05h] b0
-#ifdef SCAN_DIVM1       // 0
-    plldivm_sclk = 0;
-#endif
-#ifdef SCAN_DIVM2       // 1
-    plldivm_sclk = 1;
-#endif
-    //=====[07h] b3-b1
-#ifdef DRAM_DIVK1       // 000
-    plldivk_mclk = 0;
-    plldivk_mclkpow = 1;
-#endif
-#ifdef DRAM_DIVK2     // 001
-    plldivk_mclk = 1;
-    plldivk_mclkpow = 2;
-#endif
-#ifdef DRAM_DIVK4       // 010
-    plldivk_mclk = 2;
-    plldivk_mclkpow = 4;
-#endif
-#ifdef DRAM_DIVK8       // 011
-    plldivk_mclk = 3;
-    plldivk_mclkpow = 8;
-#endif
-    //=====[07h] b0
-#ifdef DRAM_DIVM1       // 0
-    plldivm_mclk = 0;
-#endif
-#ifdef DRAM_DIVM2     // 1
-    plldivm_mclk = 1;
-#endif
-    //=====[09h] b3-b1
-#ifdef CORE_DIVK1       // 000
-    plldivk_cclk = 0;
-    plldivk_cclkpow = 1;
-#endif
-#ifdef CORE_DIVK2     // 001
-    plldivk_cclk = 1;
-    plldivk_cclkpow = 2;
-#endif
-#ifdef CORE_DIVK4       // 010
-    plldivk_cclk = 2;
-    plldivk_cclkpow = 4;
-#endif
-#ifdef CORE_DIVK8       // 011
-    plldivk_cclk = 3;
-    plldivk_cclkpow = 8;
-#endif
-    //=====[09h] b0
-#ifdef CORE_DIVM1       // 0
-    plldivm_cclk = 0;
-#endif
-#ifdef CORE_DIVM2     // 1
-    plldivm_cclk = 1;
-#endif
-    
-    // PLL = FIN*(PLLDIVN+1) / (PLLDIVM+1) * (2^PLLDIVK)
-    // PLLDIVN = [(PLL * (PLLDIVM+1) * (2^PLLDIVK)) / FIN ] - 1
-    plldivn_sclk = ((SCAN_FREQ * (plldivm_sclk + 1) * plldivk_sclkpow) / OSC_FREQ) - 1;
-    plldivn_mclk = ((DRAM_FREQ * (plldivm_mclk + 1) * plldivk_mclkpow) / OSC_FREQ) - 1;
-    plldivn_cclk = ((CORE_FREQ * (plldivm_cclk + 1) * plldivk_cclkpow) / OSC_FREQ) - 1;
-    
-    temp_sclk = (plldivk_sclk << 1) | plldivm_sclk;
-    temp_mclk = (plldivk_mclk << 1) | plldivm_mclk;
-    temp_cclk = (plldivk_cclk << 1) | plldivm_cclk;
-    
-    
-    LCD_CmdWrite(0x05);
-    LCD_DataWrite(temp_sclk);
-    LCD_CmdWrite(0x07);
-    LCD_DataWrite(temp_mclk);
-    LCD_CmdWrite(0x09);
-    LCD_DataWrite(temp_cclk);
-    
-    LCD_CmdWrite(0x06);
-    LCD_DataWrite(plldivn_sclk);
-    LCD_CmdWrite(0x08);
-    LCD_DataWrite(plldivn_mclk);
-    LCD_CmdWrite(0x0a);
-    LCD_DataWrite(plldivn_cclk);
-    
-    LCD_CmdWrite(0x01);
-    LCD_DataWrite(0x00);
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_PLL_Initial()
+{
+    // Dividers from the derived settings in ER-TFTM0784-1.h.
+    static const uint8_t regs[7][2] =
+    {
+        {0x05, RA8876_SCAN_DIVK << 1 | RA8876_SCAN_DIVM},
+        {0x07, RA8876_DRAM_DIVK << 1 | RA8876_DRAM_DIVM},
+        {0x09, RA8876_CORE_DIVK << 1 | RA8876_CORE_DIVM},
+        {0x06, (uint8_t)RA8876_SCAN_DIVN},
+        {0x08, (uint8_t)RA8876_DRAM_DIVN},
+        {0x0a, (uint8_t)RA8876_CORE_DIVN},
+        {0x01, 0x00},
+    };
+    LCD_RegisterWriteList(regs, 7);
     delayMicroseconds(10);
     LCD_DataWrite(0x80);
     //Enable_PLL();
     
     delay(10); //µ¥PLLÃ­©w
+    bus_8876.setCoreClock(RA8876_CORE_KHZ / 1000);
 }
 
 
 
 //------------------------------------//----------------------------------*/
 
-void ER_TFTM0784::RA8876_SDRAM_initial()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_SDRAM_initial()
 {
 #define RA8876_REG_SDRAR 0xE0
     // See page 199 of RA8876 manual
@@ -819,18 +1002,12 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
 #define RA8876_REG_SDR_REF_ITVL1 0xE3
 #define RA8876_REG_SDRCR 0xE4
     
-    uint16_t sdram_itv;
-    
 #ifdef W25Q128FVSG
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0xF9);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x03); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 8192) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x01);
 #endif
@@ -840,12 +1017,8 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0xf9);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x02); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 8192) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x09);
 #endif
     
@@ -854,12 +1027,8 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0x32);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x02); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 8192) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x01);
 #endif
@@ -870,12 +1039,8 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0x28);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x02); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 4096) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x01);
 #endif
@@ -885,12 +1050,8 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0x08);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x03); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 4096) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x09);
 #endif
@@ -900,12 +1061,8 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0x31);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x03); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 8192) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x01);
 #endif
@@ -915,12 +1072,8 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0x31);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x03); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 8192) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x01);
 #endif
@@ -930,12 +1083,8 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0x29);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x03); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 8192) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x01);
 #endif
@@ -944,12 +1093,8 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0x28);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x03); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 4096) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x01);
 #endif
@@ -958,12 +1103,8 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0x28);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x03); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 4096) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x01);
 #endif
@@ -972,23 +1113,17 @@ void ER_TFTM0784::RA8876_SDRAM_initial()
     LCD_RegisterWrite(RA8876_REG_SDRAR, 0x29);
     LCD_RegisterWrite(RA8876_REG_SDRMD, 0x03); //CAS:2=0x02¡ACAS:3=0x03
     
-    sdram_itv = (64000000 / 4096) / (1000 / DRAM_FREQ) ;
-    
-    sdram_itv -= 2;
-    
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, sdram_itv);
-    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, sdram_itv >> 8);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL0, (uint8_t)RA8876_SDRAM_ITV);
+    LCD_RegisterWrite(RA8876_REG_SDR_REF_ITVL1, RA8876_SDRAM_ITV >> 8);
     
     LCD_RegisterWrite(RA8876_REG_SDRCR, 0x01);
 #endif
     
     Check_SDRAM_Ready();
-    
-    delay(10);
-    
 }
 
-void ER_TFTM0784::Backlight_ON() {
+template<class Bus>
+void RA8876_Driver<Bus>::Backlight_ON() {
     Enable_PWM0_Interrupt();
     Clear_PWM0_Interrupt_Flag();
     Mask_PWM0_Interrupt_Flag();
@@ -1000,7 +1135,8 @@ void ER_TFTM0784::Backlight_ON() {
     Set_Timer0_Compare_Buffer(0xffff);
 }
 
-void ER_TFTM0784::Backlight_OFF() {
+template<class Bus>
+void RA8876_Driver<Bus>::Backlight_OFF() {
     Enable_PWM0_Interrupt();
     Clear_PWM0_Interrupt_Flag();
     Mask_PWM0_Interrupt_Flag();
@@ -1016,13 +1152,16 @@ void ER_TFTM0784::Backlight_OFF() {
 /*Sub program area                                  */
 /******************************************************************************/
 //==============================================================================
-void ER_TFTM0784::Check_Mem_WR_FIFO_not_Full()
+template<class Bus>
+void RA8876_Driver<Bus>::Check_Mem_WR_FIFO_not_Full()
 {
     /*  0: Memory Write FIFO is not full.
      1: Memory Write FIFO is full.   */
     int iters = 0;
+    RA8876_WAIT(RA8876_WAIT_WR_FIFO);
     do
     {
+        RA8876_POLL();
         if (++iters >= 10000)
         {
             //Serial.println("    WARN FIFO never signalled not Full.");
@@ -1030,7 +1169,20 @@ void ER_TFTM0784::Check_Mem_WR_FIFO_not_Full()
         }
     } while ( LCD_StatusRead() & 0x80 );
 }
-void ER_TFTM0784::Check_Mem_WR_FIFO_Empty()
+// Take one write from the FIFO credit, waiting for the FIFO to drain when
+// the credit is used up.
+template<class Bus>
+void RA8876_Driver<Bus>::Mem_WR_FIFO_Reserve()
+{
+    if (fifo_8876.take())
+        return;
+    RA8876_WAIT(RA8876_WAIT_WR_FIFO);
+    fifo_8876.wait([&]() { RA8876_POLL(); return LCD_StatusRead(); });
+    fifo_8876.take();
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::Check_Mem_WR_FIFO_Empty()
 {
     /*  0: Memory Write FIFO is not empty.
      1: Memory Write FIFO is empty.    */
@@ -1040,7 +1192,8 @@ void ER_TFTM0784::Check_Mem_WR_FIFO_Empty()
         
     } while (( (LCD_StatusRead() & 0x40) == 0x00 ) && (timer > millis()));
 }
-void ER_TFTM0784::Check_Mem_RD_FIFO_not_Full()
+template<class Bus>
+void RA8876_Driver<Bus>::Check_Mem_RD_FIFO_not_Full()
 {
     /*  0: Memory Read FIFO is not full.
      1: Memory Read FIFO is full.    */
@@ -1049,7 +1202,8 @@ void ER_TFTM0784::Check_Mem_RD_FIFO_not_Full()
         
     } while ( LCD_StatusRead() & 0x20 );
 }
-void ER_TFTM0784::Check_Mem_RD_FIFO_not_Empty()
+template<class Bus>
+void RA8876_Driver<Bus>::Check_Mem_RD_FIFO_not_Empty()
 {
     /*  0: Memory Read FIFO is not empty.
      1: Memory Read FIFO is empty.
@@ -1059,15 +1213,121 @@ void ER_TFTM0784::Check_Mem_RD_FIFO_not_Empty()
         
     } while ( LCD_StatusRead() & 0x10 );
 }
-void ER_TFTM0784::Check_2D_Busy()
+template<class Bus>
+void RA8876_Driver<Bus>::Check_2D_Busy()
 {
+    if (engine_8876 != RA8876_ENGINE_DMA)
+        engine_8876 = RA8876_ENGINE_IDLE;
+    if (list_8876)
+    {
+        list_8876->wait(RA8876_ENGINE_DRAW);
+        return;
+    }
+    RA8876_WAIT(RA8876_WAIT_2D);
+    if (irq_8876)
+    {
+        do
+        {
+            RA8876_POLL();
+        } while (engineIrqStep(false));
+        return;
+    }
     do
     {
-        
+        RA8876_POLL();
     } while ( LCD_StatusRead() & 0x08 );
     
 }
-void ER_TFTM0784::Check_SDRAM_Ready()
+
+template<class Bus>
+void RA8876_Driver<Bus>::Engine_IrqAttach(RA8876_Irq *irq)
+{
+    irq_8876 = irq;
+    if (irq == NULL)
+    {
+        Disable_DMA_Draw_BTE_Interrupt();
+        return;
+    }
+    Interrupt_Active_Low();
+    Enable_DMA_Draw_BTE_Interrupt_Flag();
+    LCD_RegisterWrite(0x0C, cSetb2);    // write 1 to clear, leave the other flags
+    Enable_DMA_Draw_BTE_Interrupt();
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::fence()
+{
+    switch (engine_8876)
+    {
+    case RA8876_ENGINE_DRAW:
+        Check_Busy_Draw();
+        break;
+    case RA8876_ENGINE_BTE:
+    case RA8876_ENGINE_BTE_MCU:
+        Check_BTE_Busy();
+        break;
+    case RA8876_ENGINE_DMA:
+        Check_Busy_SFI_DMA();
+        break;
+    }
+}
+
+// Registers that must not be touched while engine_8876 runs: everything
+// that reaches SDRAM or the canvas, the start bits of all engines, power
+// and SDRAM control, and the running engine's own parameters. The memory
+// port itself is free while a BTE is fed through it.
+template<class Bus>
+bool RA8876_Driver<Bus>::engineDepends(uint8_t reg)
+{
+    if (reg <= 0x04)                        // SRR, CCR, MACR, ICR, MRWDP
+        return !(reg == 0x04 && engine_8876 == RA8876_ENGINE_BTE_MCU);
+    if (reg >= 0x50 && reg <= 0x67)         // canvas, active window, cursors, DCR0
+        return true;
+    if (reg == 0x76 || reg == 0x90 || reg == 0xB6)  // DCR1, BTE_CTRL0, DMA_CTRL
+        return true;
+    if (reg >= 0xDF && reg <= 0xE4)         // power saving, SDRAM control
+        return true;
+    switch (engine_8876)
+    {
+    case RA8876_ENGINE_DRAW:
+        return (reg >= 0x68 && reg <= 0x7F) || (reg >= 0xD2 && reg <= 0xD4);
+    case RA8876_ENGINE_BTE:
+    case RA8876_ENGINE_BTE_MCU:
+        return (reg >= 0x91 && reg <= 0xB5) || (reg >= 0xD2 && reg <= 0xD7);
+    case RA8876_ENGINE_DMA:
+        return reg >= 0xB7 && reg <= 0xCB;
+    }
+    return false;
+}
+
+// Serial flash DMA ([B6h] bit 0) or the draw/BTE core (status bit 3).
+template<class Bus>
+bool RA8876_Driver<Bus>::engineBusy(bool dma)
+{
+    if (dma)
+        return LCD_RegisterReadDirect(0xB6) & 0x01;
+    return LCD_StatusRead() & 0x08;
+}
+
+// One step of an engine wait on the INT pin: clear the DMA/draw/BTE flag,
+// check the engine and, if it is still busy, sleep until INT. False once
+// the engine is idle. The flag is cleared first because INT stays low
+// until it is, and an earlier completion nobody waited for would then
+// leave no edge to wake on.
+template<class Bus>
+bool RA8876_Driver<Bus>::engineIrqStep(bool dma)
+{
+    uint8_t seen;
+
+    LCD_RegisterWrite(0x0C, cSetb2);
+    seen = irq_8876->count();
+    if (!engineBusy(dma))
+        return false;
+    irq_8876->wait(seen, RA8876_IRQ_TIMEOUT_MS);
+    return true;
+}
+template<class Bus>
+void RA8876_Driver<Bus>::Check_SDRAM_Ready()
 {
     /*  0: SDRAM is not ready for access
      1: SDRAM is ready for access    */
@@ -1079,7 +1339,8 @@ void ER_TFTM0784::Check_SDRAM_Ready()
 }
 
 
-uint8_t ER_TFTM0784:: Power_Saving_Status()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>:: Power_Saving_Status()
 {
     uint8_t temp;
     
@@ -1092,7 +1353,8 @@ uint8_t ER_TFTM0784:: Power_Saving_Status()
 }
 
 
-void ER_TFTM0784::Check_Power_is_Normal()//¬O Normal mode ´NÂ÷¶}
+template<class Bus>
+void RA8876_Driver<Bus>::Check_Power_is_Normal()//¬O Normal mode ´NÂ÷¶}
 {
     /*  0: Normal operation state
      1: Power saving state   */
@@ -1101,7 +1363,8 @@ void ER_TFTM0784::Check_Power_is_Normal()//¬O Normal mode ´NÂ÷¶}
         
     } while ( LCD_StatusRead() & 0x02 );
 }
-void ER_TFTM0784::Check_Power_is_Saving()//¬O Saving mode ´NÂ÷¶}
+template<class Bus>
+void RA8876_Driver<Bus>::Check_Power_is_Saving()//¬O Saving mode ´NÂ÷¶}
 {
     /*  0: Normal operation state
      1: Power saving state   */
@@ -1110,7 +1373,8 @@ void ER_TFTM0784::Check_Power_is_Saving()//¬O Saving mode ´NÂ÷¶}
         
     } while ( (LCD_StatusRead() & 0x02) == 0x00 );
 }
-void ER_TFTM0784::Check_NO_Interrupt()//¨S¦³ Interrupt ´NÂ÷¶}
+template<class Bus>
+void RA8876_Driver<Bus>::Check_NO_Interrupt()//¨S¦³ Interrupt ´NÂ÷¶}
 {
     /*  0: without interrupt event
      1: interrupt event occur
@@ -1120,7 +1384,8 @@ void ER_TFTM0784::Check_NO_Interrupt()//¨S¦³ Interrupt ´NÂ÷¶}
         
     } while ( LCD_StatusRead() & 0x01 );
 }
-void ER_TFTM0784::Check_Interrupt_Occur()//¦³ Interrupt ´NÂ÷¶}
+template<class Bus>
+void RA8876_Driver<Bus>::Check_Interrupt_Occur()//¦³ Interrupt ´NÂ÷¶}
 {
     /*  0: without interrupt event
      1: interrupt event occur
@@ -1131,15 +1396,29 @@ void ER_TFTM0784::Check_Interrupt_Occur()//¦³ Interrupt ´NÂ÷¶}
     } while ( (LCD_StatusRead() & 0x01) == 0x00 );
 }
 
-void ER_TFTM0784::Check_Busy_Draw()
+template<class Bus>
+void RA8876_Driver<Bus>::Check_Busy_Draw()
 {
     uint8_t temp;
     
+    if (engine_8876 != RA8876_ENGINE_DMA)
+        engine_8876 = RA8876_ENGINE_IDLE;
+    if (list_8876)
+    {
+        list_8876->wait(RA8876_ENGINE_DRAW);
+        return;
+    }
+    
     //(0)
     //  delay(10);
     
     
     //(A)
+    if (irq_8876)
+    {
+        while (engineIrqStep(false));
+        return;
+    }
     do
     {
         temp = LCD_StatusRead();
@@ -1168,7 +1447,8 @@ void ER_TFTM0784::Check_Busy_Draw()
 
 //[00h]=========================================================================
 
-void ER_TFTM0784::RA8876_SW_Reset()//IC Reset¡A¦ý¤£·|²MRegister/Memory¡C
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_SW_Reset()//IC Reset¡A¦ý¤£·|²MRegister/Memory¡C
 {
     uint8_t temp;
     
@@ -1185,7 +1465,8 @@ void ER_TFTM0784::RA8876_SW_Reset()//IC Reset¡A¦ý¤£·|²MRegister/Memory¡C
 }
 
 //[01h][01h][01h][01h][01h][01h][01h][01h][01h][01h][01h][01h][01h][01h][01h][01h]
-void ER_TFTM0784::Enable_PLL()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PLL()
 {
     /*  0: PLL disable; allow change PLL parameter.
      1: PLL enable; cannot change PLL parameter.*/
@@ -1197,7 +1478,8 @@ void ER_TFTM0784::Enable_PLL()
     
     delayMicroseconds(1);//PLL ±Ò°Ê®É¶¡¡A¦Ü¤Ö 1 us¡C
 }
-void ER_TFTM0784::RA8876_Sleep()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_Sleep()
 {
     /*  0: Normal mode.
      1: Sleep mode.*/
@@ -1207,7 +1489,8 @@ void ER_TFTM0784::RA8876_Sleep()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::RA8876_WakeUp()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_WakeUp()
 {
     /*  0: Normal mode.
      1: Sleep mode.*/
@@ -1217,7 +1500,8 @@ void ER_TFTM0784::RA8876_WakeUp()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Key_Scan_Enable()
+template<class Bus>
+void RA8876_Driver<Bus>::Key_Scan_Enable()
 {
     /*  0: Disable.
      1: Enable.*/
@@ -1227,7 +1511,8 @@ void ER_TFTM0784::Key_Scan_Enable()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Key_Scan_Disable()
+template<class Bus>
+void RA8876_Driver<Bus>::Key_Scan_Disable()
 {
     /*  0: Disable.
      1: Enable.*/
@@ -1237,7 +1522,8 @@ void ER_TFTM0784::Key_Scan_Disable()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::TFT_24bit()
+template<class Bus>
+void RA8876_Driver<Bus>::TFT_24bit()
 {
     /*  00b: 24-bits output.
      01b: 18-bits output, unused pins are set as GPIO.
@@ -1250,7 +1536,8 @@ void ER_TFTM0784::TFT_24bit()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::TFT_18bit()
+template<class Bus>
+void RA8876_Driver<Bus>::TFT_18bit()
 {
     /*  00b: 24-bits output.
      01b: 18-bits output, unused pins are set as GPIO.
@@ -1263,7 +1550,8 @@ void ER_TFTM0784::TFT_18bit()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::TFT_16bit()
+template<class Bus>
+void RA8876_Driver<Bus>::TFT_16bit()
 {
     /*  00b: 24-bits output.
      01b: 18-bits output, unused pins are set as GPIO.
@@ -1276,7 +1564,8 @@ void ER_TFTM0784::TFT_16bit()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::TFT_LVDS()
+template<class Bus>
+void RA8876_Driver<Bus>::TFT_LVDS()
 {
     /*  00b: 24-bits output.
      01b: 18-bits output, unused pins are set as GPIO.
@@ -1290,7 +1579,8 @@ void ER_TFTM0784::TFT_LVDS()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::RA8876_I2CM_Enable()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_I2CM_Enable()
 {
     /*  I2C master Interface Enable/Disable
      0: Disable
@@ -1302,7 +1592,8 @@ void ER_TFTM0784::RA8876_I2CM_Enable()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::RA8876_I2CM_Disable()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_I2CM_Disable()
 {
     /*  I2C master Interface Enable/Disable
      0: Disable
@@ -1314,7 +1605,8 @@ void ER_TFTM0784::RA8876_I2CM_Disable()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::Enable_SFlash_SPI()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_SFlash_SPI()
 {
     /*  Serial Flash SPI Interface Enable/Disable
      0: Disable
@@ -1326,7 +1618,8 @@ void ER_TFTM0784::Enable_SFlash_SPI()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::Disable_SFlash_SPI()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_SFlash_SPI()
 {
     /*  Serial Flash SPI Interface Enable/Disable
      0: Disable
@@ -1337,7 +1630,8 @@ void ER_TFTM0784::Disable_SFlash_SPI()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Host_Bus_8bit()
+template<class Bus>
+void RA8876_Driver<Bus>::Host_Bus_8bit()
 {
     /*  Parallel Host Data Bus Width Selection
      0: 8-bit Parallel Host Data Bus.
@@ -1348,7 +1642,8 @@ void ER_TFTM0784::Host_Bus_8bit()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Host_Bus_16bit()
+template<class Bus>
+void RA8876_Driver<Bus>::Host_Bus_16bit()
 {
     /*  Parallel Host Data Bus Width Selection
      0: 8-bit Parallel Host Data Bus.
@@ -1362,7 +1657,8 @@ void ER_TFTM0784::Host_Bus_16bit()
 
 //[02h][02h][02h][02h][02h][02h][02h][02h][02h][02h][02h][02h][02h][02h][02h][02h]
 
-void ER_TFTM0784::RGB_8b_8bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::RGB_8b_8bpp()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1371,7 +1667,8 @@ void ER_TFTM0784::RGB_8b_8bpp()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::RGB_8b_16bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::RGB_8b_16bpp()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1380,7 +1677,8 @@ void ER_TFTM0784::RGB_8b_16bpp()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::RGB_8b_24bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::RGB_8b_24bpp()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1390,7 +1688,8 @@ void ER_TFTM0784::RGB_8b_24bpp()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::RGB_16b_8bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::RGB_16b_8bpp()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1399,7 +1698,8 @@ void ER_TFTM0784::RGB_16b_8bpp()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::RGB_16b_16bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::RGB_16b_16bpp()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1408,7 +1708,8 @@ void ER_TFTM0784::RGB_16b_16bpp()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::RGB_16b_24bpp_mode1()
+template<class Bus>
+void RA8876_Driver<Bus>::RGB_16b_24bpp_mode1()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1417,7 +1718,8 @@ void ER_TFTM0784::RGB_16b_24bpp_mode1()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::RGB_16b_24bpp_mode2()
+template<class Bus>
+void RA8876_Driver<Bus>::RGB_16b_24bpp_mode2()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1427,7 +1729,8 @@ void ER_TFTM0784::RGB_16b_24bpp_mode2()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::MemRead_Left_Right_Top_Down()
+template<class Bus>
+void RA8876_Driver<Bus>::MemRead_Left_Right_Top_Down()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1436,7 +1739,8 @@ void ER_TFTM0784::MemRead_Left_Right_Top_Down()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::MemRead_Right_Left_Top_Down()
+template<class Bus>
+void RA8876_Driver<Bus>::MemRead_Right_Left_Top_Down()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1445,7 +1749,8 @@ void ER_TFTM0784::MemRead_Right_Left_Top_Down()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::MemRead_Top_Down_Left_Right()
+template<class Bus>
+void RA8876_Driver<Bus>::MemRead_Top_Down_Left_Right()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1454,7 +1759,8 @@ void ER_TFTM0784::MemRead_Top_Down_Left_Right()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::MemRead_Down_Top_Left_Right()
+template<class Bus>
+void RA8876_Driver<Bus>::MemRead_Down_Top_Left_Right()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1463,7 +1769,8 @@ void ER_TFTM0784::MemRead_Down_Top_Left_Right()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::MemWrite_Left_Right_Top_Down()
+template<class Bus>
+void RA8876_Driver<Bus>::MemWrite_Left_Right_Top_Down()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1472,7 +1779,8 @@ void ER_TFTM0784::MemWrite_Left_Right_Top_Down()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::MemWrite_Right_Left_Top_Down()
+template<class Bus>
+void RA8876_Driver<Bus>::MemWrite_Right_Left_Top_Down()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1481,7 +1789,8 @@ void ER_TFTM0784::MemWrite_Right_Left_Top_Down()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::MemWrite_Top_Down_Left_Right()
+template<class Bus>
+void RA8876_Driver<Bus>::MemWrite_Top_Down_Left_Right()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1490,7 +1799,8 @@ void ER_TFTM0784::MemWrite_Top_Down_Left_Right()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::MemWrite_Down_Top_Left_Right()
+template<class Bus>
+void RA8876_Driver<Bus>::MemWrite_Down_Top_Left_Right()
 {
     uint8_t temp;
     LCD_CmdWrite(0x02);
@@ -1500,7 +1810,8 @@ void ER_TFTM0784::MemWrite_Down_Top_Left_Right()
     LCD_DataWrite(temp);
 }
 //[03h][03h][03h][03h][03h][03h][03h][03h][03h][03h][03h][03h][03h][03h][03h][03h]
-void ER_TFTM0784::Interrupt_Active_Low()
+template<class Bus>
+void RA8876_Driver<Bus>::Interrupt_Active_Low()
 {
     /*  MPU Interrupt active level
      0 : active low.
@@ -1511,7 +1822,8 @@ void ER_TFTM0784::Interrupt_Active_Low()
     temp &= cClrb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Interrupt_Active_High()
+template<class Bus>
+void RA8876_Driver<Bus>::Interrupt_Active_High()
 {
     /*  MPU Interrupt active level
      0 : active low.
@@ -1522,7 +1834,8 @@ void ER_TFTM0784::Interrupt_Active_High()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::ExtInterrupt_Debounce()
+template<class Bus>
+void RA8876_Driver<Bus>::ExtInterrupt_Debounce()
 {
     /*  External interrupt de-bounce
      0 : without de-bounce
@@ -1533,7 +1846,8 @@ void ER_TFTM0784::ExtInterrupt_Debounce()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::ExtInterrupt_Nodebounce()
+template<class Bus>
+void RA8876_Driver<Bus>::ExtInterrupt_Nodebounce()
 {
     /*  External interrupt de-bounce
      0 : without de-bounce
@@ -1544,7 +1858,8 @@ void ER_TFTM0784::ExtInterrupt_Nodebounce()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::ExtInterrupt_Input_Low_Level_Trigger()
+template<class Bus>
+void RA8876_Driver<Bus>::ExtInterrupt_Input_Low_Level_Trigger()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1553,7 +1868,8 @@ void ER_TFTM0784::ExtInterrupt_Input_Low_Level_Trigger()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::ExtInterrupt_Input_High_Level_Trigger()
+template<class Bus>
+void RA8876_Driver<Bus>::ExtInterrupt_Input_High_Level_Trigger()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1562,7 +1878,8 @@ void ER_TFTM0784::ExtInterrupt_Input_High_Level_Trigger()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::ExtInterrupt_Input_Falling_Edge_Trigger()
+template<class Bus>
+void RA8876_Driver<Bus>::ExtInterrupt_Input_Falling_Edge_Trigger()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1571,7 +1888,8 @@ void ER_TFTM0784::ExtInterrupt_Input_Falling_Edge_Trigger()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::ExtInterrupt_Input_Rising_Edge_Trigger()
+template<class Bus>
+void RA8876_Driver<Bus>::ExtInterrupt_Input_Rising_Edge_Trigger()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1580,7 +1898,8 @@ void ER_TFTM0784::ExtInterrupt_Input_Rising_Edge_Trigger()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::LVDS_Format1()
+template<class Bus>
+void RA8876_Driver<Bus>::LVDS_Format1()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1588,7 +1907,8 @@ void ER_TFTM0784::LVDS_Format1()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::LVDS_Format2()
+template<class Bus>
+void RA8876_Driver<Bus>::LVDS_Format2()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1596,7 +1916,8 @@ void ER_TFTM0784::LVDS_Format2()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Graphic_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Graphic_Mode()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1604,7 +1925,8 @@ void ER_TFTM0784::Graphic_Mode()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Text_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Text_Mode()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1612,7 +1934,8 @@ void ER_TFTM0784::Text_Mode()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Memory_Select_SDRAM()
+template<class Bus>
+void RA8876_Driver<Bus>::Memory_Select_SDRAM()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1621,7 +1944,8 @@ void ER_TFTM0784::Memory_Select_SDRAM()
     temp &= cClrb0; // B
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Memory_Select_Graphic_Cursor_RAM()
+template<class Bus>
+void RA8876_Driver<Bus>::Memory_Select_Graphic_Cursor_RAM()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1630,7 +1954,8 @@ void ER_TFTM0784::Memory_Select_Graphic_Cursor_RAM()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Memory_Select_Color_Palette_RAM()
+template<class Bus>
+void RA8876_Driver<Bus>::Memory_Select_Color_Palette_RAM()
 {
     uint8_t temp;
     LCD_CmdWrite(0x03);
@@ -1648,7 +1973,8 @@ void ER_TFTM0784::Memory_Select_Color_Palette_RAM()
 //[0Ah]=========================================================================
 //[0Bh]=========================================================================
 
-void ER_TFTM0784::Enable_Resume_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_Resume_Interrupt()
 {
     /*
      Resume Interrupt Enable
@@ -1661,7 +1987,8 @@ void ER_TFTM0784::Enable_Resume_Interrupt()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_Resume_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_Resume_Interrupt()
 {
     /*
      Resume Interrupt Enable
@@ -1674,7 +2001,8 @@ void ER_TFTM0784::Disable_Resume_Interrupt()
     temp &= cClrb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_ExtInterrupt_Input()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_ExtInterrupt_Input()
 {
     /*
      External Interrupt (PS[0] pin) Enable
@@ -1687,7 +2015,8 @@ void ER_TFTM0784::Enable_ExtInterrupt_Input()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_ExtInterrupt_Input()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_ExtInterrupt_Input()
 {
     /*
      External Interrupt (PS[0] pin) Enable
@@ -1700,7 +2029,8 @@ void ER_TFTM0784::Disable_ExtInterrupt_Input()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_I2CM_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_I2CM_Interrupt()
 {
     /*
      I2C Master Interrupt Enable
@@ -1713,7 +2043,8 @@ void ER_TFTM0784::Enable_I2CM_Interrupt()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_I2CM_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_I2CM_Interrupt()
 {
     /*
      I2C Master Interrupt Enable
@@ -1726,7 +2057,8 @@ void ER_TFTM0784::Disable_I2CM_Interrupt()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_Vsync_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_Vsync_Interrupt()
 {
     /*
      Vsync time base interrupt Enable Bit
@@ -1739,7 +2071,8 @@ void ER_TFTM0784::Enable_Vsync_Interrupt()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_Vsync_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_Vsync_Interrupt()
 {
     /*
      Vsync time base interrupt Enable Bit
@@ -1752,7 +2085,8 @@ void ER_TFTM0784::Disable_Vsync_Interrupt()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_KeyScan_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_KeyScan_Interrupt()
 {
     /*
      Key Scan Interrupt Enable Bit
@@ -1765,7 +2099,8 @@ void ER_TFTM0784::Enable_KeyScan_Interrupt()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_KeyScan_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_KeyScan_Interrupt()
 {
     /*
      Key Scan Interrupt Enable Bit
@@ -1778,7 +2113,8 @@ void ER_TFTM0784::Disable_KeyScan_Interrupt()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_DMA_Draw_BTE_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_DMA_Draw_BTE_Interrupt()
 {
     /*
      Serial flash DMA Complete | Draw task finished | BTE Process
@@ -1792,7 +2128,8 @@ void ER_TFTM0784::Enable_DMA_Draw_BTE_Interrupt()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_DMA_Draw_BTE_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_DMA_Draw_BTE_Interrupt()
 {
     /*
      Serial flash DMA Complete | Draw task finished | BTE Process
@@ -1806,7 +2143,8 @@ void ER_TFTM0784::Disable_DMA_Draw_BTE_Interrupt()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_PWM1_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PWM1_Interrupt()
 {
     /*
      PWM timer 1 Interrupt Enable Bit
@@ -1819,7 +2157,8 @@ void ER_TFTM0784::Enable_PWM1_Interrupt()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_PWM1_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_PWM1_Interrupt()
 {
     /*
      PWM timer 1 Interrupt Enable Bit
@@ -1832,7 +2171,8 @@ void ER_TFTM0784::Disable_PWM1_Interrupt()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_PWM0_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PWM0_Interrupt()
 {
     /*
      PWM timer 0 Interrupt Enable Bit
@@ -1845,7 +2185,8 @@ void ER_TFTM0784::Enable_PWM0_Interrupt()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_PWM0_Interrupt()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_PWM0_Interrupt()
 {
     /*
      PWM timer 0 Interrupt Enable Bit
@@ -1860,7 +2201,8 @@ void ER_TFTM0784::Disable_PWM0_Interrupt()
 }
 
 //[0Ch]=========================================================================
-uint8_t ER_TFTM0784:: Read_Interrupt_status()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>:: Read_Interrupt_status()
 {
     /*
      [Bit7]Read Function ..Resume Interrupt Status
@@ -1893,7 +2235,8 @@ uint8_t ER_TFTM0784:: Read_Interrupt_status()
     temp = LCD_DataRead();
     return temp;
 }
-void ER_TFTM0784::Clear_Resume_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_Resume_Interrupt_Flag()
 {
     /*
      Resume Interrupt flag
@@ -1907,7 +2250,8 @@ void ER_TFTM0784::Clear_Resume_Interrupt_Flag()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Clear_ExtInterrupt_Input_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_ExtInterrupt_Input_Flag()
 {
     /*
      External Interrupt (PS[0] pin) flag
@@ -1921,7 +2265,8 @@ void ER_TFTM0784::Clear_ExtInterrupt_Input_Flag()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Clear_I2CM_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_I2CM_Interrupt_Flag()
 {
     /*
      I2C master Interrupt flag
@@ -1935,7 +2280,8 @@ void ER_TFTM0784::Clear_I2CM_Interrupt_Flag()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Clear_Vsync_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_Vsync_Interrupt_Flag()
 {
     /*
      Vsync Time base interrupt flag
@@ -1949,7 +2295,8 @@ void ER_TFTM0784::Clear_Vsync_Interrupt_Flag()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Clear_KeyScan_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_KeyScan_Interrupt_Flag()
 {
     /*
      Key Scan Interrupt flag
@@ -1963,7 +2310,8 @@ void ER_TFTM0784::Clear_KeyScan_Interrupt_Flag()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Clear_DMA_Draw_BTE_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_DMA_Draw_BTE_Interrupt_Flag()
 {
     /*
      Serial flash DMA Complete | Draw task finished | BTE
@@ -1978,7 +2326,8 @@ void ER_TFTM0784::Clear_DMA_Draw_BTE_Interrupt_Flag()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Clear_PWM1_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_PWM1_Interrupt_Flag()
 {
     /*
      PWM 1 timer Interrupt flag
@@ -1992,7 +2341,8 @@ void ER_TFTM0784::Clear_PWM1_Interrupt_Flag()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Clear_PWM0_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_PWM0_Interrupt_Flag()
 {
     /*
      PWM 0 timer Interrupt flag
@@ -2007,7 +2357,8 @@ void ER_TFTM0784::Clear_PWM0_Interrupt_Flag()
     LCD_DataWrite(temp);
 }
 //[0Dh]=========================================================================
-void ER_TFTM0784::Mask_Resume_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Mask_Resume_Interrupt_Flag()
 {
     /*
      Mask Resume Interrupt Flag
@@ -2020,7 +2371,8 @@ void ER_TFTM0784::Mask_Resume_Interrupt_Flag()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Mask_ExtInterrupt_Input_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Mask_ExtInterrupt_Input_Flag()
 {
     /*
      Mask External Interrupt (PS[0] pin) Flag
@@ -2033,7 +2385,8 @@ void ER_TFTM0784::Mask_ExtInterrupt_Input_Flag()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Mask_I2CM_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Mask_I2CM_Interrupt_Flag()
 {
     /*
      Mask I2C Master Interrupt Flag
@@ -2046,7 +2399,8 @@ void ER_TFTM0784::Mask_I2CM_Interrupt_Flag()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Mask_Vsync_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Mask_Vsync_Interrupt_Flag()
 {
     /*
      Mask Vsync time base interrupt Flag
@@ -2059,7 +2413,8 @@ void ER_TFTM0784::Mask_Vsync_Interrupt_Flag()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Mask_KeyScan_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Mask_KeyScan_Interrupt_Flag()
 {
     /*
      Mask Key Scan Interrupt Flag
@@ -2072,7 +2427,8 @@ void ER_TFTM0784::Mask_KeyScan_Interrupt_Flag()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Mask_DMA_Draw_BTE_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Mask_DMA_Draw_BTE_Interrupt_Flag()
 {
     /*
      Mask Serial flash DMA Complete | Draw task finished | BTE
@@ -2086,7 +2442,8 @@ void ER_TFTM0784::Mask_DMA_Draw_BTE_Interrupt_Flag()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Mask_PWM1_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Mask_PWM1_Interrupt_Flag()
 {
     /*
      Mask PWM timer 1 Interrupt Flag
@@ -2099,7 +2456,8 @@ void ER_TFTM0784::Mask_PWM1_Interrupt_Flag()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Mask_PWM0_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Mask_PWM0_Interrupt_Flag()
 {
     /*
      Mask PWM timer 0 Interrupt Flag
@@ -2113,7 +2471,8 @@ void ER_TFTM0784::Mask_PWM0_Interrupt_Flag()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::Enable_Resume_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_Resume_Interrupt_Flag()
 {
     /*
      Mask Resume Interrupt Flag
@@ -2126,7 +2485,8 @@ void ER_TFTM0784::Enable_Resume_Interrupt_Flag()
     temp &= cClrb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_ExtInterrupt_Inpur_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_ExtInterrupt_Inpur_Flag()
 {
     /*
      Mask External Interrupt (PS[0] pin) Flag
@@ -2139,7 +2499,8 @@ void ER_TFTM0784::Enable_ExtInterrupt_Inpur_Flag()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_I2CM_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_I2CM_Interrupt_Flag()
 {
     /*
      Mask I2C Master Interrupt Flag
@@ -2152,7 +2513,8 @@ void ER_TFTM0784::Enable_I2CM_Interrupt_Flag()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_Vsync_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_Vsync_Interrupt_Flag()
 {
     /*
      Mask Vsync time base interrupt Flag
@@ -2165,7 +2527,8 @@ void ER_TFTM0784::Enable_Vsync_Interrupt_Flag()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_KeyScan_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_KeyScan_Interrupt_Flag()
 {
     /*
      Mask Key Scan Interrupt Flag
@@ -2178,7 +2541,8 @@ void ER_TFTM0784::Enable_KeyScan_Interrupt_Flag()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_DMA_Draw_BTE_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_DMA_Draw_BTE_Interrupt_Flag()
 {
     /*
      Mask Serial flash DMA Complete | Draw task finished | BTE
@@ -2192,7 +2556,8 @@ void ER_TFTM0784::Enable_DMA_Draw_BTE_Interrupt_Flag()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_PWM1_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PWM1_Interrupt_Flag()
 {
     /*
      Mask PWM timer 1 Interrupt Flag
@@ -2205,7 +2570,8 @@ void ER_TFTM0784::Enable_PWM1_Interrupt_Flag()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_PWM0_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PWM0_Interrupt_Flag()
 {
     /*
      Mask PWM timer 0 Interrupt Flag
@@ -2220,7 +2586,8 @@ void ER_TFTM0784::Enable_PWM0_Interrupt_Flag()
 }
 
 //[0Eh]=========================================================================
-void ER_TFTM0784::Enable_GPIOF_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_GPIOF_PullUp()
 {
     /*
      GPIO_F[7:0] Pull-Up Enable (XPDAT[23:19, 15:13])
@@ -2233,7 +2600,8 @@ void ER_TFTM0784::Enable_GPIOF_PullUp()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_GPIOE_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_GPIOE_PullUp()
 {
     /*
      GPIO_E[7:0] Pull-Up Enable (XPDAT[12:10, 7:3])
@@ -2246,7 +2614,8 @@ void ER_TFTM0784::Enable_GPIOE_PullUp()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_GPIOD_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_GPIOD_PullUp()
 {
     /*
      GPIO_D[7:0] Pull-Up Enable (XPDAT[18, 2, 17, 16, 9, 8, 1,0])
@@ -2259,7 +2628,8 @@ void ER_TFTM0784::Enable_GPIOD_PullUp()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_GPIOC_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_GPIOC_PullUp()
 {
     /*
      GPIO_C[6:0] Pull-Up Enable (XSDA, XSCL, XnSFCS1,
@@ -2273,7 +2643,8 @@ void ER_TFTM0784::Enable_GPIOC_PullUp()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_XDB15_8_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_XDB15_8_PullUp()
 {
     /*
      XDB[15:8] Pull-Up Enable
@@ -2286,7 +2657,8 @@ void ER_TFTM0784::Enable_XDB15_8_PullUp()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_XDB7_0_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_XDB7_0_PullUp()
 {
     /*
      XDB[7:0] Pull-Up Enable
@@ -2299,7 +2671,8 @@ void ER_TFTM0784::Enable_XDB7_0_PullUp()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_GPIOF_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_GPIOF_PullUp()
 {
     /*
      GPIO_F[7:0] Pull-Up Enable (XPDAT[23:19, 15:13])
@@ -2312,7 +2685,8 @@ void ER_TFTM0784::Disable_GPIOF_PullUp()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_GPIOE_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_GPIOE_PullUp()
 {
     /*
      GPIO_E[7:0] Pull-Up Enable (XPDAT[12:10, 7:3])
@@ -2325,7 +2699,8 @@ void ER_TFTM0784::Disable_GPIOE_PullUp()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_GPIOD_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_GPIOD_PullUp()
 {
     /*
      GPIO_D[7:0] Pull-Up Enable (XPDAT[18, 2, 17, 16, 9, 8, 1,0])
@@ -2338,7 +2713,8 @@ void ER_TFTM0784::Disable_GPIOD_PullUp()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_GPIOC_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_GPIOC_PullUp()
 {
     /*
      GPIO_C[6:0] Pull-Up Enable (XSDA, XSCL, XnSFCS1,
@@ -2352,7 +2728,8 @@ void ER_TFTM0784::Disable_GPIOC_PullUp()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_XDB15_8_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_XDB15_8_PullUp()
 {
     /*
      XDB[15:8] Pull-Up Enable
@@ -2365,7 +2742,8 @@ void ER_TFTM0784::Disable_XDB15_8_PullUp()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_XDB7_0_PullUp()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_XDB7_0_PullUp()
 {
     /*
      XDB[7:0] Pull-Up Enable
@@ -2379,7 +2757,8 @@ void ER_TFTM0784::Disable_XDB7_0_PullUp()
     LCD_DataWrite(temp);
 }
 //[0Fh]=========================================================================
-void ER_TFTM0784::XPDAT18_Set_GPIO_D7()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT18_Set_GPIO_D7()
 {
     /*
      XPDAT[18] ¡V not scan function select
@@ -2392,7 +2771,8 @@ void ER_TFTM0784::XPDAT18_Set_GPIO_D7()
     temp &= cClrb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT18_Set_KOUT4()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT18_Set_KOUT4()
 {
     /*
      XPDAT[18] ¡V not scan function select
@@ -2405,7 +2785,8 @@ void ER_TFTM0784::XPDAT18_Set_KOUT4()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT17_Set_GPIO_D5()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT17_Set_GPIO_D5()
 {
     /*
      XPDAT[17] ¡V not scan function select
@@ -2418,7 +2799,8 @@ void ER_TFTM0784::XPDAT17_Set_GPIO_D5()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT17_Set_KOUT2()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT17_Set_KOUT2()
 {
     /*
      XPDAT[17] ¡V not scan function select
@@ -2431,7 +2813,8 @@ void ER_TFTM0784::XPDAT17_Set_KOUT2()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT16_Set_GPIO_D4()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT16_Set_GPIO_D4()
 {
     /*
      XPDAT[16] ¡V not scan function select
@@ -2444,7 +2827,8 @@ void ER_TFTM0784::XPDAT16_Set_GPIO_D4()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT16_Set_KOUT1()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT16_Set_KOUT1()
 {
     /*
      XPDAT[16] ¡V not scan function select
@@ -2457,7 +2841,8 @@ void ER_TFTM0784::XPDAT16_Set_KOUT1()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT9_Set_GPIO_D3()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT9_Set_GPIO_D3()
 {
     /*
      XPDAT[9] ¡V not scan function select
@@ -2470,7 +2855,8 @@ void ER_TFTM0784::XPDAT9_Set_GPIO_D3()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT9_Set_KOUT3()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT9_Set_KOUT3()
 {
     /*
      XPDAT[9] ¡V not scan function select
@@ -2483,7 +2869,8 @@ void ER_TFTM0784::XPDAT9_Set_KOUT3()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT8_Set_GPIO_D2()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT8_Set_GPIO_D2()
 {
     /*
      XPDAT[8] ¡V not scan function select
@@ -2496,7 +2883,8 @@ void ER_TFTM0784::XPDAT8_Set_GPIO_D2()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT8_Set_KIN3()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT8_Set_KIN3()
 {
     /*
      XPDAT[8] ¡V not scan function select
@@ -2509,7 +2897,8 @@ void ER_TFTM0784::XPDAT8_Set_KIN3()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT2_Set_GPIO_D6()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT2_Set_GPIO_D6()
 {
     /*
      XPDAT[2] ¡V not scan function select
@@ -2522,7 +2911,8 @@ void ER_TFTM0784::XPDAT2_Set_GPIO_D6()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT2_Set_KIN4()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT2_Set_KIN4()
 {
     /*
      XPDAT[2] ¡V not scan function select
@@ -2535,7 +2925,8 @@ void ER_TFTM0784::XPDAT2_Set_KIN4()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT1_Set_GPIO_D1()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT1_Set_GPIO_D1()
 {
     /*
      XPDAT[1] ¡V not scan function select
@@ -2548,7 +2939,8 @@ void ER_TFTM0784::XPDAT1_Set_GPIO_D1()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT1_Set_KIN2()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT1_Set_KIN2()
 {
     /*
      XPDAT[1] ¡V not scan function select
@@ -2561,7 +2953,8 @@ void ER_TFTM0784::XPDAT1_Set_KIN2()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT0_Set_GPIO_D0()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT0_Set_GPIO_D0()
 {
     /*
      XPDAT[0] ¡V not scan function select
@@ -2574,7 +2967,8 @@ void ER_TFTM0784::XPDAT0_Set_GPIO_D0()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::XPDAT0_Set_KIN1()
+template<class Bus>
+void RA8876_Driver<Bus>::XPDAT0_Set_KIN1()
 {
     /*
      XPDAT[0] ¡V not scan function select
@@ -2589,7 +2983,8 @@ void ER_TFTM0784::XPDAT0_Set_KIN1()
 }
 
 //[10h]=========================================================================
-void ER_TFTM0784::Enable_PIP1()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PIP1()
 {
     /*
      PIP 1 window Enable/Disable
@@ -2603,7 +2998,8 @@ void ER_TFTM0784::Enable_PIP1()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_PIP1()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_PIP1()
 {
     /*
      PIP 1 window Enable/Disable
@@ -2617,7 +3013,8 @@ void ER_TFTM0784::Disable_PIP1()
     temp &= cClrb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_PIP2()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PIP2()
 {
     /*
      PIP 2 window Enable/Disable
@@ -2631,7 +3028,8 @@ void ER_TFTM0784::Enable_PIP2()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_PIP2()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_PIP2()
 {
     /*
      PIP 2 window Enable/Disable
@@ -2645,7 +3043,8 @@ void ER_TFTM0784::Disable_PIP2()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PIP1_Parameter()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PIP1_Parameter()
 {
     /*
      0: To configure PIP 1¡¦s parameters.
@@ -2657,7 +3056,8 @@ void ER_TFTM0784::Select_PIP1_Parameter()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PIP2_Parameter()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PIP2_Parameter()
 {
     /*
      0: To configure PIP 1¡¦s parameters.
@@ -2669,7 +3069,8 @@ void ER_TFTM0784::Select_PIP2_Parameter()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_Main_Window_8bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_Main_Window_8bpp()
 {
     /*
      Main Window Color Depth Setting
@@ -2684,7 +3085,8 @@ void ER_TFTM0784::Select_Main_Window_8bpp()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_Main_Window_16bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_Main_Window_16bpp()
 {
     /*
      Main Window Color Depth Setting
@@ -2699,7 +3101,8 @@ void ER_TFTM0784::Select_Main_Window_16bpp()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_Main_Window_24bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_Main_Window_24bpp()
 {
     /*
      Main Window Color Depth Setting
@@ -2715,7 +3118,8 @@ void ER_TFTM0784::Select_Main_Window_24bpp()
     LCD_DataWrite(temp);
 }
 //[11h]=========================================================================
-void ER_TFTM0784::Select_PIP2_Window_8bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PIP2_Window_8bpp()
 {
     /*
      PIP 1 Window Color Depth Setting
@@ -2730,7 +3134,8 @@ void ER_TFTM0784::Select_PIP2_Window_8bpp()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PIP2_Window_16bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PIP2_Window_16bpp()
 {
     /*
      PIP 1 Window Color Depth Setting
@@ -2745,7 +3150,8 @@ void ER_TFTM0784::Select_PIP2_Window_16bpp()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PIP2_Window_24bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PIP2_Window_24bpp()
 {
     /*
      PIP 1 Window Color Depth Setting
@@ -2760,7 +3166,8 @@ void ER_TFTM0784::Select_PIP2_Window_24bpp()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PIP1_Window_8bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PIP1_Window_8bpp()
 {
     /*
      PIP 2 Window Color Depth Setting
@@ -2775,7 +3182,8 @@ void ER_TFTM0784::Select_PIP1_Window_8bpp()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PIP1_Window_16bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PIP1_Window_16bpp()
 {
     /*
      PIP 2 Window Color Depth Setting
@@ -2790,7 +3198,8 @@ void ER_TFTM0784::Select_PIP1_Window_16bpp()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PIP1_Window_24bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PIP1_Window_24bpp()
 {
     /*
      PIP 2 Window Color Depth Setting
@@ -2807,7 +3216,8 @@ void ER_TFTM0784::Select_PIP1_Window_24bpp()
 }
 
 //[12h]=========================================================================
-void ER_TFTM0784::PCLK_Rising()
+template<class Bus>
+void RA8876_Driver<Bus>::PCLK_Rising()
 {
     /*
      PCLK Inversion
@@ -2823,7 +3233,8 @@ void ER_TFTM0784::PCLK_Rising()
     temp &= cClrb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::PCLK_Falling()
+template<class Bus>
+void RA8876_Driver<Bus>::PCLK_Falling()
 {
     /*
      PCLK Inversion
@@ -2840,7 +3251,8 @@ void ER_TFTM0784::PCLK_Falling()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Display_ON()
+template<class Bus>
+void RA8876_Driver<Bus>::Display_ON()
 {
     /*
      Display ON/OFF
@@ -2867,7 +3279,8 @@ void ER_TFTM0784::Display_ON()
     //Serial.println(temp);
 }
 
-void ER_TFTM0784::Display_OFF()
+template<class Bus>
+void RA8876_Driver<Bus>::Display_OFF()
 {
     /*
      Display ON/OFF
@@ -2881,7 +3294,8 @@ void ER_TFTM0784::Display_OFF()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Color_Bar_ON()
+template<class Bus>
+void RA8876_Driver<Bus>::Color_Bar_ON()
 {
     /*
      Display Test Color Bar
@@ -2895,7 +3309,8 @@ void ER_TFTM0784::Color_Bar_ON()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Color_Bar_OFF()
+template<class Bus>
+void RA8876_Driver<Bus>::Color_Bar_OFF()
 {
     /*
      Display Test Color Bar
@@ -2909,7 +3324,8 @@ void ER_TFTM0784::Color_Bar_OFF()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::HSCAN_L_to_R()
+template<class Bus>
+void RA8876_Driver<Bus>::HSCAN_L_to_R()
 {
     /*
      Horizontal Scan Direction
@@ -2924,7 +3340,8 @@ void ER_TFTM0784::HSCAN_L_to_R()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::HSCAN_R_to_L()
+template<class Bus>
+void RA8876_Driver<Bus>::HSCAN_R_to_L()
 {
     /*
      Horizontal Scan Direction
@@ -2939,7 +3356,8 @@ void ER_TFTM0784::HSCAN_R_to_L()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::VSCAN_T_to_B()
+template<class Bus>
+void RA8876_Driver<Bus>::VSCAN_T_to_B()
 {
     /*
      Vertical Scan direction
@@ -2954,7 +3372,8 @@ void ER_TFTM0784::VSCAN_T_to_B()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::VSCAN_B_to_T()
+template<class Bus>
+void RA8876_Driver<Bus>::VSCAN_B_to_T()
 {
     /*
      Vertical Scan direction
@@ -2969,7 +3388,8 @@ void ER_TFTM0784::VSCAN_B_to_T()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::PDATA_Set_RGB()
+template<class Bus>
+void RA8876_Driver<Bus>::PDATA_Set_RGB()
 {
     /*
      parallel PDATA[23:0] Output Sequence
@@ -2987,7 +3407,8 @@ void ER_TFTM0784::PDATA_Set_RGB()
     temp &= 0xf8;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::PDATA_Set_RBG()
+template<class Bus>
+void RA8876_Driver<Bus>::PDATA_Set_RBG()
 {
     /*
      parallel PDATA[23:0] Output Sequence
@@ -3006,7 +3427,8 @@ void ER_TFTM0784::PDATA_Set_RBG()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::PDATA_Set_GRB()
+template<class Bus>
+void RA8876_Driver<Bus>::PDATA_Set_GRB()
 {
     /*
      parallel PDATA[23:0] Output Sequence
@@ -3025,7 +3447,8 @@ void ER_TFTM0784::PDATA_Set_GRB()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::PDATA_Set_GBR()
+template<class Bus>
+void RA8876_Driver<Bus>::PDATA_Set_GBR()
 {
     /*
      parallel PDATA[23:0] Output Sequence
@@ -3045,7 +3468,8 @@ void ER_TFTM0784::PDATA_Set_GBR()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::PDATA_Set_BRG()
+template<class Bus>
+void RA8876_Driver<Bus>::PDATA_Set_BRG()
 {
     /*
      parallel PDATA[23:0] Output Sequence
@@ -3064,7 +3488,8 @@ void ER_TFTM0784::PDATA_Set_BRG()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::PDATA_Set_BGR()
+template<class Bus>
+void RA8876_Driver<Bus>::PDATA_Set_BGR()
 {
     /*
      parallel PDATA[23:0] Output Sequence
@@ -3085,7 +3510,8 @@ void ER_TFTM0784::PDATA_Set_BGR()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::PDATA_IDLE_STATE()
+template<class Bus>
+void RA8876_Driver<Bus>::PDATA_IDLE_STATE()
 {
     uint8_t temp;
     
@@ -3098,7 +3524,8 @@ void ER_TFTM0784::PDATA_IDLE_STATE()
 
 
 //[13h]=========================================================================
-void ER_TFTM0784::HSYNC_Low_Active()
+template<class Bus>
+void RA8876_Driver<Bus>::HSYNC_Low_Active()
 {
     /*
      HSYNC Polarity
@@ -3112,7 +3539,8 @@ void ER_TFTM0784::HSYNC_Low_Active()
     temp &= cClrb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::HSYNC_High_Active()
+template<class Bus>
+void RA8876_Driver<Bus>::HSYNC_High_Active()
 {
     /*
      HSYNC Polarity
@@ -3126,7 +3554,8 @@ void ER_TFTM0784::HSYNC_High_Active()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::VSYNC_Low_Active()
+template<class Bus>
+void RA8876_Driver<Bus>::VSYNC_Low_Active()
 {
     /*
      VSYNC Polarity
@@ -3140,7 +3569,8 @@ void ER_TFTM0784::VSYNC_Low_Active()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::VSYNC_High_Active()
+template<class Bus>
+void RA8876_Driver<Bus>::VSYNC_High_Active()
 {
     /*
      VSYNC Polarity
@@ -3154,7 +3584,8 @@ void ER_TFTM0784::VSYNC_High_Active()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::DE_Low_Active()
+template<class Bus>
+void RA8876_Driver<Bus>::DE_Low_Active()
 {
     /*
      DE Polarity
@@ -3168,7 +3599,8 @@ void ER_TFTM0784::DE_Low_Active()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::DE_High_Active()
+template<class Bus>
+void RA8876_Driver<Bus>::DE_High_Active()
 {
     /*
      DE Polarity
@@ -3182,7 +3614,8 @@ void ER_TFTM0784::DE_High_Active()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_DE_Low()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_DE_Low()
 {
     /*
      DE IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3196,7 +3629,8 @@ void ER_TFTM0784::Idle_DE_Low()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_DE_High()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_DE_High()
 {
     /*
      DE IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3210,7 +3644,8 @@ void ER_TFTM0784::Idle_DE_High()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_PCLK_Low()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_PCLK_Low()
 {
     /*
      PCLK IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3224,7 +3659,8 @@ void ER_TFTM0784::Idle_PCLK_Low()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_PCLK_High()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_PCLK_High()
 {
     /*
      PCLK IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3238,7 +3674,8 @@ void ER_TFTM0784::Idle_PCLK_High()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_PDAT_Low()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_PDAT_Low()
 {
     /*
      PDAT IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3252,7 +3689,8 @@ void ER_TFTM0784::Idle_PDAT_Low()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_PDAT_High()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_PDAT_High()
 {
     /*
      PDAT IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3266,7 +3704,8 @@ void ER_TFTM0784::Idle_PDAT_High()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_HSYNC_Low()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_HSYNC_Low()
 {
     /*
      HSYNC IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3280,7 +3719,8 @@ void ER_TFTM0784::Idle_HSYNC_Low()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_HSYNC_High()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_HSYNC_High()
 {
     /*
      HSYNC IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3294,7 +3734,8 @@ void ER_TFTM0784::Idle_HSYNC_High()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_VSYNC_Low()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_VSYNC_Low()
 {
     /*
      VSYNC IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3308,7 +3749,8 @@ void ER_TFTM0784::Idle_VSYNC_Low()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Idle_VSYNC_High()
+template<class Bus>
+void RA8876_Driver<Bus>::Idle_VSYNC_High()
 {
     /*
      VSYNC IDLE STATE(When STANDBY or DISPLAY OFF )
@@ -3324,7 +3766,8 @@ void ER_TFTM0784::Idle_VSYNC_High()
 }
 
 //[14h][15h][1Ah][1Bh]=========================================================================
-void ER_TFTM0784::LCD_HorizontalWidth_VerticalHeight(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_HorizontalWidth_VerticalHeight(uint16_t WX, uint16_t HY)
 {
     /*
      [14h] Horizontal Display Width Setting Bit[7:0]
@@ -3375,7 +3818,8 @@ void ER_TFTM0784::LCD_HorizontalWidth_VerticalHeight(uint16_t WX, uint16_t HY)
     }
 }
 //[16h][17h]=========================================================================
-void ER_TFTM0784::LCD_Horizontal_Non_Display(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_Horizontal_Non_Display(uint16_t WX)
 {
     /*
      [16h] Horizontal Non-Display Period(HNDR) Bit[4:0]
@@ -3410,7 +3854,8 @@ void ER_TFTM0784::LCD_Horizontal_Non_Display(uint16_t WX)
     }
 }
 //[18h]=========================================================================
-void ER_TFTM0784::LCD_HSYNC_Start_Position(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_HSYNC_Start_Position(uint16_t WX)
 {
     /*
      [18h] HSYNC Start Position[4:0]
@@ -3433,7 +3878,8 @@ void ER_TFTM0784::LCD_HSYNC_Start_Position(uint16_t WX)
     }
 }
 //[19h]=========================================================================
-void ER_TFTM0784::LCD_HSYNC_Pulse_Width(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_HSYNC_Pulse_Width(uint16_t WX)
 {
     /*
      [19h] HSYNC Pulse Width(HPW) [4:0]
@@ -3454,7 +3900,8 @@ void ER_TFTM0784::LCD_HSYNC_Pulse_Width(uint16_t WX)
     }
 }
 //[1Ch][1Dh]=========================================================================
-void ER_TFTM0784::LCD_Vertical_Non_Display(uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_Vertical_Non_Display(uint16_t HY)
 {
     /*
      [1Ch] Vertical Non-Display Period Bit[7:0]
@@ -3472,7 +3919,8 @@ void ER_TFTM0784::LCD_Vertical_Non_Display(uint16_t HY)
     LCD_DataWrite(temp >> 8);
 }
 //[1Eh]=========================================================================
-void ER_TFTM0784::LCD_VSYNC_Start_Position(uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_VSYNC_Start_Position(uint16_t HY)
 {
     /*
      [1Eh] VSYNC Start Position[7:0]
@@ -3485,7 +3933,8 @@ void ER_TFTM0784::LCD_VSYNC_Start_Position(uint16_t HY)
     LCD_DataWrite(temp);
 }
 //[1Fh]=========================================================================
-void ER_TFTM0784::LCD_VSYNC_Pulse_Width(uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::LCD_VSYNC_Pulse_Width(uint16_t HY)
 {
     /*
      [1Fh] VSYNC Pulse Width[5:0]
@@ -3498,7 +3947,8 @@ void ER_TFTM0784::LCD_VSYNC_Pulse_Width(uint16_t HY)
     LCD_DataWrite(temp);
 }
 //[20h][21h][22h][23h]=========================================================================
-void ER_TFTM0784::Main_Image_Start_Address(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::Main_Image_Start_Address(uint32_t Addr)
 {
     /*
      [20h] Main Image Start Address[7:2]
@@ -3506,13 +3956,11 @@ void ER_TFTM0784::Main_Image_Start_Address(uint32_t Addr)
      [22h] Main Image Start Address [23:16]
      [23h] Main Image Start Address [31:24]
      */
-    LCD_RegisterWrite(0x20, Addr);
-    LCD_RegisterWrite(0x21, Addr >> 8);
-    LCD_RegisterWrite(0x22, Addr >> 16);
-    LCD_RegisterWrite(0x23, Addr >> 24);
+    LCD_RegisterWrite32(0x20, Addr);
 }
 //[24h][25h]=========================================================================
-void ER_TFTM0784::Main_Image_Width(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::Main_Image_Width(uint16_t WX)
 {
     /*
      [24h] Main Image Width [7:0]
@@ -3521,11 +3969,11 @@ void ER_TFTM0784::Main_Image_Width(uint16_t WX)
      It must be divisible by 4. MIW Bit [1:0] tie to ¡§0¡¨ internally.
      The value is physical pixel number. Maximum value is 8188 pixels
      */
-    LCD_RegisterWrite(0x24, WX);
-    LCD_RegisterWrite(0x25, WX >> 8);
+    LCD_RegisterWrite16(0x24, WX);
 }
 //[26h][27h][28h][29h]=========================================================================
-void ER_TFTM0784::Main_Window_Start_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Main_Window_Start_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [26h] Main Window Upper-Left corner X-coordination [7:0]
@@ -3541,14 +3989,11 @@ void ER_TFTM0784::Main_Window_Start_XY(uint16_t WX, uint16_t HY)
      Unit: Pixel
      Range is between 0 and 8191.
      */
-    LCD_RegisterWrite(0x26, WX);
-    LCD_RegisterWrite(0x27, WX >> 8);
-    
-    LCD_RegisterWrite(0x28, HY);
-    LCD_RegisterWrite(0x29, HY >> 8);
+    LCD_RegisterWriteXY(0x26, WX, HY);
 }
 //[2Ah][2Bh][2Ch][2Dh]=========================================================================
-void ER_TFTM0784::PIP_Display_Start_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::PIP_Display_Start_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [2Ah] PIP Window Display Upper-Left corner X-coordination [7:0]
@@ -3568,14 +4013,11 @@ void ER_TFTM0784::PIP_Display_Start_XY(uint16_t WX, uint16_t HY)
      According to bit of Select Configure PIP 1 or 2 Window¡¦s parameters.
      Function bit will be configured for relative PIP window.
      */
-    LCD_RegisterWrite(0x2A, WX);
-    LCD_RegisterWrite(0x2B, WX >> 8);
-    
-    LCD_RegisterWrite(0x2C, HY);
-    LCD_RegisterWrite(0x2D, HY >> 8);
+    LCD_RegisterWriteXY(0x2A, WX, HY);
 }
 //[2Eh][2Fh][30h][31h]=========================================================================
-void ER_TFTM0784::PIP_Image_Start_Address(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::PIP_Image_Start_Address(uint32_t Addr)
 {
     /*
      [2Eh] PIP Image Start Address[7:2]
@@ -3583,13 +4025,11 @@ void ER_TFTM0784::PIP_Image_Start_Address(uint32_t Addr)
      [30h] PIP Image Start Address [23:16]
      [31h] PIP Image Start Address [31:24]
      */
-    LCD_RegisterWrite(0x2E, Addr);
-    LCD_RegisterWrite(0x2F, Addr >> 8);
-    LCD_RegisterWrite(0x30, Addr >> 16);
-    LCD_RegisterWrite(0x31, Addr >> 24);
+    LCD_RegisterWrite32(0x2E, Addr);
 }
 //[32h][33h]=========================================================================
-void ER_TFTM0784::PIP_Image_Width(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::PIP_Image_Width(uint16_t WX)
 {
     /*
      [32h] PIP Image Width [7:0]
@@ -3601,11 +4041,11 @@ void ER_TFTM0784::PIP_Image_Width(uint16_t WX)
      According to bit of Select Configure PIP 1 or 2 Window¡¦s parameters.
      Function bit will be configured for relative PIP window.
      */
-    LCD_RegisterWrite(0x32, WX);
-    LCD_RegisterWrite(0x33, WX >> 8);
+    LCD_RegisterWrite16(0x32, WX);
 }
 //[34h][35h][36h][37h]=========================================================================
-void ER_TFTM0784::PIP_Window_Image_Start_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::PIP_Window_Image_Start_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [34h] PIP 1 or 2 Window Image Upper-Left corner X-coordination [7:0]
@@ -3625,14 +4065,11 @@ void ER_TFTM0784::PIP_Window_Image_Start_XY(uint16_t WX, uint16_t HY)
      According to bit of Select Configure PIP 1 or 2 Window¡¦s parameters.
      Function bit will be configured for relative PIP window.
      */
-    LCD_RegisterWrite(0x34, WX);
-    LCD_RegisterWrite(0x35, WX >> 8);
-    
-    LCD_RegisterWrite(0x36, HY);
-    LCD_RegisterWrite(0x37, HY >> 8);
+    LCD_RegisterWriteXY(0x34, WX, HY);
 }
 //[38h][39h][3Ah][3Bh]=========================================================================
-void ER_TFTM0784::PIP_Window_Width_Height(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::PIP_Window_Width_Height(uint16_t WX, uint16_t HY)
 {
     /*
      [38h] PIP Window Width [7:0]
@@ -3650,15 +4087,12 @@ void ER_TFTM0784::PIP_Window_Width_Height(uint16_t WX, uint16_t HY)
      According to bit of Select Configure PIP 1 or 2 Window¡¦s parameters.
      Function bit will be configured for relative PIP window.
      */
-    LCD_RegisterWrite(0x38, WX);
-    LCD_RegisterWrite(0x39, WX >> 8);
-    
-    LCD_RegisterWrite(0x3A, HY);
-    LCD_RegisterWrite(0x3B, HY >> 8);
+    LCD_RegisterWriteXY(0x38, WX, HY);
 }
 
 //[3Ch]=========================================================================
-void ER_TFTM0784::Enable_Graphic_Cursor()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_Graphic_Cursor()
 {
     /*
      Graphic Cursor Enable
@@ -3672,7 +4106,8 @@ void ER_TFTM0784::Enable_Graphic_Cursor()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_Graphic_Cursor()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_Graphic_Cursor()
 {
     /*
      Graphic Cursor Enable
@@ -3687,7 +4122,8 @@ void ER_TFTM0784::Disable_Graphic_Cursor()
     LCD_DataWrite(temp);
 }
 //
-void ER_TFTM0784::Select_Graphic_Cursor_1()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_Graphic_Cursor_1()
 {
     /*
      Graphic Cursor Selection Bit
@@ -3705,7 +4141,8 @@ void ER_TFTM0784::Select_Graphic_Cursor_1()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_Graphic_Cursor_2()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_Graphic_Cursor_2()
 {
     /*
      Graphic Cursor Selection Bit
@@ -3723,7 +4160,8 @@ void ER_TFTM0784::Select_Graphic_Cursor_2()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_Graphic_Cursor_3()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_Graphic_Cursor_3()
 {
     /*
      Graphic Cursor Selection Bit
@@ -3741,7 +4179,8 @@ void ER_TFTM0784::Select_Graphic_Cursor_3()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_Graphic_Cursor_4()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_Graphic_Cursor_4()
 {
     /*
      Graphic Cursor Selection Bit
@@ -3760,7 +4199,8 @@ void ER_TFTM0784::Select_Graphic_Cursor_4()
     LCD_DataWrite(temp);
 }
 //
-void ER_TFTM0784::Enable_Text_Cursor()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_Text_Cursor()
 {
     /*
      Text Cursor Enable
@@ -3776,7 +4216,8 @@ void ER_TFTM0784::Enable_Text_Cursor()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_Text_Cursor()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_Text_Cursor()
 {
     /*
      Text Cursor Enable
@@ -3793,7 +4234,8 @@ void ER_TFTM0784::Disable_Text_Cursor()
     LCD_DataWrite(temp);
 }
 //
-void ER_TFTM0784::Enable_Text_Cursor_Blinking()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_Text_Cursor_Blinking()
 {
     /*
      Text Cursor Blinking Enable
@@ -3807,7 +4249,8 @@ void ER_TFTM0784::Enable_Text_Cursor_Blinking()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_Text_Cursor_Blinking()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_Text_Cursor_Blinking()
 {
     /*
      Text Cursor Blinking Enable
@@ -3822,7 +4265,8 @@ void ER_TFTM0784::Disable_Text_Cursor_Blinking()
     LCD_DataWrite(temp);
 }
 //[3Dh]=========================================================================
-void ER_TFTM0784::Blinking_Time_Frames(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Blinking_Time_Frames(uint8_t temp)
 {
     /*
      Text Cursor Blink Time Setting (Unit: Frame)
@@ -3836,7 +4280,8 @@ void ER_TFTM0784::Blinking_Time_Frames(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[3Eh]=========================================================================
-void ER_TFTM0784::Text_Cursor_H_V(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Text_Cursor_H_V(uint16_t WX, uint16_t HY)
 {
     /*
      [3Eh]
@@ -3852,13 +4297,16 @@ void ER_TFTM0784::Text_Cursor_H_V(uint16_t WX, uint16_t HY)
      Note : When font is enlarged, the cursor setting will multiply the
      same times as the font enlargement.
      */
-    LCD_CmdWrite(0x3E);
-    LCD_DataWrite(WX);
-    LCD_CmdWrite(0x3F);
-    LCD_DataWrite(HY);
+    const uint8_t regs[2][2] =
+    {
+        {0x3E, (uint8_t)WX},
+        {0x3F, (uint8_t)HY},
+    };
+    LCD_RegisterWriteList(regs, 2);
 }
 //[40h][41h][42h][43h]=========================================================================
-void ER_TFTM0784::Graphic_Cursor_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Graphic_Cursor_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [40h] Graphic Cursor Horizontal Location[7:0]
@@ -3867,14 +4315,11 @@ void ER_TFTM0784::Graphic_Cursor_XY(uint16_t WX, uint16_t HY)
      [43h] Graphic Cursor Vertical Location[12:8]
      Reference main Window coordination.
      */
-    LCD_RegisterWrite(0x40, WX);
-    LCD_RegisterWrite(0x41, WX >> 8);
-    
-    LCD_RegisterWrite(0x42, HY);
-    LCD_RegisterWrite(0x43, HY >> 8);
+    LCD_RegisterWriteXY(0x40, WX, HY);
 }
 //[44h]=========================================================================
-void ER_TFTM0784::Set_Graphic_Cursor_Color_1(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_Graphic_Cursor_Color_1(uint8_t temp)
 {
     /*
      [44h] Graphic Cursor Color 0 with 256 Colors
@@ -3883,7 +4328,8 @@ void ER_TFTM0784::Set_Graphic_Cursor_Color_1(uint8_t temp)
     LCD_RegisterWrite(0x44, temp);
 }
 //[45h]=========================================================================
-void ER_TFTM0784::Set_Graphic_Cursor_Color_2(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_Graphic_Cursor_Color_2(uint8_t temp)
 {
     /*
      [45h] Graphic Cursor Color 1 with 256 Colors
@@ -3892,7 +4338,8 @@ void ER_TFTM0784::Set_Graphic_Cursor_Color_2(uint8_t temp)
     LCD_RegisterWrite(0x45, temp);
 }
 //[50h][51h][52h][53h]=========================================================================
-void ER_TFTM0784::Canvas_Image_Start_address(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::Canvas_Image_Start_address(uint32_t Addr)
 {
     /*
      [50h] Start address of Canvas [7:0]
@@ -3900,23 +4347,21 @@ void ER_TFTM0784::Canvas_Image_Start_address(uint32_t Addr)
      [52h] Start address of Canvas [23:16]
      [53h] Start address of Canvas [31:24]
      */
-    LCD_RegisterWrite(0x50, Addr);
-    LCD_RegisterWrite(0x51, Addr >> 8);
-    LCD_RegisterWrite(0x52, Addr >> 16);
-    LCD_RegisterWrite(0x53, Addr >> 24);
+    LCD_RegisterWrite32(0x50, Addr);
 }
 //[54h][55h]=========================================================================
-void ER_TFTM0784::Canvas_image_width(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::Canvas_image_width(uint16_t WX)
 {
     /*
      [54h] Canvas image width [7:2]
      [55h] Canvas image width [12:8]
      */
-    LCD_RegisterWrite(0x54, WX);
-    LCD_RegisterWrite(0x55, WX >> 8);
+    LCD_RegisterWrite16(0x54, WX);
 }
 //[56h][57h][58h][59h]=========================================================================
-void ER_TFTM0784::Active_Window_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Active_Window_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [56h] Active Window Upper-Left corner X-coordination [7:0]
@@ -3924,14 +4369,11 @@ void ER_TFTM0784::Active_Window_XY(uint16_t WX, uint16_t HY)
      [58h] Active Window Upper-Left corner Y-coordination [7:0]
      [59h] Active Window Upper-Left corner Y-coordination [12:8]
      */
-    LCD_RegisterWrite(0x56, WX);
-    LCD_RegisterWrite(0x57, WX >> 8);
-    
-    LCD_RegisterWrite(0x58, HY);
-    LCD_RegisterWrite(0x59, HY >> 8);
+    LCD_RegisterWriteXY(0x56, WX, HY);
 }
 //[5Ah][5Bh][5Ch][5Dh]=========================================================================
-void ER_TFTM0784::Active_Window_WH(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Active_Window_WH(uint16_t WX, uint16_t HY)
 {
     /*
      [5Ah] Width of Active Window [7:0]
@@ -3939,14 +4381,11 @@ void ER_TFTM0784::Active_Window_WH(uint16_t WX, uint16_t HY)
      [5Ch] Height of Active Window [7:0]
      [5Dh] Height of Active Window [12:8]
      */
-    LCD_RegisterWrite(0x5A, WX);
-    LCD_RegisterWrite(0x5B, WX >> 8);
-    
-    LCD_RegisterWrite(0x5C, HY);
-    LCD_RegisterWrite(0x5D, HY >> 8);
+    LCD_RegisterWriteXY(0x5A, WX, HY);
 }
 //[5Eh]=========================================================================
-void ER_TFTM0784::Select_Write_Data_Position()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_Write_Data_Position()
 {
     /*
      Select to read back Graphic Read/Write position
@@ -3960,7 +4399,8 @@ void ER_TFTM0784::Select_Write_Data_Position()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_Read_Data_Position()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_Read_Data_Position()
 {
     /*
      Select to read back Graphic Read/Write position
@@ -3974,7 +4414,8 @@ void ER_TFTM0784::Select_Read_Data_Position()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Memory_XY_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Memory_XY_Mode()
 {
     /*
      Canvas addressing mode
@@ -3988,7 +4429,8 @@ void ER_TFTM0784::Memory_XY_Mode()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Memory_Linear_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Memory_Linear_Mode()
 {
     /*
      Canvas addressing mode
@@ -4002,7 +4444,8 @@ void ER_TFTM0784::Memory_Linear_Mode()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Memory_8bpp_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Memory_8bpp_Mode()
 {
     /*
      Canvas image¡¦s color depth & memory R/W data width
@@ -4022,7 +4465,8 @@ void ER_TFTM0784::Memory_8bpp_Mode()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Memory_16bpp_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Memory_16bpp_Mode()
 {
     /*
      Canvas image¡¦s color depth & memory R/W data width
@@ -4042,7 +4486,8 @@ void ER_TFTM0784::Memory_16bpp_Mode()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Memory_24bpp_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Memory_24bpp_Mode()
 {
     /*
      Canvas image¡¦s color depth & memory R/W data width
@@ -4064,7 +4509,8 @@ void ER_TFTM0784::Memory_24bpp_Mode()
 }
 
 //[5Fh][60h][61h][62h]=========================================================================
-void ER_TFTM0784::Goto_Pixel_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Goto_Pixel_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [Write]: Set Graphic Read/Write position
@@ -4077,23 +4523,18 @@ void ER_TFTM0784::Goto_Pixel_XY(uint16_t WX, uint16_t HY)
      Vertical Position [12:8][7:0].
      Reference Canvas image coordination. Unit: Pixel
      */
-    LCD_RegisterWrite(0x5F, WX);
-    LCD_RegisterWrite(0x60, WX >> 8);
-    
-    LCD_RegisterWrite(0x61, HY);
-    LCD_RegisterWrite(0x62, HY >> 8);
+    LCD_RegisterWriteXY(0x5F, WX, HY);
 }
-void ER_TFTM0784::Goto_Linear_Addr(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::Goto_Linear_Addr(uint32_t Addr)
 {
-    LCD_RegisterWrite(0x5F, Addr);
-    LCD_RegisterWrite(0x60, Addr >> 8);
-    LCD_RegisterWrite(0x61, Addr >> 16);
-    LCD_RegisterWrite(0x62, Addr >> 24);
+    LCD_RegisterWrite32(0x5F, Addr);
 }
 
 
 //[63h][64h][65h][66h]=========================================================================
-void ER_TFTM0784::Goto_Text_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Goto_Text_XY(uint16_t WX, uint16_t HY)
 {
     /*
      Write: Set Text Write position
@@ -4103,11 +4544,7 @@ void ER_TFTM0784::Goto_Text_XY(uint16_t WX, uint16_t HY)
      Reference Canvas image coordination.
      Unit: Pixel
      */
-    LCD_RegisterWrite(0x63, WX);
-    LCD_RegisterWrite(0x64, WX >> 8);
-    
-    LCD_RegisterWrite(0x65, HY);
-    LCD_RegisterWrite(0x66, HY >> 8);
+    LCD_RegisterWriteXY(0x63, WX, HY);
 }
 //[67h]=========================================================================
 /*
@@ -4125,28 +4562,32 @@ void ER_TFTM0784::Goto_Text_XY(uint16_t WX, uint16_t HY)
  0 : Draw Line
  1 : Draw Triangle
  */
-void ER_TFTM0784::Start_Line()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Line()
 {
     LCD_CmdWrite(0x67);
     LCD_DataWrite(0x80);
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Triangle()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Triangle()
 {
     LCD_CmdWrite(0x67);
     LCD_DataWrite(0x82);//B1000_0010
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Triangle_Fill()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Triangle_Fill()
 {
     
     LCD_CmdWrite(0x67);
     LCD_DataWrite(0xA2);//B1010_0010
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
 //[68h][69h][6Ah][6Bh]=========================================================================
 //½u°_ÂI
-void ER_TFTM0784::Line_Start_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Line_Start_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [68h] Draw Line/Square/Triangle Start X-coordination [7:0]
@@ -4154,21 +4595,12 @@ void ER_TFTM0784::Line_Start_XY(uint16_t WX, uint16_t HY)
      [6Ah] Draw Line/Square/Triangle Start Y-coordination [7:0]
      [6Bh] Draw Line/Square/Triangle Start Y-coordination [12:8]
      */
-    LCD_CmdWrite(0x68);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x69);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x6A);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x6B);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x68, WX, HY);
 }
 //[6Ch][6Dh][6Eh][6Fh]=========================================================================
 //½u²×ÂI
-void ER_TFTM0784::Line_End_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Line_End_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [6Ch] Draw Line/Square/Triangle End X-coordination [7:0]
@@ -4176,21 +4608,12 @@ void ER_TFTM0784::Line_End_XY(uint16_t WX, uint16_t HY)
      [6Eh] Draw Line/Square/Triangle End Y-coordination [7:0]
      [6Fh] Draw Line/Square/Triangle End Y-coordination [12:8]
      */
-    LCD_CmdWrite(0x6C);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x6D);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x6E);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x6F);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x6C, WX, HY);
 }
 //[68h]~[73h]=========================================================================
 //¤T¨¤-ÂI1
-void ER_TFTM0784::Triangle_Point1_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Triangle_Point1_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [68h] Draw Line/Square/Triangle Start X-coordination [7:0]
@@ -4198,20 +4621,11 @@ void ER_TFTM0784::Triangle_Point1_XY(uint16_t WX, uint16_t HY)
      [6Ah] Draw Line/Square/Triangle Start Y-coordination [7:0]
      [6Bh] Draw Line/Square/Triangle Start Y-coordination [12:8]
      */
-    LCD_CmdWrite(0x68);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x69);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x6A);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x6B);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x68, WX, HY);
 }
 //¤T¨¤-ÂI2
-void ER_TFTM0784::Triangle_Point2_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Triangle_Point2_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [6Ch] Draw Line/Square/Triangle End X-coordination [7:0]
@@ -4219,20 +4633,11 @@ void ER_TFTM0784::Triangle_Point2_XY(uint16_t WX, uint16_t HY)
      [6Eh] Draw Line/Square/Triangle End Y-coordination [7:0]
      [6Fh] Draw Line/Square/Triangle End Y-coordination [12:8]
      */
-    LCD_CmdWrite(0x6C);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x6D);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x6E);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x6F);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x6C, WX, HY);
 }
 //¤T¨¤-ÂI3
-void ER_TFTM0784::Triangle_Point3_XY (uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Triangle_Point3_XY (uint16_t WX, uint16_t HY)
 {
     /*
      [70h] Draw Triangle Point 3 X-coordination [7:0]
@@ -4240,20 +4645,11 @@ void ER_TFTM0784::Triangle_Point3_XY (uint16_t WX, uint16_t HY)
      [72h] Draw Triangle Point 3 Y-coordination [7:0]
      [73h] Draw Triangle Point 3 Y-coordination [12:8]
      */
-    LCD_CmdWrite(0x70);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x71);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x72);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x73);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x70, WX, HY);
 }
 //¤è°_ÂI
-void ER_TFTM0784::Square_Start_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Square_Start_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [68h] Draw Line/Square/Triangle Start X-coordination [7:0]
@@ -4261,20 +4657,11 @@ void ER_TFTM0784::Square_Start_XY(uint16_t WX, uint16_t HY)
      [6Ah] Draw Line/Square/Triangle Start Y-coordination [7:0]
      [6Bh] Draw Line/Square/Triangle Start Y-coordination [12:8]
      */
-    LCD_CmdWrite(0x68);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x69);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x6A);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x6B);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x68, WX, HY);
 }
 //¤è²×ÂI
-void ER_TFTM0784::Square_End_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Square_End_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [6Ch] Draw Line/Square/Triangle End X-coordination [7:0]
@@ -4282,17 +4669,7 @@ void ER_TFTM0784::Square_End_XY(uint16_t WX, uint16_t HY)
      [6Eh] Draw Line/Square/Triangle End Y-coordination [7:0]
      [6Fh] Draw Line/Square/Triangle End Y-coordination [12:8]
      */
-    LCD_CmdWrite(0x6C);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x6D);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x6E);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x6F);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x6C, WX, HY);
 }
 //[76h]=========================================================================
 /*
@@ -4321,96 +4698,111 @@ void ER_TFTM0784::Square_End_XY(uint16_t WX, uint16_t HY)
  10 :
  11 :
  */
-void ER_TFTM0784::Start_Circle_or_Ellipse()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Circle_or_Ellipse()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0x80);//B1000_XXXX
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Circle_or_Ellipse_Fill()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Circle_or_Ellipse_Fill()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0xC0);//B1100_XXXX
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
 //
-void ER_TFTM0784::Start_Left_Down_Curve()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Left_Down_Curve()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0x90);//B1001_XX00
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Left_Up_Curve()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Left_Up_Curve()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0x91);//B1001_XX01
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Right_Up_Curve()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Right_Up_Curve()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0x92);//B1001_XX10
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Right_Down_Curve()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Right_Down_Curve()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0x93);//B1001_XX11
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
 //
-void ER_TFTM0784::Start_Left_Down_Curve_Fill()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Left_Down_Curve_Fill()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0xD0);//B1101_XX00
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Left_Up_Curve_Fill()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Left_Up_Curve_Fill()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0xD1);//B1101_XX01
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Right_Up_Curve_Fill()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Right_Up_Curve_Fill()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0xD2);//B1101_XX10
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Right_Down_Curve_Fill()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Right_Down_Curve_Fill()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0xD3);//B1101_XX11
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
 //
-void ER_TFTM0784::Start_Square()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Square()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0xA0);//B1010_XXXX
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Square_Fill()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Square_Fill()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0xE0);//B1110_XXXX
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Circle_Square()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Circle_Square()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0xB0);//B1011_XXXX
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
-void ER_TFTM0784::Start_Circle_Square_Fill()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_Circle_Square_Fill()
 {
     LCD_CmdWrite(0x76);
     LCD_DataWrite(0xF0);//B1111_XXXX
-    Check_Busy_Draw();
+    engine_8876 = RA8876_ENGINE_DRAW;
 }
 //[77h]~[7Eh]=========================================================================
 //¶ê¤¤¤ß
-void ER_TFTM0784::Circle_Center_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Circle_Center_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [7Bh] Draw Circle/Ellipse/Circle Square Center X-coordination [7:0]
@@ -4418,20 +4810,11 @@ void ER_TFTM0784::Circle_Center_XY(uint16_t WX, uint16_t HY)
      [7Dh] Draw Circle/Ellipse/Circle Square Center Y-coordination [7:0]
      [7Eh] Draw Circle/Ellipse/Circle Square Center Y-coordination [12:8]
      */
-    LCD_CmdWrite(0x7B);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x7C);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x7D);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x7E);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x7B, WX, HY);
 }
 //¾ò¶ê¤¤¤ß
-void ER_TFTM0784::Ellipse_Center_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Ellipse_Center_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [7Bh] Draw Circle/Ellipse/Circle Square Center X-coordination [7:0]
@@ -4439,20 +4822,11 @@ void ER_TFTM0784::Ellipse_Center_XY(uint16_t WX, uint16_t HY)
      [7Dh] Draw Circle/Ellipse/Circle Square Center Y-coordination [7:0]
      [7Eh] Draw Circle/Ellipse/Circle Square Center Y-coordination [12:8]
      */
-    LCD_CmdWrite(0x7B);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x7C);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x7D);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x7E);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x7B, WX, HY);
 }
 //¶ê¥b®|
-void ER_TFTM0784::Circle_Radius_R(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::Circle_Radius_R(uint16_t WX)
 {
     /*
      [77h] Draw Circle/Ellipse/Circle Square Major radius [7:0]
@@ -4460,21 +4834,12 @@ void ER_TFTM0784::Circle_Radius_R(uint16_t WX)
      [79h] Draw Circle/Ellipse/Circle Square Minor radius [7:0]
      [7Ah] Draw Circle/Ellipse/Circle Square Minor radius [12:8]
      */
-    LCD_CmdWrite(0x77);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x78);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x79);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x7A);
-    LCD_DataWrite(WX >> 8);
+    LCD_RegisterWriteXY(0x77, WX, WX);
 }
 
 //¾ò¶ê¥b®|
-void ER_TFTM0784::Ellipse_Radius_RxRy(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Ellipse_Radius_RxRy(uint16_t WX, uint16_t HY)
 {
     /*
      [77h] Draw Circle/Ellipse/Circle Square Major radius [7:0]
@@ -4482,21 +4847,12 @@ void ER_TFTM0784::Ellipse_Radius_RxRy(uint16_t WX, uint16_t HY)
      [79h] Draw Circle/Ellipse/Circle Square Minor radius [7:0]
      [7Ah] Draw Circle/Ellipse/Circle Square Minor radius [12:8]
      */
-    LCD_CmdWrite(0x77);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x78);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x79);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x7A);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x77, WX, HY);
 }
 
 //¤è§ÎÂà¨¤¥b®|
-void ER_TFTM0784::Circle_Square_Radius_RxRy(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::Circle_Square_Radius_RxRy(uint16_t WX, uint16_t HY)
 {
     /*
      [77h] Draw Circle/Ellipse/Circle Square Major radius [7:0]
@@ -4504,21 +4860,12 @@ void ER_TFTM0784::Circle_Square_Radius_RxRy(uint16_t WX, uint16_t HY)
      [79h] Draw Circle/Ellipse/Circle Square Minor radius [7:0]
      [7Ah] Draw Circle/Ellipse/Circle Square Minor radius [12:8]
      */
-    LCD_CmdWrite(0x77);
-    LCD_DataWrite(WX);
-    
-    LCD_CmdWrite(0x78);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0x79);
-    LCD_DataWrite(HY);
-    
-    LCD_CmdWrite(0x7A);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0x77, WX, HY);
 }
 
 //[84h]=========================================================================
-void ER_TFTM0784::Set_PWM_Prescaler_1_to_256(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_PWM_Prescaler_1_to_256(uint16_t WX)
 {
     /*
      PWM Prescaler Register
@@ -4530,7 +4877,8 @@ void ER_TFTM0784::Set_PWM_Prescaler_1_to_256(uint16_t WX)
     LCD_DataWrite(WX);
 }
 //[85h]=========================================================================
-void ER_TFTM0784::Select_PWM1_Clock_Divided_By_1()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM1_Clock_Divided_By_1()
 {
     /*
      Select MUX input for PWM Timer 1.
@@ -4544,7 +4892,8 @@ void ER_TFTM0784::Select_PWM1_Clock_Divided_By_1()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM1_Clock_Divided_By_2()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM1_Clock_Divided_By_2()
 {
     /*
      Select MUX input for PWM Timer 1.
@@ -4558,7 +4907,8 @@ void ER_TFTM0784::Select_PWM1_Clock_Divided_By_2()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM1_Clock_Divided_By_4()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM1_Clock_Divided_By_4()
 {
     /*
      Select MUX input for PWM Timer 1.
@@ -4572,7 +4922,8 @@ void ER_TFTM0784::Select_PWM1_Clock_Divided_By_4()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM1_Clock_Divided_By_8()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM1_Clock_Divided_By_8()
 {
     /*
      Select MUX input for PWM Timer 1.
@@ -4586,7 +4937,8 @@ void ER_TFTM0784::Select_PWM1_Clock_Divided_By_8()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM0_Clock_Divided_By_1()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM0_Clock_Divided_By_1()
 {
     /*
      Select MUX input for PWM Timer 0.
@@ -4600,7 +4952,8 @@ void ER_TFTM0784::Select_PWM0_Clock_Divided_By_1()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM0_Clock_Divided_By_2()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM0_Clock_Divided_By_2()
 {
     /*
      Select MUX input for PWM Timer 0.
@@ -4614,7 +4967,8 @@ void ER_TFTM0784::Select_PWM0_Clock_Divided_By_2()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM0_Clock_Divided_By_4()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM0_Clock_Divided_By_4()
 {
     /*
      Select MUX input for PWM Timer 0.
@@ -4628,7 +4982,8 @@ void ER_TFTM0784::Select_PWM0_Clock_Divided_By_4()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM0_Clock_Divided_By_8()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM0_Clock_Divided_By_8()
 {
     /*
      Select MUX input for PWM Timer 0.
@@ -4650,7 +5005,8 @@ void ER_TFTM0784::Select_PWM0_Clock_Divided_By_8()
  11: XPWM[1] output oscillator clock
  //If XTEST[0] set high, then XPWM[1] will become panel scan clock input.
  */
-void ER_TFTM0784::Select_PWM1_is_ErrorFlag()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM1_is_ErrorFlag()
 {
     uint8_t temp;
     
@@ -4659,7 +5015,8 @@ void ER_TFTM0784::Select_PWM1_is_ErrorFlag()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM1()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM1()
 {
     uint8_t temp;
     
@@ -4669,7 +5026,8 @@ void ER_TFTM0784::Select_PWM1()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM1_is_Osc_Clock()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM1_is_Osc_Clock()
 {
     uint8_t temp;
     
@@ -4686,7 +5044,8 @@ void ER_TFTM0784::Select_PWM1_is_Osc_Clock()
  10: XPWM[0] enabled and controlled by PWM timer 0
  11: XPWM[0] output core clock
  */
-void ER_TFTM0784::Select_PWM0_is_GPIO_C7()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM0_is_GPIO_C7()
 {
     uint8_t temp;
     
@@ -4695,7 +5054,8 @@ void ER_TFTM0784::Select_PWM0_is_GPIO_C7()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM0()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM0()
 {
     uint8_t temp;
     
@@ -4705,7 +5065,8 @@ void ER_TFTM0784::Select_PWM0()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_PWM0_is_Core_Clock()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_PWM0_is_Core_Clock()
 {
     uint8_t temp;
     
@@ -4717,7 +5078,8 @@ void ER_TFTM0784::Select_PWM0_is_Core_Clock()
 }
 //[86h]=========================================================================
 //[86h]PWM1
-void ER_TFTM0784::Enable_PWM1_Inverter()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PWM1_Inverter()
 {
     /*
      PWM Timer 1 output inverter on/off.
@@ -4731,7 +5093,8 @@ void ER_TFTM0784::Enable_PWM1_Inverter()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_PWM1_Inverter()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_PWM1_Inverter()
 {
     /*
      PWM Timer 1 output inverter on/off.
@@ -4745,7 +5108,8 @@ void ER_TFTM0784::Disable_PWM1_Inverter()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Auto_Reload_PWM1()
+template<class Bus>
+void RA8876_Driver<Bus>::Auto_Reload_PWM1()
 {
     /*
      PWM Timer 1 auto reload on/off
@@ -4759,7 +5123,8 @@ void ER_TFTM0784::Auto_Reload_PWM1()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::One_Shot_PWM1()
+template<class Bus>
+void RA8876_Driver<Bus>::One_Shot_PWM1()
 {
     /*
      PWM Timer 1 auto reload on/off
@@ -4773,7 +5138,8 @@ void ER_TFTM0784::One_Shot_PWM1()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Start_PWM1()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_PWM1()
 {
     /*
      PWM Timer 1 start/stop
@@ -4787,7 +5153,8 @@ void ER_TFTM0784::Start_PWM1()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Stop_PWM1()
+template<class Bus>
+void RA8876_Driver<Bus>::Stop_PWM1()
 {
     /*
      PWM Timer 1 start/stop
@@ -4802,7 +5169,8 @@ void ER_TFTM0784::Stop_PWM1()
     LCD_DataWrite(temp);
 }
 //[86h]PWM0
-void ER_TFTM0784::Enable_PWM0_Dead_Zone()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PWM0_Dead_Zone()
 {
     /*
      PWM Timer 0 Dead zone enable
@@ -4814,7 +5182,8 @@ void ER_TFTM0784::Enable_PWM0_Dead_Zone()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_PWM0_Dead_Zone()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_PWM0_Dead_Zone()
 {
     /*
      PWM Timer 0 Dead zone enable
@@ -4826,7 +5195,8 @@ void ER_TFTM0784::Disable_PWM0_Dead_Zone()
     temp &= cClrb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Enable_PWM0_Inverter()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_PWM0_Inverter()
 {
     /*
      PWM Timer 0 output inverter on/off
@@ -4840,7 +5210,8 @@ void ER_TFTM0784::Enable_PWM0_Inverter()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_PWM0_Inverter()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_PWM0_Inverter()
 {
     /*
      PWM Timer 0 output inverter on/off
@@ -4854,7 +5225,8 @@ void ER_TFTM0784::Disable_PWM0_Inverter()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Auto_Reload_PWM0()
+template<class Bus>
+void RA8876_Driver<Bus>::Auto_Reload_PWM0()
 {
     /*
      PWM Timer 0 auto reload on/off
@@ -4868,7 +5240,8 @@ void ER_TFTM0784::Auto_Reload_PWM0()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::One_Shot_PWM0()
+template<class Bus>
+void RA8876_Driver<Bus>::One_Shot_PWM0()
 {
     /*
      PWM Timer 1 auto reload on/off
@@ -4882,7 +5255,8 @@ void ER_TFTM0784::One_Shot_PWM0()
     temp &= cClrb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Start_PWM0()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_PWM0()
 {
     /*
      PWM Timer 0 start/stop
@@ -4896,7 +5270,8 @@ void ER_TFTM0784::Start_PWM0()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Stop_PWM0()
+template<class Bus>
+void RA8876_Driver<Bus>::Stop_PWM0()
 {
     /*
      PWM Timer 0 start/stop
@@ -4911,7 +5286,8 @@ void ER_TFTM0784::Stop_PWM0()
     LCD_DataWrite(temp);
 }
 //[87h]=========================================================================
-void ER_TFTM0784::Set_Timer0_Dead_Zone_Length(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_Timer0_Dead_Zone_Length(uint8_t temp)
 {
     /*
      Timer 0 Dead zone length register
@@ -4922,7 +5298,8 @@ void ER_TFTM0784::Set_Timer0_Dead_Zone_Length(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[88h][89h]=========================================================================
-void ER_TFTM0784::Set_Timer0_Compare_Buffer(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_Timer0_Compare_Buffer(uint16_t WX)
 {
     /*
      Timer 0 compare buffer register
@@ -4930,13 +5307,11 @@ void ER_TFTM0784::Set_Timer0_Compare_Buffer(uint16_t WX)
      When timer counter equal or less than compare buffer register will cause PWM out
      high level if inv_on bit is off.
      */
-    LCD_CmdWrite(0x88);
-    LCD_DataWrite(WX);
-    LCD_CmdWrite(0x89);
-    LCD_DataWrite(WX >> 8);
+    LCD_RegisterWrite16(0x88, WX);
 }
 //[8Ah][8Bh]=========================================================================
-void ER_TFTM0784::Set_Timer0_Count_Buffer(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_Timer0_Count_Buffer(uint16_t WX)
 {
     /*
      Timer 0 count buffer register
@@ -4944,13 +5319,11 @@ void ER_TFTM0784::Set_Timer0_Count_Buffer(uint16_t WX)
      When timer counter equal to 0 will cause PWM timer reload Count buffer register if reload_en bit set as enable.
      It may read back timer counter¡¦s real time value when PWM timer start.
      */
-    LCD_CmdWrite(0x8A);
-    LCD_DataWrite(WX);
-    LCD_CmdWrite(0x8B);
-    LCD_DataWrite(WX >> 8);
+    LCD_RegisterWrite16(0x8A, WX);
 }
 //[8Ch][8Dh]=========================================================================
-void ER_TFTM0784::Set_Timer1_Compare_Buffer(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_Timer1_Compare_Buffer(uint16_t WX)
 {
     /*
      Timer 0 compare buffer register
@@ -4958,13 +5331,11 @@ void ER_TFTM0784::Set_Timer1_Compare_Buffer(uint16_t WX)
      When timer counter equal or less than compare buffer register will cause PWM out
      high level if inv_on bit is off.
      */
-    LCD_CmdWrite(0x8C);
-    LCD_DataWrite(WX);
-    LCD_CmdWrite(0x8D);
-    LCD_DataWrite(WX >> 8);
+    LCD_RegisterWrite16(0x8C, WX);
 }
 //[8Eh][8Fh]=========================================================================
-void ER_TFTM0784::Set_Timer1_Count_Buffer(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_Timer1_Count_Buffer(uint16_t WX)
 {
     /*
      Timer 0 count buffer register
@@ -4972,17 +5343,15 @@ void ER_TFTM0784::Set_Timer1_Count_Buffer(uint16_t WX)
      When timer counter equal to 0 will cause PWM timer reload Count buffer register if reload_en bit set as enable.
      It may read back timer counter¡¦s real time value when PWM timer start.
      */
-    LCD_CmdWrite(0x8E);
-    LCD_DataWrite(WX);
-    LCD_CmdWrite(0x8F);
-    LCD_DataWrite(WX >> 8);
+    LCD_RegisterWrite16(0x8E, WX);
 }
 
 
 //[90h]~[B5h]=========================================================================
 
 //[90h]=========================================================================
-void ER_TFTM0784::BTE_Enable()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Enable()
 {
     /*
      BTE Function Enable
@@ -4990,14 +5359,20 @@ void ER_TFTM0784::BTE_Enable()
      1 : BTE Function enable.
      */
     uint8_t temp;
+    if (bteOp_8876 == RA8876_BTE_OP_UNKNOWN)
+        bteOp_8876 = LCD_RegisterRead(0x91) & 0x0F;
+    uint8_t op = bteOp_8876;
     LCD_CmdWrite(0x90);
     temp = LCD_DataRead();
     temp |= cSetb4 ;
     LCD_DataWrite(temp);
+    // MPU write/read, transparent write, colour expansion, alpha write
+    engine_8876 = ((1 << op) & 0x0B13) ? RA8876_ENGINE_BTE_MCU : RA8876_ENGINE_BTE;
 }
 
 //[90h]=========================================================================
-void ER_TFTM0784::BTE_Disable()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Disable()
 {
     /*
      BTE Function Enable
@@ -5012,7 +5387,8 @@ void ER_TFTM0784::BTE_Disable()
 }
 
 //[90h]=========================================================================
-void ER_TFTM0784::Check_BTE_Busy()
+template<class Bus>
+void RA8876_Driver<Bus>::Check_BTE_Busy()
 {
     /*
      BTE Function Status
@@ -5021,14 +5397,32 @@ void ER_TFTM0784::Check_BTE_Busy()
      */
     uint8_t temp;
     uint32_t timer = millis() + 100;
+    if (engine_8876 != RA8876_ENGINE_DMA)
+        engine_8876 = RA8876_ENGINE_IDLE;
+    if (list_8876)
+    {
+        list_8876->wait(RA8876_ENGINE_BTE);
+        return;
+    }
+    RA8876_WAIT(RA8876_WAIT_BTE);
+    if (irq_8876)
+    {
+        do
+        {
+            RA8876_POLL();
+        } while (engineIrqStep(false) && (timer > millis()));
+        return;
+    }
     do
     {
+        RA8876_POLL();
         temp = LCD_StatusRead();
     } while ((temp & 0x08) && (timer > millis()));
     
 }
 //[90h]=========================================================================
-void ER_TFTM0784::Pattern_Format_8X8()
+template<class Bus>
+void RA8876_Driver<Bus>::Pattern_Format_8X8()
 {
     /*
      Pattern Format
@@ -5042,7 +5436,8 @@ void ER_TFTM0784::Pattern_Format_8X8()
     LCD_DataWrite(temp);
 }
 //[90h]=========================================================================
-void ER_TFTM0784::Pattern_Format_16X16()
+template<class Bus>
+void RA8876_Driver<Bus>::Pattern_Format_16X16()
 {
     /*
      Pattern Format
@@ -5057,7 +5452,8 @@ void ER_TFTM0784::Pattern_Format_16X16()
 }
 
 //[91h]=========================================================================
-void ER_TFTM0784::BTE_ROP_Code(uint8_t setx)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_ROP_Code(uint8_t setx)
 {
     /*
      BTE ROP Code[Bit7:4]
@@ -5088,7 +5484,8 @@ void ER_TFTM0784::BTE_ROP_Code(uint8_t setx)
 }
 
 //[91h]=========================================================================
-void ER_TFTM0784::BTE_Operation_Code(uint8_t setx)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Operation_Code(uint8_t setx)
 {
     /*
      BTE Operation Code[Bit3:0]
@@ -5116,10 +5513,12 @@ void ER_TFTM0784::BTE_Operation_Code(uint8_t setx)
     temp &= 0xf0 ;
     temp |= setx ;
     LCD_DataWrite(temp);
+    bteOp_8876 = setx & 0x0F;
     
 }
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_S0_Color_8bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S0_Color_8bpp()
 {
     /*
      S0 Color Depth
@@ -5135,7 +5534,8 @@ void ER_TFTM0784::BTE_S0_Color_8bpp()
     LCD_DataWrite(temp);
 }
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_S0_Color_16bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S0_Color_16bpp()
 {
     /*
      S0 Color Depth
@@ -5152,7 +5552,8 @@ void ER_TFTM0784::BTE_S0_Color_16bpp()
     
 }
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_S0_Color_24bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S0_Color_24bpp()
 {
     /*
      S0 Color Depth
@@ -5168,7 +5569,8 @@ void ER_TFTM0784::BTE_S0_Color_24bpp()
     LCD_DataWrite(temp);
 }
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_S1_Color_8bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S1_Color_8bpp()
 {
     /*
      S1 Color Depth
@@ -5188,7 +5590,8 @@ void ER_TFTM0784::BTE_S1_Color_8bpp()
     LCD_DataWrite(temp);
 }
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_S1_Color_16bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S1_Color_16bpp()
 {
     /*
      S1 Color Depth
@@ -5209,7 +5612,8 @@ void ER_TFTM0784::BTE_S1_Color_16bpp()
     
 }
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_S1_Color_24bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S1_Color_24bpp()
 {
     /*
      S1 Color Depth
@@ -5230,7 +5634,8 @@ void ER_TFTM0784::BTE_S1_Color_24bpp()
 }
 
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_S1_Color_Constant()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S1_Color_Constant()
 {
     /*
      S1 Color Depth
@@ -5253,7 +5658,8 @@ void ER_TFTM0784::BTE_S1_Color_Constant()
 
 
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_S1_Color_8bit_Alpha()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S1_Color_8bit_Alpha()
 {
     /*
      S1 Color Depth
@@ -5274,7 +5680,8 @@ void ER_TFTM0784::BTE_S1_Color_8bit_Alpha()
 }
 
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_S1_Color_16bit_Alpha()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S1_Color_16bit_Alpha()
 {
     /*
      S1 Color Depth
@@ -5295,7 +5702,8 @@ void ER_TFTM0784::BTE_S1_Color_16bit_Alpha()
 }
 
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_Destination_Color_8bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Destination_Color_8bpp()
 {
     /*
      Destination Color Depth
@@ -5311,7 +5719,8 @@ void ER_TFTM0784::BTE_Destination_Color_8bpp()
     LCD_DataWrite(temp);
 }
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_Destination_Color_16bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Destination_Color_16bpp()
 {
     /*
      Destination Color Depth
@@ -5328,7 +5737,8 @@ void ER_TFTM0784::BTE_Destination_Color_16bpp()
     
 }
 //[92h]=========================================================================
-void ER_TFTM0784::BTE_Destination_Color_24bpp()
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Destination_Color_24bpp()
 {
     /*
      Destination Color Depth
@@ -5346,7 +5756,8 @@ void ER_TFTM0784::BTE_Destination_Color_24bpp()
 
 
 //[93h][94h][95h][96h]=========================================================================
-void ER_TFTM0784::BTE_S0_Memory_Start_Address(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S0_Memory_Start_Address(uint32_t Addr)
 {
     /*
      [93h] BTE S0 Memory Start Address [7:0]
@@ -5355,15 +5766,13 @@ void ER_TFTM0784::BTE_S0_Memory_Start_Address(uint32_t Addr)
      [96h] BTE S0 Memory Start Address [31:24]
      Bit [1:0] tie to ¡§0¡¨ internally.
      */
-    LCD_RegisterWrite(0x93, Addr);
-    LCD_RegisterWrite(0x94, Addr >> 8);
-    LCD_RegisterWrite(0x95, Addr >> 16);
-    LCD_RegisterWrite(0x96, Addr >> 24);
+    LCD_RegisterWrite32(0x93, Addr);
 }
 
 
 //[97h][98h]=========================================================================
-void ER_TFTM0784::BTE_S0_Image_Width(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S0_Image_Width(uint16_t WX)
 {
     /*
      [97h] BTE S0 Image Width [7:0]
@@ -5371,13 +5780,13 @@ void ER_TFTM0784::BTE_S0_Image_Width(uint16_t WX)
      Unit: Pixel.
      Bit [1:0] tie to ¡§0¡¨ internally.
      */
-    LCD_RegisterWrite(0x97, WX);
-    LCD_RegisterWrite(0x98, WX >> 8);
+    LCD_RegisterWrite16(0x97, WX);
 }
 
 
 //[99h][9Ah][9Bh][9Ch]=========================================================================
-void ER_TFTM0784::BTE_S0_Window_Start_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S0_Window_Start_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [99h] BTE S0 Window Upper-Left corner X-coordination [7:0]
@@ -5385,18 +5794,15 @@ void ER_TFTM0784::BTE_S0_Window_Start_XY(uint16_t WX, uint16_t HY)
      [9Bh] BTE S0 Window Upper-Left corner Y-coordination [7:0]
      [9Ch] BTE S0 Window Upper-Left corner Y-coordination [12:8]
      */
-    LCD_RegisterWrite(0x99, WX);
-    LCD_RegisterWrite(0x9A, WX >> 8);
-    
-    LCD_RegisterWrite(0x9B, HY);
-    LCD_RegisterWrite(0x9C, HY >> 8);
+    LCD_RegisterWriteXY(0x99, WX, HY);
 }
 
 
 
 
 //[9Dh][9Eh][9Fh][A0h]=========================================================================
-void ER_TFTM0784::BTE_S1_Memory_Start_Address(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S1_Memory_Start_Address(uint32_t Addr)
 {
     /*
      [9Dh] BTE S1 Memory Start Address [7:0]
@@ -5405,57 +5811,55 @@ void ER_TFTM0784::BTE_S1_Memory_Start_Address(uint32_t Addr)
      [A0h] BTE S1 Memory Start Address [31:24]
      Bit [1:0] tie to ¡§0¡¨ internally.
      */
-    LCD_RegisterWrite(0x9D, Addr);
-    LCD_RegisterWrite(0x9E, Addr >> 8);
-    LCD_RegisterWrite(0x9F, Addr >> 16);
-    LCD_RegisterWrite(0xA0, Addr >> 24);
+    LCD_RegisterWrite32(0x9D, Addr);
 }
 
 
 //Input data format:R3G3B2
-void ER_TFTM0784::S1_Constant_color_256(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::S1_Constant_color_256(uint8_t temp)
 {
-    LCD_CmdWrite(0x9D);
-    LCD_DataWrite(temp);
-    
-    LCD_CmdWrite(0x9E);
-    LCD_DataWrite(temp << 3);
-    
-    LCD_CmdWrite(0x9F);
-    LCD_DataWrite(temp << 6);
+    const uint8_t regs[3][2] =
+    {
+        {0x9D, (uint8_t)temp},
+        {0x9E, (uint8_t)(temp << 3)},
+        {0x9F, (uint8_t)(temp << 6)},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 //Input data format:R5G6B6
-void ER_TFTM0784::S1_Constant_color_65k(uint16_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::S1_Constant_color_65k(uint16_t temp)
 {
-    LCD_CmdWrite(0x9D);
-    LCD_DataWrite(temp >> 8);
-    
-    LCD_CmdWrite(0x9E);
-    LCD_DataWrite(temp >> 3);
-    
-    LCD_CmdWrite(0x9F);
-    LCD_DataWrite(temp << 3);
+    const uint8_t regs[3][2] =
+    {
+        {0x9D, (uint8_t)(temp >> 8)},
+        {0x9E, (uint8_t)(temp >> 3)},
+        {0x9F, (uint8_t)(temp << 3)},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 //Input data format:R8G8B8
-void ER_TFTM0784::S1_Constant_color_16M(uint32_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::S1_Constant_color_16M(uint32_t temp)
 {
-    LCD_CmdWrite(0x9D);
-    LCD_DataWrite(temp >> 16);
-    
-    LCD_CmdWrite(0x9E);
-    LCD_DataWrite(temp >> 8);
-    
-    LCD_CmdWrite(0x9F);
-    LCD_DataWrite(temp);
+    const uint8_t regs[3][2] =
+    {
+        {0x9D, (uint8_t)(temp >> 16)},
+        {0x9E, (uint8_t)(temp >> 8)},
+        {0x9F, (uint8_t)temp},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 
 
 
 //[A1h][A2h]=========================================================================
-void ER_TFTM0784::BTE_S1_Image_Width(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S1_Image_Width(uint16_t WX)
 {
     /*
      [A1h] BTE S1 Image Width [7:0]
@@ -5463,13 +5867,13 @@ void ER_TFTM0784::BTE_S1_Image_Width(uint16_t WX)
      Unit: Pixel.
      Bit [1:0] tie to ¡§0¡¨ internally.
      */
-    LCD_RegisterWrite(0xA1, WX);
-    LCD_RegisterWrite(0xA2, WX >> 8);
+    LCD_RegisterWrite16(0xA1, WX);
 }
 
 
 //[A3h][A4h][A5h][A6h]=========================================================================
-void ER_TFTM0784::BTE_S1_Window_Start_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_S1_Window_Start_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [A3h] BTE S1 Window Upper-Left corner X-coordination [7:0]
@@ -5477,18 +5881,15 @@ void ER_TFTM0784::BTE_S1_Window_Start_XY(uint16_t WX, uint16_t HY)
      [A5h] BTE S1 Window Upper-Left corner Y-coordination [7:0]
      [A6h] BTE S1 Window Upper-Left corner Y-coordination [12:8]
      */
-    LCD_RegisterWrite(0xA3, WX);
-    LCD_RegisterWrite(0xA4, WX >> 8);
-    
-    LCD_RegisterWrite(0xA5, HY);
-    LCD_RegisterWrite(0xA6, HY >> 8);
+    LCD_RegisterWriteXY(0xA3, WX, HY);
 }
 
 
 
 
 //[A7h][A8h][A9h][AAh]=========================================================================
-void ER_TFTM0784::BTE_Destination_Memory_Start_Address(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Destination_Memory_Start_Address(uint32_t Addr)
 {
     /*
      [A7h] BTE Destination Memory Start Address [7:0]
@@ -5497,15 +5898,13 @@ void ER_TFTM0784::BTE_Destination_Memory_Start_Address(uint32_t Addr)
      [AAh] BTE Destination Memory Start Address [31:24]
      Bit [1:0] tie to ¡§0¡¨ internally.
      */
-    LCD_RegisterWrite(0xA7, Addr);
-    LCD_RegisterWrite(0xA8, Addr >> 8);
-    LCD_RegisterWrite(0xA9, Addr >> 16);
-    LCD_RegisterWrite(0xAA, Addr >> 24);
+    LCD_RegisterWrite32(0xA7, Addr);
 }
 
 
 //[ABh][ACh]=========================================================================
-void ER_TFTM0784::BTE_Destination_Image_Width(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Destination_Image_Width(uint16_t WX)
 {
     /*
      [ABh] BTE Destination Image Width [7:0]
@@ -5513,13 +5912,13 @@ void ER_TFTM0784::BTE_Destination_Image_Width(uint16_t WX)
      Unit: Pixel.
      Bit [1:0] tie to ¡§0¡¨ internally.
      */
-    LCD_RegisterWrite(0xAB, WX);
-    LCD_RegisterWrite(0xAC, WX >> 8);
+    LCD_RegisterWrite16(0xAB, WX);
 }
 
 
 //[ADh][AEh][AFh][B0h]=========================================================================
-void ER_TFTM0784::BTE_Destination_Window_Start_XY(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Destination_Window_Start_XY(uint16_t WX, uint16_t HY)
 {
     /*
      [ADh] BTE Destination Window Upper-Left corner X-coordination [7:0]
@@ -5527,17 +5926,14 @@ void ER_TFTM0784::BTE_Destination_Window_Start_XY(uint16_t WX, uint16_t HY)
      [AFh] BTE Destination Window Upper-Left corner Y-coordination [7:0]
      [B0h] BTE Destination Window Upper-Left corner Y-coordination [12:8]
      */
-    LCD_RegisterWrite(0xAD, WX);
-    LCD_RegisterWrite(0xAE, WX >> 8);
-    
-    LCD_RegisterWrite(0xAF, HY);
-    LCD_RegisterWrite(0xB0, HY >> 8);
+    LCD_RegisterWriteXY(0xAD, WX, HY);
 }
 
 
 //[B1h][B2h][B3h][B4h]===============================================================
 
-void ER_TFTM0784::BTE_Window_Size(uint16_t WX, uint16_t WY)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Window_Size(uint16_t WX, uint16_t WY)
 
 {
     /*
@@ -5547,15 +5943,12 @@ void ER_TFTM0784::BTE_Window_Size(uint16_t WX, uint16_t WY)
      [B3h] BTE Window Height [7:0]
      [B4h] BTE Window Height [12:8]
      */
-    LCD_RegisterWrite(0xB1, WX);
-    LCD_RegisterWrite(0xB2, WX >> 8);
-    
-    LCD_RegisterWrite(0xB3, WY);
-    LCD_RegisterWrite(0xB4, WY >> 8);
+    LCD_RegisterWriteXY(0xB1, WX, WY);
 }
 
 //[B5h]=========================================================================
-void ER_TFTM0784::BTE_Alpha_Blending_Effect(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::BTE_Alpha_Blending_Effect(uint8_t temp)
 {
     /*
      Window Alpha Blending effect for S0 & S1
@@ -5577,26 +5970,67 @@ void ER_TFTM0784::BTE_Alpha_Blending_Effect(uint8_t temp)
 
 
 //[B6h]=========================================================================
-void ER_TFTM0784::Start_SFI_DMA()
+template<class Bus>
+void RA8876_Driver<Bus>::Start_SFI_DMA()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB6);
     temp = LCD_DataRead();
     temp |= cSetb0;
     LCD_DataWrite(temp);
+    engine_8876 = RA8876_ENGINE_DMA;
 }
 
-void ER_TFTM0784::Check_Busy_SFI_DMA()
+// The demos' DMA set-up, with [01h] and [B7h] from SW_(14), in block mode.
+template<class Bus>
+void RA8876_Driver<Bus>::Splash_Flash(uint32_t addr)
 {
-    LCD_CmdWrite(0xB6);
+    const uint8_t regs[18][2] =
+    {
+        {0x01, RA8876_SPLASH_CCR},
+        {0xB7, RA8876_SPLASH_SFCR},
+        {0xBB, RA8876_SPLASH_SPI_DIV},
+        {0xBC, (uint8_t)addr}, {0xBD, (uint8_t)(addr >> 8)},
+        {0xBE, (uint8_t)(addr >> 16)}, {0xBF, (uint8_t)(addr >> 24)},
+        {0xC0, 0x00}, {0xC1, 0x00}, {0xC2, 0x00}, {0xC3, 0x00},   // to 0, 0
+        {0xC6, (uint8_t)RA8876_PANEL_WIDTH}, {0xC7, (uint8_t)(RA8876_PANEL_WIDTH >> 8)},
+        {0xC8, (uint8_t)RA8876_PANEL_HEIGHT}, {0xC9, (uint8_t)(RA8876_PANEL_HEIGHT >> 8)},
+        {0xCA, (uint8_t)RA8876_PANEL_WIDTH}, {0xCB, (uint8_t)(RA8876_PANEL_WIDTH >> 8)},
+        {0xB6, 0x01},
+    };
+    LCD_RegisterWriteList(regs, 18);
+    engine_8876 = RA8876_ENGINE_DMA;
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::Check_Busy_SFI_DMA()
+{
+    if (engine_8876 == RA8876_ENGINE_DMA)
+        engine_8876 = RA8876_ENGINE_IDLE;
+    if (list_8876)
+    {
+        list_8876->wait(RA8876_ENGINE_DMA);
+        return;
+    }
+    RA8876_WAIT(RA8876_WAIT_SFI_DMA);
+    if (irq_8876)
+    {
+        do
+        {
+            RA8876_POLL();
+        } while (engineIrqStep(true));
+        return;
+    }
     do
     {
-    } while ((LCD_DataRead() & 0x01) == 0x01);
+        RA8876_POLL();
+    } while ((LCD_RegisterReadDirect(0xB6) & 0x01) == 0x01);
 }
 
 
 //[B7h]=========================================================================
-void ER_TFTM0784::Select_SFI_0()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_0()
 {
     /*[bit7]
      Serial Flash/ROM I/F # Select
@@ -5609,7 +6043,8 @@ void ER_TFTM0784::Select_SFI_0()
     temp &= cClrb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_1()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_1()
 {
     /*[bit7]
      Serial Flash/ROM I/F # Select
@@ -5622,7 +6057,8 @@ void ER_TFTM0784::Select_SFI_1()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_Font_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_Font_Mode()
 {
     /*[bit6]
      Serial Flash /ROM Access Mode
@@ -5635,7 +6071,8 @@ void ER_TFTM0784::Select_SFI_Font_Mode()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_DMA_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_DMA_Mode()
 {
     /*[bit6]
      Serial Flash /ROM Access Mode
@@ -5648,7 +6085,8 @@ void ER_TFTM0784::Select_SFI_DMA_Mode()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_24bit_Address()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_24bit_Address()
 {
     /*[bit5]
      Serial Flash/ROM Address Mode
@@ -5661,7 +6099,8 @@ void ER_TFTM0784::Select_SFI_24bit_Address()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_32bit_Address()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_32bit_Address()
 {
     /*[bit5]
      Serial Flash/ROM Address Mode
@@ -5674,7 +6113,8 @@ void ER_TFTM0784::Select_SFI_32bit_Address()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_Waveform_Mode_0()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_Waveform_Mode_0()
 {
     /*[bit4]
      Serial Flash/ROM Waveform Mode
@@ -5687,7 +6127,8 @@ void ER_TFTM0784::Select_SFI_Waveform_Mode_0()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_Waveform_Mode_3()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_Waveform_Mode_3()
 {
     /*[bit4]
      Serial Flash/ROM Waveform Mode
@@ -5700,7 +6141,8 @@ void ER_TFTM0784::Select_SFI_Waveform_Mode_3()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_0_DummyRead()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_0_DummyRead()
 {
     /*[bit3][bit2]
      Serial Flash /ROM Read Cycle 0 RW
@@ -5715,7 +6157,8 @@ void ER_TFTM0784::Select_SFI_0_DummyRead()
     temp &= 0xF3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_8_DummyRead()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_8_DummyRead()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB7);
@@ -5724,7 +6167,8 @@ void ER_TFTM0784::Select_SFI_8_DummyRead()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_16_DummyRead()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_16_DummyRead()
 {
     
     uint8_t temp;
@@ -5734,7 +6178,8 @@ void ER_TFTM0784::Select_SFI_16_DummyRead()
     temp |= cSetb3;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_24_DummyRead()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_24_DummyRead()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB7);
@@ -5742,7 +6187,8 @@ void ER_TFTM0784::Select_SFI_24_DummyRead()
     temp |= 0x0c;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_Single_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_Single_Mode()
 {
     /*[bit1][bit0]
      Serial Flash /ROM I/F Data Latch Mode Select
@@ -5756,7 +6202,8 @@ void ER_TFTM0784::Select_SFI_Single_Mode()
     temp &= 0xFC;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_Dual_Mode0()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_Dual_Mode0()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB7);
@@ -5765,7 +6212,8 @@ void ER_TFTM0784::Select_SFI_Dual_Mode0()
     temp |= cSetb1;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Select_SFI_Dual_Mode1()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_SFI_Dual_Mode1()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB7);
@@ -5775,7 +6223,8 @@ void ER_TFTM0784::Select_SFI_Dual_Mode1()
 }
 
 //REG[B8h] SPI master Tx /Rx FIFO Data Register (SPIDR)
-uint8_t ER_TFTM0784::SPI_Master_FIFO_Data_Put(uint8_t Data)
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::SPI_Master_FIFO_Data_Put(uint8_t Data)
 {
     uint8_t temp;
     LCD_CmdWrite(0xB8);
@@ -5785,7 +6234,8 @@ uint8_t ER_TFTM0784::SPI_Master_FIFO_Data_Put(uint8_t Data)
     return temp;
 }
 
-uint8_t ER_TFTM0784::SPI_Master_FIFO_Data_Get()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::SPI_Master_FIFO_Data_Get()
 {
     uint8_t temp;
     
@@ -5797,7 +6247,8 @@ uint8_t ER_TFTM0784::SPI_Master_FIFO_Data_Get()
 }
 
 //REG[B9h] SPI master Control Register (SPIMCR2)
-void ER_TFTM0784::Mask_SPI_Master_Interrupt_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Mask_SPI_Master_Interrupt_Flag()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5807,7 +6258,8 @@ void ER_TFTM0784::Mask_SPI_Master_Interrupt_Flag()
     
 }
 
-void ER_TFTM0784::Select_nSS_drive_on_xnsfcs0()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_nSS_drive_on_xnsfcs0()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5817,7 +6269,8 @@ void ER_TFTM0784::Select_nSS_drive_on_xnsfcs0()
     
 }
 
-void ER_TFTM0784::Select_nSS_drive_on_xnsfcs1()
+template<class Bus>
+void RA8876_Driver<Bus>::Select_nSS_drive_on_xnsfcs1()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5828,7 +6281,8 @@ void ER_TFTM0784::Select_nSS_drive_on_xnsfcs1()
 }
 
 //0: inactive (nSS port will goes high)
-void ER_TFTM0784::nSS_Inactive()
+template<class Bus>
+void RA8876_Driver<Bus>::nSS_Inactive()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5837,7 +6291,8 @@ void ER_TFTM0784::nSS_Inactive()
     LCD_DataWrite(temp);
 }
 //1: active (nSS port will goes low)
-void ER_TFTM0784::nSS_Active()
+template<class Bus>
+void RA8876_Driver<Bus>::nSS_Active()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5847,7 +6302,8 @@ void ER_TFTM0784::nSS_Active()
 }
 
 //Interrupt enable for FIFO overflow error [OVFIRQEN]
-void ER_TFTM0784::OVFIRQEN_Enable()
+template<class Bus>
+void RA8876_Driver<Bus>::OVFIRQEN_Enable()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5857,7 +6313,8 @@ void ER_TFTM0784::OVFIRQEN_Enable()
     
 }
 //Interrupt enable for while Tx FIFO empty & SPI engine/FSM idle
-void ER_TFTM0784::EMTIRQEN_Enable()
+template<class Bus>
+void RA8876_Driver<Bus>::EMTIRQEN_Enable()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5879,7 +6336,8 @@ void ER_TFTM0784::EMTIRQEN_Enable()
 //o  For CPHA=1, data are read on clock's rising edge and data are changed on a
 //falling edge.
 
-void ER_TFTM0784::Reset_CPOL()
+template<class Bus>
+void RA8876_Driver<Bus>::Reset_CPOL()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5888,7 +6346,8 @@ void ER_TFTM0784::Reset_CPOL()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::Set_CPOL()
+template<class Bus>
+void RA8876_Driver<Bus>::Set_CPOL()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5898,7 +6357,8 @@ void ER_TFTM0784::Set_CPOL()
 }
 
 
-void ER_TFTM0784::Reset_CPHA()
+template<class Bus>
+void RA8876_Driver<Bus>::Reset_CPHA()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5907,7 +6367,8 @@ void ER_TFTM0784::Reset_CPHA()
     LCD_DataWrite(temp);
 }
 
-void ER_TFTM0784::Set_CPHA()
+template<class Bus>
+void RA8876_Driver<Bus>::Set_CPHA()
 {
     uint8_t temp;
     LCD_CmdWrite(0xB9);
@@ -5918,7 +6379,8 @@ void ER_TFTM0784::Set_CPHA()
 
 
 //REG[BAh] SPI master Status Register (SPIMSR)
-uint8_t ER_TFTM0784::Tx_FIFO_Empty_Flag()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Tx_FIFO_Empty_Flag()
 {
     LCD_CmdWrite(0xBA);
     if ((LCD_DataRead() & 0x80) == 0x80)
@@ -5927,7 +6389,8 @@ uint8_t ER_TFTM0784::Tx_FIFO_Empty_Flag()
         return 0;
 }
 
-uint8_t ER_TFTM0784::Tx_FIFO_Full_Flag()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Tx_FIFO_Full_Flag()
 {
     LCD_CmdWrite(0xBA);
     if ((LCD_DataRead() & 0x40) == 0x40)
@@ -5936,7 +6399,8 @@ uint8_t ER_TFTM0784::Tx_FIFO_Full_Flag()
         return 0;
 }
 
-uint8_t ER_TFTM0784::Rx_FIFO_Empty_Flag()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Rx_FIFO_Empty_Flag()
 {
     LCD_CmdWrite(0xBA);
     if ((LCD_DataRead() & 0x20) == 0x20)
@@ -5945,7 +6409,8 @@ uint8_t ER_TFTM0784::Rx_FIFO_Empty_Flag()
         return 0;
 }
 
-uint8_t ER_TFTM0784::Rx_FIFO_full_flag()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Rx_FIFO_full_flag()
 {
     LCD_CmdWrite(0xBA);
     if ((LCD_DataRead() & 0x10) == 0x10)
@@ -5954,7 +6419,8 @@ uint8_t ER_TFTM0784::Rx_FIFO_full_flag()
         return 0;
 }
 
-uint8_t ER_TFTM0784::OVFI_Flag()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::OVFI_Flag()
 {
     LCD_CmdWrite(0xBA);
     if ((LCD_DataRead() & 0x08) == 0x08)
@@ -5963,7 +6429,8 @@ uint8_t ER_TFTM0784::OVFI_Flag()
         return 0;
 }
 
-void ER_TFTM0784::Clear_OVFI_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_OVFI_Flag()
 {
     uint8_t temp;
     LCD_CmdWrite(0xBA);
@@ -5972,7 +6439,8 @@ void ER_TFTM0784::Clear_OVFI_Flag()
     LCD_DataWrite(temp);
 }
 
-uint8_t ER_TFTM0784::EMTI_Flag()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::EMTI_Flag()
 {
     LCD_CmdWrite(0xBA);
     if ((LCD_DataRead() & 0x04) == 0x04)
@@ -5981,7 +6449,8 @@ uint8_t ER_TFTM0784::EMTI_Flag()
         return 0;
 }
 
-void ER_TFTM0784::Clear_EMTI_Flag()
+template<class Bus>
+void RA8876_Driver<Bus>::Clear_EMTI_Flag()
 {
     uint8_t temp;
     LCD_CmdWrite(0xBA);
@@ -5992,47 +6461,37 @@ void ER_TFTM0784::Clear_EMTI_Flag()
 
 
 //REG[BB] SPI Clock period (SPIDIV)
-void ER_TFTM0784::SPI_Clock_Period(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::SPI_Clock_Period(uint8_t temp)
 {
     LCD_CmdWrite(0xBB);
     LCD_DataWrite(temp);
 }
 
 //[BCh][BDh][BEh][BFh]=========================================================================
-void ER_TFTM0784::SFI_DMA_Source_Start_Address(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::SFI_DMA_Source_Start_Address(uint32_t Addr)
 {
     /*
      DMA Source START ADDRESS
      This bits index serial flash address [7:0][15:8][23:16][31:24]
      */
-    LCD_CmdWrite(0xBC);
-    LCD_DataWrite(Addr);
-    LCD_CmdWrite(0xBD);
-    LCD_DataWrite(Addr >> 8);
-    LCD_CmdWrite(0xBE);
-    LCD_DataWrite(Addr >> 16);
-    LCD_CmdWrite(0xBF);
-    LCD_DataWrite(Addr >> 24);
+    LCD_RegisterWrite32(0xBC, Addr);
 }
 //[C0h][C1h][C2h][C3h]=========================================================================
-void ER_TFTM0784::SFI_DMA_Destination_Start_Address(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::SFI_DMA_Destination_Start_Address(uint32_t Addr)
 {
     /*
      DMA Destination START ADDRESS
      [1:0]Fix at 0
      This bits index SDRAM address [7:0][15:8][23:16][31:24]
      */
-    LCD_CmdWrite(0xC0);
-    LCD_DataWrite(Addr);
-    LCD_CmdWrite(0xC1);
-    LCD_DataWrite(Addr >> 8);
-    LCD_CmdWrite(0xC2);
-    LCD_DataWrite(Addr >> 16);
-    LCD_CmdWrite(0xC3);
-    LCD_DataWrite(Addr >> 24);
+    LCD_RegisterWrite32(0xC0, Addr);
 }
 //[C0h][C1h][C2h][C3h]=========================================================================
-void ER_TFTM0784::SFI_DMA_Destination_Upper_Left_Corner(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::SFI_DMA_Destination_Upper_Left_Corner(uint16_t WX, uint16_t HY)
 {
     /*
      C0h
@@ -6060,21 +6519,14 @@ void ER_TFTM0784::SFI_DMA_Destination_Upper_Left_Corner(uint16_t WX, uint16_t HY
      This register defines Destination address [31:24] in SDRAM.
      */
     
-    LCD_CmdWrite(0xC0);
-    LCD_DataWrite(WX);
-    LCD_CmdWrite(0xC1);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0xC2);
-    LCD_DataWrite(HY);
-    LCD_CmdWrite(0xC3);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0xC0, WX, HY);
 }
 
 
 
 //[C6h][C7h][C8h][C9h]=========================================================================
-void ER_TFTM0784::SFI_DMA_Transfer_Number(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::SFI_DMA_Transfer_Number(uint32_t Addr)
 {
     /*
      Unit : Pixel
@@ -6085,16 +6537,10 @@ void ER_TFTM0784::SFI_DMA_Transfer_Number(uint32_t Addr)
      DMA Block Width [7:0][15:8]
      DMA Block HIGH[7:0][15:8]
      */
-    LCD_CmdWrite(0xC6);
-    LCD_DataWrite(Addr);
-    LCD_CmdWrite(0xC7);
-    LCD_DataWrite(Addr >> 8);
-    LCD_CmdWrite(0xC8);
-    LCD_DataWrite(Addr >> 16);
-    LCD_CmdWrite(0xC9);
-    LCD_DataWrite(Addr >> 24);
+    LCD_RegisterWrite32(0xC6, Addr);
 }
-void ER_TFTM0784::SFI_DMA_Transfer_Width_Height(uint16_t WX, uint16_t HY)
+template<class Bus>
+void RA8876_Driver<Bus>::SFI_DMA_Transfer_Width_Height(uint16_t WX, uint16_t HY)
 {
     /*
      When REG DMACR bit 1 = 0 (Linear Mode)
@@ -6104,32 +6550,23 @@ void ER_TFTM0784::SFI_DMA_Transfer_Width_Height(uint16_t WX, uint16_t HY)
      DMA Block Width [7:0][15:8]
      DMA Block HIGH[7:0][15:8]
      */
-    LCD_CmdWrite(0xC6);
-    LCD_DataWrite(WX);
-    LCD_CmdWrite(0xC7);
-    LCD_DataWrite(WX >> 8);
-    
-    LCD_CmdWrite(0xC8);
-    LCD_DataWrite(HY);
-    LCD_CmdWrite(0xC9);
-    LCD_DataWrite(HY >> 8);
+    LCD_RegisterWriteXY(0xC6, WX, HY);
 }
 //[CAh][CBh]=========================================================================
-void ER_TFTM0784::SFI_DMA_Source_Width(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::SFI_DMA_Source_Width(uint16_t WX)
 {
     /*
      DMA Source Picture Width [7:0][12:8]
      Unit: pixel
      */
-    LCD_CmdWrite(0xCA);
-    LCD_DataWrite(WX);
-    LCD_CmdWrite(0xCB);
-    LCD_DataWrite(WX >> 8);
+    LCD_RegisterWrite16(0xCA, WX);
 }
 
 //[CCh]=========================================================================
 
-void ER_TFTM0784::Font_Select_UserDefine_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Select_UserDefine_Mode()
 {
     /*[bit7-6]
      User-defined Font /CGROM Font Selection Bit in Text Mode
@@ -6144,7 +6581,8 @@ void ER_TFTM0784::Font_Select_UserDefine_Mode()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::CGROM_Select_Internal_CGROM()
+template<class Bus>
+void RA8876_Driver<Bus>::CGROM_Select_Internal_CGROM()
 {
     /*[bit7-6]
      User-defined Font /CGROM Font Selection Bit in Text Mode
@@ -6159,7 +6597,8 @@ void ER_TFTM0784::CGROM_Select_Internal_CGROM()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::CGROM_Select_Genitop_FontROM()
+template<class Bus>
+void RA8876_Driver<Bus>::CGROM_Select_Genitop_FontROM()
 {
     /*[bit7-6]
      User-defined Font /CGROM Font Selection Bit in Text Mode
@@ -6174,7 +6613,8 @@ void ER_TFTM0784::CGROM_Select_Genitop_FontROM()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Select_8x16_16x16()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Select_8x16_16x16()
 {
     /*[bit5-4]
      Font Height Setting
@@ -6192,7 +6632,8 @@ void ER_TFTM0784::Font_Select_8x16_16x16()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Select_12x24_24x24()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Select_12x24_24x24()
 {
     /*[bit5-4]
      Font Height Setting
@@ -6210,7 +6651,8 @@ void ER_TFTM0784::Font_Select_12x24_24x24()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Select_16x32_32x32()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Select_16x32_32x32()
 {
     /*[bit5-4]
      Font Height Setting
@@ -6228,7 +6670,8 @@ void ER_TFTM0784::Font_Select_16x32_32x32()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Internal_CGROM_Select_ISOIEC8859_1()
+template<class Bus>
+void RA8876_Driver<Bus>::Internal_CGROM_Select_ISOIEC8859_1()
 {
     /*
      Font Selection for internal CGROM
@@ -6247,7 +6690,8 @@ void ER_TFTM0784::Internal_CGROM_Select_ISOIEC8859_1()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Internal_CGROM_Select_ISOIEC8859_2()
+template<class Bus>
+void RA8876_Driver<Bus>::Internal_CGROM_Select_ISOIEC8859_2()
 {
     /*
      Font Selection for internal CGROM
@@ -6266,7 +6710,8 @@ void ER_TFTM0784::Internal_CGROM_Select_ISOIEC8859_2()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Internal_CGROM_Select_ISOIEC8859_3()
+template<class Bus>
+void RA8876_Driver<Bus>::Internal_CGROM_Select_ISOIEC8859_3()
 {
     /*
      Font Selection for internal CGROM
@@ -6285,7 +6730,8 @@ void ER_TFTM0784::Internal_CGROM_Select_ISOIEC8859_3()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Internal_CGROM_Select_ISOIEC8859_4()
+template<class Bus>
+void RA8876_Driver<Bus>::Internal_CGROM_Select_ISOIEC8859_4()
 {
     /*
      Font Selection for internal CGROM
@@ -6305,7 +6751,8 @@ void ER_TFTM0784::Internal_CGROM_Select_ISOIEC8859_4()
     LCD_DataWrite(temp);
 }
 //[CDh]=========================================================================
-void ER_TFTM0784::Enable_Font_Alignment()
+template<class Bus>
+void RA8876_Driver<Bus>::Enable_Font_Alignment()
 {
     /*
      Full Alignment Selection Bit
@@ -6318,7 +6765,8 @@ void ER_TFTM0784::Enable_Font_Alignment()
     temp |= cSetb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Disable_Font_Alignment()
+template<class Bus>
+void RA8876_Driver<Bus>::Disable_Font_Alignment()
 {
     /*
      Full Alignment Selection Bit
@@ -6331,7 +6779,8 @@ void ER_TFTM0784::Disable_Font_Alignment()
     temp &= cClrb7;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Background_select_Transparency()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Background_select_Transparency()
 {
     /*
      Font Transparency
@@ -6344,7 +6793,8 @@ void ER_TFTM0784::Font_Background_select_Transparency()
     temp |= cSetb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Background_select_Color()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Background_select_Color()
 {
     /*
      Font Transparency
@@ -6357,7 +6807,8 @@ void ER_TFTM0784::Font_Background_select_Color()
     temp &= cClrb6;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_0_degree()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_0_degree()
 {
     /*
      Font Rotation
@@ -6375,7 +6826,8 @@ void ER_TFTM0784::Font_0_degree()
     temp &= cClrb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_90_degree()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_90_degree()
 {
     /*
      Font Rotation
@@ -6393,7 +6845,8 @@ void ER_TFTM0784::Font_90_degree()
     temp |= cSetb4;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Width_X1()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Width_X1()
 {
     /*
      Horizontal Font Enlargement
@@ -6409,7 +6862,8 @@ void ER_TFTM0784::Font_Width_X1()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Width_X2()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Width_X2()
 {
     /*
      Horizontal Font Enlargement
@@ -6425,7 +6879,8 @@ void ER_TFTM0784::Font_Width_X2()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Width_X3()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Width_X3()
 {
     /*
      Horizontal Font Enlargement
@@ -6441,7 +6896,8 @@ void ER_TFTM0784::Font_Width_X3()
     temp &= cClrb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Width_X4()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Width_X4()
 {
     /*
      Horizontal Font Enlargement
@@ -6457,7 +6913,8 @@ void ER_TFTM0784::Font_Width_X4()
     temp |= cSetb2;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Height_X1()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Height_X1()
 {
     /*
      Vertical Font Enlargement
@@ -6473,7 +6930,8 @@ void ER_TFTM0784::Font_Height_X1()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Height_X2()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Height_X2()
 {
     /*
      Vertical Font Enlargement
@@ -6489,7 +6947,8 @@ void ER_TFTM0784::Font_Height_X2()
     temp |= cSetb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Height_X3()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Height_X3()
 {
     /*
      Vertical Font Enlargement
@@ -6505,7 +6964,8 @@ void ER_TFTM0784::Font_Height_X3()
     temp &= cClrb0;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::Font_Height_X4()
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Height_X4()
 {
     /*
      Vertical Font Enlargement
@@ -6523,7 +6983,8 @@ void ER_TFTM0784::Font_Height_X4()
 }
 
 //[CEh]=========================================================================
-void ER_TFTM0784::GTFont_Select_GT21L16TW_GT21H16T1W()
+template<class Bus>
+void RA8876_Driver<Bus>::GTFont_Select_GT21L16TW_GT21H16T1W()
 {
     /*
      GT Serial Font ROM Select
@@ -6544,7 +7005,8 @@ void ER_TFTM0784::GTFont_Select_GT21L16TW_GT21H16T1W()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::GTFont_Select_GT23L16U2W()
+template<class Bus>
+void RA8876_Driver<Bus>::GTFont_Select_GT23L16U2W()
 {
     /*
      GT Serial Font ROM Select
@@ -6565,7 +7027,8 @@ void ER_TFTM0784::GTFont_Select_GT23L16U2W()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::GTFont_Select_GT23L24T3Y_GT23H24T3Y()
+template<class Bus>
+void RA8876_Driver<Bus>::GTFont_Select_GT23L24T3Y_GT23H24T3Y()
 {
     /*
      GT Serial Font ROM Select
@@ -6586,7 +7049,8 @@ void ER_TFTM0784::GTFont_Select_GT23L24T3Y_GT23H24T3Y()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::GTFont_Select_GT23L24M1Z()
+template<class Bus>
+void RA8876_Driver<Bus>::GTFont_Select_GT23L24M1Z()
 {
     /*
      GT Serial Font ROM Select
@@ -6607,7 +7071,8 @@ void ER_TFTM0784::GTFont_Select_GT23L24M1Z()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::GTFont_Select_GT23L32S4W_GT23H32S4W()
+template<class Bus>
+void RA8876_Driver<Bus>::GTFont_Select_GT23L32S4W_GT23H32S4W()
 {
     /*
      GT Serial Font ROM Select
@@ -6628,7 +7093,8 @@ void ER_TFTM0784::GTFont_Select_GT23L32S4W_GT23H32S4W()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::GTFont_Select_GT20L24F6Y()
+template<class Bus>
+void RA8876_Driver<Bus>::GTFont_Select_GT20L24F6Y()
 {
     /*
      GT Serial Font ROM Select
@@ -6649,7 +7115,8 @@ void ER_TFTM0784::GTFont_Select_GT20L24F6Y()
     temp |= cSetb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::GTFont_Select_GT21L24S1W()
+template<class Bus>
+void RA8876_Driver<Bus>::GTFont_Select_GT21L24S1W()
 {
     /*
      GT Serial Font ROM Select
@@ -6670,7 +7137,8 @@ void ER_TFTM0784::GTFont_Select_GT21L24S1W()
     temp &= cClrb5;
     LCD_DataWrite(temp);
 }
-void ER_TFTM0784::GTFont_Select_GT22L16A1Y()
+template<class Bus>
+void RA8876_Driver<Bus>::GTFont_Select_GT22L16A1Y()
 {
     /*
      GT Serial Font ROM Select
@@ -6693,7 +7161,8 @@ void ER_TFTM0784::GTFont_Select_GT22L16A1Y()
 }
 
 //[CFh]=========================================================================
-void ER_TFTM0784::Set_GTFont_Decoder(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_GTFont_Decoder(uint8_t temp)
 {
     /*
      [bit7-3]
@@ -6736,7 +7205,8 @@ void ER_TFTM0784::Set_GTFont_Decoder(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[D0h]=========================================================================
-void ER_TFTM0784::Font_Line_Distance(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Font_Line_Distance(uint8_t temp)
 {
     /*[bit4-0]
      Font Line Distance Setting
@@ -6747,7 +7217,8 @@ void ER_TFTM0784::Font_Line_Distance(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[D1h]=========================================================================
-void ER_TFTM0784::Set_Font_to_Font_Width(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_Font_to_Font_Width(uint8_t temp)
 {
     /*[bit5-0]
      Font to Font Width Setting (Unit: pixel)
@@ -6756,60 +7227,60 @@ void ER_TFTM0784::Set_Font_to_Font_Width(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[D2h]~[D4h]=========================================================================
-void ER_TFTM0784::Foreground_RGB(uint8_t RED, uint8_t GREEN, uint8_t BLUE)
+template<class Bus>
+void RA8876_Driver<Bus>::Foreground_RGB(uint8_t RED, uint8_t GREEN, uint8_t BLUE)
 {
     /*
      [D2h] Foreground Color - Red, for draw, text or color expansion
      [D3h] Foreground Color - Green, for draw, text or color expansion
      [D4h] Foreground Color - Blue, for draw, text or color expansion
      */
-    LCD_CmdWrite(0xD2);
-    LCD_DataWrite(RED);
-    
-    LCD_CmdWrite(0xD3);
-    LCD_DataWrite(GREEN);
-    
-    LCD_CmdWrite(0xD4);
-    LCD_DataWrite(BLUE);
+    const uint8_t regs[3][2] =
+    {
+        {0xD2, (uint8_t)RED},
+        {0xD3, (uint8_t)GREEN},
+        {0xD4, (uint8_t)BLUE},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 //Input data format:R3G3B2
-void ER_TFTM0784::Foreground_color_256(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Foreground_color_256(uint8_t temp)
 {
-    LCD_CmdWrite(0xD2);
-    LCD_DataWrite(temp);
-    
-    LCD_CmdWrite(0xD3);
-    LCD_DataWrite(temp << 3);
-    
-    LCD_CmdWrite(0xD4);
-    LCD_DataWrite(temp << 6);
+    const uint8_t regs[3][2] =
+    {
+        {0xD2, (uint8_t)temp},
+        {0xD3, (uint8_t)(temp << 3)},
+        {0xD4, (uint8_t)(temp << 6)},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 //Input data format:R5G6B5
-void ER_TFTM0784::Foreground_color_65k(uint16_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Foreground_color_65k(uint16_t temp)
 {
-    LCD_CmdWrite(0xD2);
-    LCD_DataWrite(temp >> 8);
-    
-    LCD_CmdWrite(0xD3);
-    LCD_DataWrite(temp >> 3);
-    
-    LCD_CmdWrite(0xD4);
-    LCD_DataWrite(temp << 3);
+    const uint8_t regs[3][2] =
+    {
+        {0xD2, (uint8_t)(temp >> 8)},
+        {0xD3, (uint8_t)(temp >> 3)},
+        {0xD4, (uint8_t)(temp << 3)},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 //Input data format:R8G8B8
-void ER_TFTM0784::Foreground_color_16M(uint32_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Foreground_color_16M(uint32_t temp)
 {
-    LCD_CmdWrite(0xD2);
-    LCD_DataWrite(temp >> 16);
-    
-    LCD_CmdWrite(0xD3);
-    LCD_DataWrite(temp >> 8);
-    
-    LCD_CmdWrite(0xD4);
-    LCD_DataWrite(temp);
+    const uint8_t regs[3][2] =
+    {
+        {0xD2, (uint8_t)(temp >> 16)},
+        {0xD3, (uint8_t)(temp >> 8)},
+        {0xD4, (uint8_t)temp},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 
@@ -6820,72 +7291,66 @@ void ER_TFTM0784::Foreground_color_16M(uint32_t temp)
  [D6h] Background Color - Green, for Text or color expansion
  [D7h] Background Color - Blue, for Text or color expansion
  */
-void ER_TFTM0784::Background_RGB(uint8_t RED, uint8_t GREEN, uint8_t BLUE)
+template<class Bus>
+void RA8876_Driver<Bus>::Background_RGB(uint8_t RED, uint8_t GREEN, uint8_t BLUE)
 {
     
-    LCD_CmdWrite(0xD5);
-    LCD_DataWrite(RED);
-    
-    LCD_CmdWrite(0xD6);
-    LCD_DataWrite(GREEN);
-    
-    LCD_CmdWrite(0xD7);
-    LCD_DataWrite(BLUE);
+    const uint8_t regs[3][2] =
+    {
+        {0xD5, (uint8_t)RED},
+        {0xD6, (uint8_t)GREEN},
+        {0xD7, (uint8_t)BLUE},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 //Input data format:R3G3B2
-void ER_TFTM0784::Background_color_256(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Background_color_256(uint8_t temp)
 {
-    LCD_CmdWrite(0xD5);
-    LCD_DataWrite(temp);
-    
-    LCD_CmdWrite(0xD6);
-    LCD_DataWrite(temp << 3);
-    
-    LCD_CmdWrite(0xD7);
-    LCD_DataWrite(temp << 6);
+    const uint8_t regs[3][2] =
+    {
+        {0xD5, (uint8_t)temp},
+        {0xD6, (uint8_t)(temp << 3)},
+        {0xD7, (uint8_t)(temp << 6)},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 //Input data format:R5G6B6
-void ER_TFTM0784::Background_color_65k(uint16_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Background_color_65k(uint16_t temp)
 {
-    LCD_CmdWrite(0xD5);
-    LCD_DataWrite(temp >> 8);
-    
-    LCD_CmdWrite(0xD6);
-    LCD_DataWrite(temp >> 3);
-    
-    LCD_CmdWrite(0xD7);
-    LCD_DataWrite(temp << 3);
+    const uint8_t regs[3][2] =
+    {
+        {0xD5, (uint8_t)(temp >> 8)},
+        {0xD6, (uint8_t)(temp >> 3)},
+        {0xD7, (uint8_t)(temp << 3)},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 //Input data format:R8G8B8
-void ER_TFTM0784::Background_color_16M(uint32_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Background_color_16M(uint32_t temp)
 {
-    LCD_CmdWrite(0xD5);
-    LCD_DataWrite(temp >> 16);
-    
-    LCD_CmdWrite(0xD6);
-    LCD_DataWrite(temp >> 8);
-    
-    LCD_CmdWrite(0xD7);
-    LCD_DataWrite(temp);
+    const uint8_t regs[3][2] =
+    {
+        {0xD5, (uint8_t)(temp >> 16)},
+        {0xD6, (uint8_t)(temp >> 8)},
+        {0xD7, (uint8_t)temp},
+    };
+    LCD_RegisterWriteList(regs, 3);
 }
 
 //[DBh]~[DEh]=========================================================================
-void ER_TFTM0784::CGRAM_Start_address(uint32_t Addr)
+template<class Bus>
+void RA8876_Driver<Bus>::CGRAM_Start_address(uint32_t Addr)
 {
     /*
      CGRAM START ADDRESS [31:0]
      */
-    LCD_CmdWrite(0xDB);
-    LCD_DataWrite(Addr);
-    LCD_CmdWrite(0xDC);
-    LCD_DataWrite(Addr >> 8);
-    LCD_CmdWrite(0xDD);
-    LCD_DataWrite(Addr >> 16);
-    LCD_CmdWrite(0xDE);
-    LCD_DataWrite(Addr >> 24);
+    LCD_RegisterWrite32(0xDB, Addr);
 }
 
 //[DFh]=========================================================================
@@ -6899,26 +7364,30 @@ void ER_TFTM0784::CGRAM_Start_address(uint32_t Addr)
  10: Suspend Mode
  11: Sleep Mode
  */
-void ER_TFTM0784::Power_Normal_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Power_Normal_Mode()
 {
     LCD_CmdWrite(0xDF);
     LCD_DataWrite(0x00);
 }
-void ER_TFTM0784::Power_Saving_Standby_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Power_Saving_Standby_Mode()
 {
     LCD_CmdWrite(0xDF);
     LCD_DataWrite(0x01);
     LCD_CmdWrite(0xDF);
     LCD_DataWrite(0x81);
 }
-void ER_TFTM0784::Power_Saving_Suspend_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Power_Saving_Suspend_Mode()
 {
     LCD_CmdWrite(0xDF);
     //  LCD_DataWrite(0x02);
     //  LCD_CmdWrite(0xDF);
     LCD_DataWrite(0x82);
 }
-void ER_TFTM0784::Power_Saving_Sleep_Mode()
+template<class Bus>
+void RA8876_Driver<Bus>::Power_Saving_Sleep_Mode()
 {
     LCD_CmdWrite(0xDF);
     //  LCD_DataWrite(0x03);
@@ -6928,19 +7397,18 @@ void ER_TFTM0784::Power_Saving_Sleep_Mode()
 
 
 //[E5h]~[E6h]=========================================================================
-void ER_TFTM0784::RA8876_I2CM_Clock_Prescale(uint16_t WX)
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_I2CM_Clock_Prescale(uint16_t WX)
 {
     /*
      I2C Master Clock Pre-scale [7:0]
      I2C Master Clock Pre-scale [15:8]
      */
-    LCD_CmdWrite(0xE5);
-    LCD_DataWrite(WX);
-    LCD_CmdWrite(0xE6);
-    LCD_DataWrite(WX >> 8);
+    LCD_RegisterWrite16(0xE5, WX);
 }
 //[E7h]=========================================================================
-void ER_TFTM0784::RA8876_I2CM_Transmit_Data(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_I2CM_Transmit_Data(uint8_t temp)
 {
     /*
      I2C Master Transmit[7:0]
@@ -6949,7 +7417,8 @@ void ER_TFTM0784::RA8876_I2CM_Transmit_Data(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[E8h]=========================================================================
-uint8_t ER_TFTM0784::RA8876_I2CM_Receiver_Data()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::RA8876_I2CM_Receiver_Data()
 {
     /*
      I2C Master Receiver [7:0]
@@ -6985,7 +7454,8 @@ uint8_t ER_TFTM0784::RA8876_I2CM_Receiver_Data()
  1 : Disable.
  */
 
-void ER_TFTM0784::RA8876_I2CM_Stop()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_I2CM_Stop()
 {
     LCD_CmdWrite(0xE9);
 #ifdef Disable_I2CM_Noise_Filter
@@ -6996,7 +7466,8 @@ void ER_TFTM0784::RA8876_I2CM_Stop()
     LCD_DataWrite(0x41);
 #endif
 }
-void ER_TFTM0784::RA8876_I2CM_Read_With_Ack()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_I2CM_Read_With_Ack()
 {
     
     LCD_CmdWrite(0xE9);
@@ -7008,7 +7479,8 @@ void ER_TFTM0784::RA8876_I2CM_Read_With_Ack()
 #endif
 }
 
-void ER_TFTM0784::RA8876_I2CM_Read_With_Nack()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_I2CM_Read_With_Nack()
 {
     
     LCD_CmdWrite(0xE9);
@@ -7020,7 +7492,8 @@ void ER_TFTM0784::RA8876_I2CM_Read_With_Nack()
 #endif
 }
 
-void ER_TFTM0784::RA8876_I2CM_Write_With_Start()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_I2CM_Write_With_Start()
 {
     LCD_CmdWrite(0xE9);
 #ifdef Disable_I2CM_Noise_Filter
@@ -7033,7 +7506,8 @@ void ER_TFTM0784::RA8876_I2CM_Write_With_Start()
     
 }
 
-void ER_TFTM0784::RA8876_I2CM_Write()
+template<class Bus>
+void RA8876_Driver<Bus>::RA8876_I2CM_Write()
 {
     LCD_CmdWrite(0xE9);
 #ifdef Disable_I2CM_Noise_Filter
@@ -7051,7 +7525,8 @@ void ER_TFTM0784::RA8876_I2CM_Write()
  0=Ack
  1=Nack
  */
-uint8_t ER_TFTM0784::RA8876_I2CM_Check_Slave_ACK()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::RA8876_I2CM_Check_Slave_ACK()
 {
     uint8_t temp;
     /*[bit7]
@@ -7072,7 +7547,8 @@ uint8_t ER_TFTM0784::RA8876_I2CM_Check_Slave_ACK()
  0=Idle
  1=Busy
  */
-uint8_t ER_TFTM0784::RA8876_I2CM_Bus_Busy()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::RA8876_I2CM_Bus_Busy()
 {
     uint8_t temp;
     
@@ -7093,7 +7569,8 @@ uint8_t ER_TFTM0784::RA8876_I2CM_Bus_Busy()
  0=Complete
  1=Transferring
  */
-uint8_t ER_TFTM0784::RA8876_I2CM_transmit_Progress()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::RA8876_I2CM_transmit_Progress()
 {
     uint8_t temp;
     /*[bit6]
@@ -7112,7 +7589,8 @@ uint8_t ER_TFTM0784::RA8876_I2CM_transmit_Progress()
  0= Arbitration win
  1= Arbitration lost
  */
-uint8_t ER_TFTM0784::RA8876_I2CM_Arbitration()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::RA8876_I2CM_Arbitration()
 {
     uint8_t temp;
     /*[bit6]
@@ -7128,7 +7606,8 @@ uint8_t ER_TFTM0784::RA8876_I2CM_Arbitration()
 
 
 //[F0h]=========================================================================
-void ER_TFTM0784::Set_GPIO_A_In_Out(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_GPIO_A_In_Out(uint8_t temp)
 {
     /*
      GPO-A_dir[7:0] : General Purpose I/O direction control.
@@ -7139,7 +7618,8 @@ void ER_TFTM0784::Set_GPIO_A_In_Out(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[F1h]=========================================================================
-void ER_TFTM0784::Write_GPIO_A_7_0(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Write_GPIO_A_7_0(uint8_t temp)
 {
     /*
      GPI-A[7:0] : General Purpose Input, share with DB[15:8]
@@ -7148,7 +7628,8 @@ void ER_TFTM0784::Write_GPIO_A_7_0(uint8_t temp)
     LCD_CmdWrite(0xF1);
     LCD_DataWrite(temp);
 }
-uint8_t ER_TFTM0784::Read_GPIO_A_7_0()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Read_GPIO_A_7_0()
 {
     /*
      GPI-A[7:0] : General Purpose Input, share with DB[15:8]
@@ -7160,7 +7641,8 @@ uint8_t ER_TFTM0784::Read_GPIO_A_7_0()
     return temp;
 }
 //[F2h]=========================================================================
-void ER_TFTM0784::Write_GPIO_B_7_4(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Write_GPIO_B_7_4(uint8_t temp)
 {
     /*
      GPI-B[7:0] : General Purpose Input ; share with {XKIN[3:0], XA0, XnWR, XnRD, XnCS}
@@ -7169,7 +7651,8 @@ void ER_TFTM0784::Write_GPIO_B_7_4(uint8_t temp)
     LCD_CmdWrite(0xF2);
     LCD_DataWrite(temp);
 }
-uint8_t ER_TFTM0784::Read_GPIO_B_7_0()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Read_GPIO_B_7_0()
 {
     /*
      GPI-B[7:0] : General Purpose Input ; share with {XKIN[3:0], XA0, XnWR, XnRD, XnCS}
@@ -7182,7 +7665,8 @@ uint8_t ER_TFTM0784::Read_GPIO_B_7_0()
 }
 
 //[F3h]=========================================================================
-void ER_TFTM0784::Set_GPIO_C_In_Out(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_GPIO_C_In_Out(uint8_t temp)
 {
     /*
      GPIO-C_dir[7:0] : General Purpose I/O direction control.
@@ -7193,7 +7677,8 @@ void ER_TFTM0784::Set_GPIO_C_In_Out(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[F4h]=========================================================================
-void ER_TFTM0784::Write_GPIO_C_7_0(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Write_GPIO_C_7_0(uint8_t temp)
 {
     /*
      GPIO-C[7:0] : General Purpose Input / Output
@@ -7202,7 +7687,8 @@ void ER_TFTM0784::Write_GPIO_C_7_0(uint8_t temp)
     LCD_CmdWrite(0xF4);
     LCD_DataWrite(temp);
 }
-uint8_t ER_TFTM0784::Read_GPIO_C_7_0()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Read_GPIO_C_7_0()
 {
     /*
      GPIO-C[7:0] : General Purpose Input / Output
@@ -7214,7 +7700,8 @@ uint8_t ER_TFTM0784::Read_GPIO_C_7_0()
     return temp;
 }
 //[F5h]=========================================================================
-void ER_TFTM0784::Set_GPIO_D_In_Out(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_GPIO_D_In_Out(uint8_t temp)
 {
     /*
      GPIO-D_dir[7:0] : General Purpose I/O direction control.
@@ -7225,7 +7712,8 @@ void ER_TFTM0784::Set_GPIO_D_In_Out(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[F6h]=========================================================================
-void ER_TFTM0784::Write_GPIO_D_7_0(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Write_GPIO_D_7_0(uint8_t temp)
 {
     /*
      GPIO-D[7:0] : General Purpose Input/Output
@@ -7233,7 +7721,8 @@ void ER_TFTM0784::Write_GPIO_D_7_0(uint8_t temp)
     LCD_CmdWrite(0xF6);
     LCD_DataWrite(temp);
 }
-uint8_t ER_TFTM0784::Read_GPIO_D_7_0()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Read_GPIO_D_7_0()
 {
     /*
      GPIO-D[7:0] : General Purpose Input/Output
@@ -7244,7 +7733,8 @@ uint8_t ER_TFTM0784::Read_GPIO_D_7_0()
     return temp;
 }
 //[F7h]=========================================================================
-void ER_TFTM0784::Set_GPIO_E_In_Out(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_GPIO_E_In_Out(uint8_t temp)
 {
     /*
      GPIO-E_dir[7:0] : General Purpose I/O direction control.
@@ -7255,7 +7745,8 @@ void ER_TFTM0784::Set_GPIO_E_In_Out(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[F8h]=========================================================================
-void ER_TFTM0784::Write_GPIO_E_7_0(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Write_GPIO_E_7_0(uint8_t temp)
 {
     /*
      GPIO-E[7:0] : General Purpose Input/Output.
@@ -7264,7 +7755,8 @@ void ER_TFTM0784::Write_GPIO_E_7_0(uint8_t temp)
     LCD_CmdWrite(0xF8);
     LCD_DataWrite(temp);
 }
-uint8_t ER_TFTM0784::Read_GPIO_E_7_0()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Read_GPIO_E_7_0()
 {
     /*
      GPIO-E[7:0] : General Purpose Input/Output.
@@ -7276,7 +7768,8 @@ uint8_t ER_TFTM0784::Read_GPIO_E_7_0()
     return temp;
 }
 //[F9h]=========================================================================
-void ER_TFTM0784::Set_GPIO_F_In_Out(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Set_GPIO_F_In_Out(uint8_t temp)
 {
     /*
      GPIO-F_dir[7:0] : General Purpose I/O direction control.
@@ -7287,7 +7780,8 @@ void ER_TFTM0784::Set_GPIO_F_In_Out(uint8_t temp)
     LCD_DataWrite(temp);
 }
 //[FAh]=========================================================================
-void ER_TFTM0784::Write_GPIO_F_7_0(uint8_t temp)
+template<class Bus>
+void RA8876_Driver<Bus>::Write_GPIO_F_7_0(uint8_t temp)
 {
     /*
      GPIO-F[7:0] : General Purpose Input/Output.
@@ -7296,7 +7790,8 @@ void ER_TFTM0784::Write_GPIO_F_7_0(uint8_t temp)
     LCD_CmdWrite(0xFA);
     LCD_DataWrite(temp);
 }
-uint8_t ER_TFTM0784::Read_GPIO_F_7_0()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Read_GPIO_F_7_0()
 {
     /*
      GPIO-F[7:0] : General Purpose Input/Output.
@@ -7311,7 +7806,8 @@ uint8_t ER_TFTM0784::Read_GPIO_F_7_0()
 //[FBh]=========================================================================
 
 
-void ER_TFTM0784::Long_Key_enable()
+template<class Bus>
+void RA8876_Driver<Bus>::Long_Key_enable()
 {
     /*
      Key-Scan Control Register 1
@@ -7327,7 +7823,8 @@ void ER_TFTM0784::Long_Key_enable()
 }
 
 
-void ER_TFTM0784::Key_Scan_Freg(uint8_t setx)
+template<class Bus>
+void RA8876_Driver<Bus>::Key_Scan_Freg(uint8_t setx)
 {
     /*KF2-0: Key-Scan Frequency */
     uint8_t temp;
@@ -7341,7 +7838,8 @@ void ER_TFTM0784::Key_Scan_Freg(uint8_t setx)
 
 //[FCh]=========================================================================
 
-void ER_TFTM0784::Key_Scan_Wakeup_Function_Enable()
+template<class Bus>
+void RA8876_Driver<Bus>::Key_Scan_Wakeup_Function_Enable()
 {
     /*
      Key-Scan Controller Register 2
@@ -7358,7 +7856,8 @@ void ER_TFTM0784::Key_Scan_Wakeup_Function_Enable()
 }
 
 
-void ER_TFTM0784::Long_Key_Timing_Adjustment(uint8_t setx)
+template<class Bus>
+void RA8876_Driver<Bus>::Long_Key_Timing_Adjustment(uint8_t setx)
 {
     /*Long Key Timing Adjustment*/
     uint8_t temp, temp1;
@@ -7370,7 +7869,8 @@ void ER_TFTM0784::Long_Key_Timing_Adjustment(uint8_t setx)
     
 }
 
-uint8_t ER_TFTM0784::Numbers_of_Key_Hit()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Numbers_of_Key_Hit()
 {
     uint8_t temp;
     LCD_CmdWrite(0xFC);
@@ -7380,7 +7880,8 @@ uint8_t ER_TFTM0784::Numbers_of_Key_Hit()
 }
 
 //[FDh][FEh][FFh]=========================================================================
-uint8_t ER_TFTM0784::Read_Key_Strobe_Data_0()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Read_Key_Strobe_Data_0()
 {
     /*
      Key Strobe Data 0
@@ -7391,7 +7892,8 @@ uint8_t ER_TFTM0784::Read_Key_Strobe_Data_0()
     temp = LCD_DataRead();
     return temp;
 }
-uint8_t ER_TFTM0784::Read_Key_Strobe_Data_1()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Read_Key_Strobe_Data_1()
 {
     /*
      Key Strobe Data 1
@@ -7402,7 +7904,8 @@ uint8_t ER_TFTM0784::Read_Key_Strobe_Data_1()
     temp = LCD_DataRead();
     return temp;
 }
-uint8_t ER_TFTM0784::Read_Key_Strobe_Data_2()
+template<class Bus>
+uint8_t RA8876_Driver<Bus>::Read_Key_Strobe_Data_2()
 {
     /*
      Key Strobe Data 2
@@ -7416,14 +7919,16 @@ uint8_t ER_TFTM0784::Read_Key_Strobe_Data_2()
 
 
 
-void ER_TFTM0784::Show_String(const char *str)
+template<class Bus>
+void RA8876_Driver<Bus>::Show_String(const char *str)
 {
     Text_Mode();
     LCD_CmdWrite(0x04);
+    Mem_WR_FIFO_Reset();
     while (*str != '\0')
     {
+        Mem_WR_FIFO_Reserve();
         LCD_DataWrite(*str);
-        Check_Mem_WR_FIFO_not_Full();
         ++str;
     }
     Check_2D_Busy();
@@ -7432,60 +7937,223 @@ void ER_TFTM0784::Show_String(const char *str)
 }
 
 
-void ER_TFTM0784::Show_picture(uint32_t numbers, const uint16_t *datap)
+template<class Bus>
+void RA8876_Driver<Bus>::Show_picture(uint32_t numbers, const uint16_t *datap)
 {
     uint32_t i;
     
     LCD_CmdWrite(0x04);
-    if (mode_8876 == 2) // Check if we are using SPI
+    if (bus_8876.mode() == 2) // Check if we are using SPI
     { // Then increase efficiency by sending the data in one burst!
-        // b0 = 0b10000000
-        // b1   reg_dat / mem_dat
-        startSend();
-        SPI.transfer(RA8876_SPI_DATAWRITE);
-        for (i = 0; i < numbers; i++) {
-            uint16_t data = pgm_read_word_near(datap + i);
-            SPI.transfer(data & 0xFF); // LSB first!!!
-            SPI.transfer(data>>8);
+        uint16_t buf[RA8876_SPI_CHUNK / 2];
+        uint32_t n, j;
+        bus_8876.burstBegin();
+        for (i = 0; i < numbers; i += n) {
+            n = numbers - i;
+            if (n > RA8876_SPI_CHUNK / 2)
+                n = RA8876_SPI_CHUNK / 2;
+            for (j = 0; j < n; j++)
+                buf[j] = pgm_read_word_near(datap + i + j);
+            bus_8876.burstPixels(buf, n);
         }
-        endSend();
+        bus_8876.burstEnd();
+        RA8876_COUNT(countBurst(numbers * 2));
     } else
     {
+    Mem_WR_FIFO_Reset();
     for (i = 0; i < numbers; i++)
       {
+        Mem_WR_FIFO_Reserve();
         LCD_DataWrite16(pgm_read_word_near(datap + i));
-        Check_Mem_WR_FIFO_not_Full();
       }
     }
     
 }
 
-void ER_TFTM0784::Show_picture(uint32_t numbers, const uint8_t *datap)
+template<class Bus>
+void RA8876_Driver<Bus>::Show_picture(uint32_t numbers, const uint8_t *datap)
 {
     uint32_t i;
     
     LCD_CmdWrite(0x04);
-    if (mode_8876 == 2) // Check if we are using SPI
+    if (bus_8876.mode() == 2) // Check if we are using SPI
     { // Then increase efficiency by sending the data in one burst!
-        // b0 = 0b10000000
-        // b1   reg_dat / mem_dat
-        startSend();
-        SPI.transfer(RA8876_SPI_DATAWRITE);
+        bus_8876.burstBegin();
         for (i = 0; i < numbers; i++) {
-            SPI.transfer(pgm_read_word_near(datap + i));
+            bus_8876.burstWrite8(pgm_read_word_near(datap + i));
         }
-        endSend();
+        bus_8876.burstEnd();
+        RA8876_COUNT(countBurst(numbers));
     } else
     {
+        Mem_WR_FIFO_Reset();
         for (i = 0; i < numbers; i++)
         {
+             Mem_WR_FIFO_Reserve();
              LCD_DataWrite(pgm_read_word_near(datap + i));
-             Check_Mem_WR_FIFO_not_Full();
         }
     }
 }
 
-void ER_TFTM0784::Graphic_cursor_initial()
+template<class Bus>
+void RA8876_Driver<Bus>::Upload_Begin()
+{
+    LCD_CmdWrite(0x04);
+    uploadBase_8876 = bus_8876.burstCompleted();
+    uploadSeq_8876 = 0;
+    bus_8876.burstBegin();
+}
+
+template<class Bus>
+uint32_t RA8876_Driver<Bus>::Upload_Chunk(const uint16_t *pixels, uint32_t count)
+{
+    if (count == 0)
+        return uploadSeq_8876;
+    while (!bus_8876.burstAsync(pixels, count));   // both buffers in flight
+    RA8876_COUNT(countBurst(count * 2));
+    return ++uploadSeq_8876;
+}
+
+template<class Bus>
+bool RA8876_Driver<Bus>::Upload_Done(uint32_t handle)
+{
+    return bus_8876.burstCompleted() - uploadBase_8876 >= handle;
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::Upload_Wait(uint32_t handle)
+{
+    while (!Upload_Done(handle));
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::Upload_End()
+{
+    Upload_Wait(uploadSeq_8876);
+    bus_8876.burstEnd();
+}
+
+//==============================================================================
+// Memory readback. Reads go through the memory port in graphic mode, which
+// walks the active window row by row; after the first (dummy) read the
+// RA8876 prefetches into the memory read FIFO.
+
+template<class Bus>
+void RA8876_Driver<Bus>::Readback_Begin(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    fence();
+    for (uint8_t i = 0; i < 8; i++)
+        readWin_8876[i] = LCD_RegisterRead(0x56 + i);
+    Active_Window_XY(x, y);
+    Active_Window_WH(w, h);
+    Goto_Pixel_XY(x, y);
+    LCD_CmdWrite(0x04);
+    LCD_DataRead();     // dummy read
+}
+
+// Wait for a full read FIFO, then take up to RA8876_RD_FIFO_DEPTH pixels in
+// one burst. Gives up waiting after 1000 reads like the other FIFO checks.
+template<class Bus>
+void RA8876_Driver<Bus>::Readback_Chunk(uint16_t *pixels, uint32_t count)
+{
+    while (count)
+    {
+        uint32_t n = (count > RA8876_RD_FIFO_DEPTH) ? RA8876_RD_FIFO_DEPTH : count;
+        {
+            RA8876_WAIT(RA8876_WAIT_RD_FIFO);
+            for (uint16_t tries = 0; tries < 1000; tries++)
+            {
+                RA8876_POLL();
+                if (LCD_StatusRead() & 0x20)
+                    break;
+            }
+        }
+        bus_8876.burstReadPixels(pixels, n);
+        RA8876_COUNT(countBurst(n * 2));
+        pixels += n;
+        count -= n;
+    }
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::Readback_End()
+{
+    const uint8_t regs[8][2] =
+    {
+        {0x56, readWin_8876[0]}, {0x57, readWin_8876[1]},
+        {0x58, readWin_8876[2]}, {0x59, readWin_8876[3]},
+        {0x5A, readWin_8876[4]}, {0x5B, readWin_8876[5]},
+        {0x5C, readWin_8876[6]}, {0x5D, readWin_8876[7]},
+    };
+    LCD_RegisterWriteList(regs, 8);
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::Read_Region(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *pixels)
+{
+    Readback_Begin(x, y, w, h);
+    Readback_Chunk(pixels, (uint32_t)w * h);
+    Readback_End();
+}
+
+static void bmpPut(uint8_t *p, uint32_t value, uint8_t bytes)
+{
+    while (bytes--)
+    {
+        *p++ = (uint8_t)value;
+        value >>= 8;
+    }
+}
+
+// BITMAPINFOHEADER with RGB565 bit fields and a negative height, so rows go
+// out top to bottom in the order they are read.
+template<class Bus>
+void RA8876_Driver<Bus>::Screenshot(Print &out, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    uint32_t row = ((uint32_t)w * 2 + 3) & ~3UL;
+    uint8_t hdr[66];
+    uint16_t pixels[RA8876_SPI_CHUNK / 2];
+    uint8_t buf[RA8876_SPI_CHUNK];
+
+    memset(hdr, 0, sizeof(hdr));
+    hdr[0] = 'B';
+    hdr[1] = 'M';
+    bmpPut(hdr + 2, sizeof(hdr) + row * h, 4);  // file size
+    bmpPut(hdr + 10, sizeof(hdr), 4);           // pixel data offset
+    bmpPut(hdr + 14, 40, 4);                    // info header size
+    bmpPut(hdr + 18, w, 4);
+    bmpPut(hdr + 22, (uint32_t)-(int32_t)h, 4);
+    bmpPut(hdr + 26, 1, 2);                     // planes
+    bmpPut(hdr + 28, 16, 2);                    // bits per pixel
+    bmpPut(hdr + 30, 3, 4);                     // BI_BITFIELDS
+    bmpPut(hdr + 34, row * h, 4);
+    bmpPut(hdr + 54, 0xF800, 4);                // red, green, blue masks
+    bmpPut(hdr + 58, 0x07E0, 4);
+    bmpPut(hdr + 62, 0x001F, 4);
+    out.write(hdr, sizeof(hdr));
+
+    Readback_Begin(x, y, w, h);
+    for (uint16_t j = 0; j < h; j++)
+    {
+        for (uint16_t i = 0; i < w; )
+        {
+            uint16_t n = w - i;
+            if (n > RA8876_SPI_CHUNK / 2)
+                n = RA8876_SPI_CHUNK / 2;
+            Readback_Chunk(pixels, n);
+            for (uint16_t k = 0; k < n; k++)
+                bmpPut(buf + 2 * k, pixels[k], 2);
+            out.write(buf, n * 2);
+            i += n;
+        }
+        memset(buf, 0, 4);
+        out.write(buf, row - (uint32_t)w * 2);
+    }
+    Readback_End();
+}
+
+template<class Bus>
+void RA8876_Driver<Bus>::Graphic_cursor_initial()
 {
     uint16_t i ;
     
@@ -7532,7 +8200,8 @@ void ER_TFTM0784::Graphic_cursor_initial()
 }
 
 
-void ER_TFTM0784::Text_cursor_initial()
+template<class Bus>
+void RA8876_Driver<Bus>::Text_cursor_initial()
 {
     
     //Disable_Text_Cursor();
@@ -7549,8 +8218,17 @@ void ER_TFTM0784::Text_cursor_initial()
 //
 ///////////////////////////////////////////////////////////////////////////////
 
-
-
-
-
-
+#ifdef ARDUINO
+template class RA8876_Driver<RA8876_DynamicBus>;
+template class RA8876_Driver<RA8876_SpiBus>;
+template class RA8876_Driver<RA8876_Parallel16Bus>;
+template class RA8876_Driver<RA8876_Parallel8Bus>;
+#else
+template class RA8876_Driver<RA8876_LinuxSpiBus>;
+#endif
+#ifdef RA8876_TRACE
+template class RA8876_Driver<RA8876_TraceBus<ER_TFTM0784_Bus> >;
+#endif
+#ifdef RA8876_EXTRA_BUS
+template class RA8876_Driver<RA8876_EXTRA_BUS>;
+#endif
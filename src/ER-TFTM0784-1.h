@@ -1,10 +1,16 @@
 #ifndef __ERTFT_H__
 #define __ERTFT_H__
 
+#ifdef ARDUINO
 #include <Arduino.h>
+#include <avr/pgmspace.h>
+#else
+#include "RA8876_Host.h"
+#endif
 #include <stdlib.h>
 #include <stdint.h>
-#include <avr/pgmspace.h>
+
+#define ER_TFTM0784_VERSION     "0.0.1"     // as in library.properties
 
 //#include "2828.h"
 //----------------------------//
@@ -63,6 +69,319 @@
 #define CORE_DIVM1        // 0
 //#define CORE_DIVM2   // 1
 
+/*==== [SW_(2)]  Register shadow  =====*/
+// Keep a copy of the RA8876 configuration registers in RAM. Bit set/clear
+// helpers then no longer read the register back over the bus, and writes
+// that would not change the register are dropped. Costs about 290 bytes.
+//#define RA8876_SHADOW_REGISTERS
+
+/*==== [SW_(3)]  8080 parallel host bus  =====*/
+// Strobe timing in RA8876 core clock periods (Tc), see the 8080 MCU interface
+// AC characteristics. Tc follows OSC_FREQ until the PLL is up, CORE_FREQ after.
+#define RA8876_PAR_TWR      2   // /WR low pulse width
+#define RA8876_PAR_TWH      2   // /CS high between two bus cycles
+#define RA8876_PAR_TRD      4   // /RD low to data valid
+// Data pins may be spread over at most this many MCU ports, otherwise the
+// bus falls back to digitalWrite()/digitalRead().
+#define RA8876_PAR_PORTS    4
+
+/*==== [SW_(4)]  Host bus  =====*/
+// ER-TFTM0784-1.cpp builds RA8876_Driver for the transports in RA8876_Bus.h.
+// Add one more here, e.g. SPI with CS/RST fixed at compile time:
+//#define RA8876_EXTRA_BUS RA8876_SpiBusPins<10, 9>
+// Displays sharing one SPI bus through an RA8876_SpiGroup, at most 16.
+#define RA8876_SPI_GROUP_MAX    8
+
+/*==== [SW_(5)]  SPI clock calibration  =====*/
+// LCD_SpiCalibrate() writes test pixels to these SDRAM bytes, in the last
+// 4 KB of the 16 MB SDRAM, above the seven 400x1280 16bpp layers the demo
+// uses. Move it for a smaller SDRAM or if the sketch keeps images there.
+#define RA8876_SPI_CAL_ADDR     0x00FFF000
+#define RA8876_SPI_CAL_BYTES    128
+#define RA8876_SPI_CAL_PASSES   8       // patterns per clock step
+#define RA8876_SPI_SAFE_HZ      1000000 // clock the results are checked at
+
+/*==== [SW_(6)]  Bus trace  =====*/
+// Record every bus cycle of ER_TFTM0784 into a RAM ring buffer, see
+// RA8876_Trace.h. Costs 6 bytes per record.
+//#define RA8876_TRACE
+#define RA8876_TRACE_RECORDS    256
+
+/*==== [SW_(7)]  Bus statistics  =====*/
+// Count bus cycles, bytes and busy-wait polling per display, split by
+// RA8876_STATS_SCOPE tags, see RA8876_Stats.h. Costs 64 bytes per tag.
+//#define RA8876_STATS
+#define RA8876_STATS_TAGS       4
+
+/*==== [SW_(8)]  Memory write FIFO  =====*/
+// Streamed text and pixels check the status register once per block of
+// writes rather than after each one, see RA8876_FifoCredit in RA8876_Bus.h.
+// A block is at most the FIFO depth.
+#define RA8876_WR_FIFO_DEPTH        16
+
+/*==== [SW_(9)]  Completion interrupt  =====*/
+// Engine_IrqAttach() lets the BTE, draw and DMA waits sleep until the INT
+// pin instead of polling, see RA8876_Irq.h. RA8876_IRQ_PINS is how many
+// INT pins can be attached at once on Arduino (at most 4). After
+// RA8876_IRQ_TIMEOUT_MS without INT the wait checks the engine again, so
+// a missed edge costs time but cannot hang.
+#define RA8876_IRQ_PINS         2
+#define RA8876_IRQ_TIMEOUT_MS   100
+
+/*==== [SW_(10)]  Command queue  =====*/
+// RA8876_Queue (RA8876_Queue.h) holds RA8876_QUEUE_DEPTH commands between
+// the drawing threads and the display task; RA8876_QUEUE_TEXT is the
+// longest text() string plus one. Each slot takes about 32 bytes plus the
+// text. The depth must be a power of two.
+#define RA8876_QUEUE_DEPTH      32
+#define RA8876_QUEUE_TEXT       32
+
+/*==== [SW_(11)]  Memory readback  =====*/
+// Readback_Chunk() waits for the memory read FIFO to fill, then reads this
+// many pixels without looking at it again. Lower it if read back images
+// show repeated or shifted pixels.
+#define RA8876_RD_FIFO_DEPTH    16
+
+/*==== [SW_(12)]  Panel timing  =====*/
+// Written by RA8876_initial(), in pixels and lines, and checked against the
+// register ranges below. The HSYNC start and pulse width go in steps of 8
+// pixels and are rounded down.
+#define RA8876_PANEL_WIDTH      400
+#define RA8876_PANEL_HEIGHT     1280
+#define RA8876_PANEL_HBP        160     // horizontal non-display (back porch)
+#define RA8876_PANEL_HFP        160     // HSYNC start (front porch)
+#define RA8876_PANEL_HPW        24      // HSYNC pulse width
+#define RA8876_PANEL_VBP        10      // vertical non-display (back porch)
+#define RA8876_PANEL_VFP        12      // VSYNC start (front porch)
+#define RA8876_PANEL_VPW        2       // VSYNC pulse width
+
+/*==== [SW_(13)]  Warm start  =====*/
+// RA8876_initial() leaves a signature in these SDRAM bytes, just past the
+// calibration bytes at the top of the 16 MB SDRAM and clear of the demo's
+// layers, for RA8876_WarmStart() to find after an MCU restart.
+#define RA8876_WARM_ADDR        0x00FFF080
+#define RA8876_WARM_BYTES       8
+
+/*==== [SW_(14)]  Boot splash  =====*/
+// Splash_Flash() writes these whole instead of setting their bits one read
+// back at a time: [01h] as RA8876_PLL_Initial() left it plus the serial
+// flash interface, and [B7h] as the demos use the on-board W25Q128: flash
+// 1, DMA mode, 24-bit address, mode 3, 8 dummy cycles, single mode. [BBh]
+// is the flash clock divider.
+#define RA8876_SPLASH_CCR       0x82
+#define RA8876_SPLASH_SFCR      0xD4
+#define RA8876_SPLASH_SPI_DIV   0x00
+
+//------------------------------------------------------------------------------
+// Derived settings
+//------------------------------------------------------------------------------
+// What SW_(1), SW_(12) and the SDRAM chosen in HW_(3) come to, worked out at
+// compile time. A combination outside the RA8876's register ranges or clock
+// rules stops the build here instead of leaving the panel blank.
+
+//=====[05h] [07h] [09h]: PLLDIVK in b3-b1, PLLDIVM in b0
+#if defined(SCAN_DIVK1)
+#define RA8876_SCAN_DIVK    0
+#elif defined(SCAN_DIVK2)
+#define RA8876_SCAN_DIVK    1
+#elif defined(SCAN_DIVK4)
+#define RA8876_SCAN_DIVK    2
+#elif defined(SCAN_DIVK8)
+#define RA8876_SCAN_DIVK    3
+#elif defined(SCAN_DIVK16)
+#define RA8876_SCAN_DIVK    4
+#elif defined(SCAN_DIVK32)
+#define RA8876_SCAN_DIVK    5
+#elif defined(SCAN_DIVK64)
+#define RA8876_SCAN_DIVK    6
+#elif defined(SCAN_DIVK128)
+#define RA8876_SCAN_DIVK    7
+#else
+#error "SW_(1): define one of SCAN_DIVK1 .. SCAN_DIVK128"
+#endif
+
+#if defined(DRAM_DIVK1)
+#define RA8876_DRAM_DIVK    0
+#elif defined(DRAM_DIVK2)
+#define RA8876_DRAM_DIVK    1
+#elif defined(DRAM_DIVK4)
+#define RA8876_DRAM_DIVK    2
+#elif defined(DRAM_DIVK8)
+#define RA8876_DRAM_DIVK    3
+#else
+#error "SW_(1): define one of DRAM_DIVK1 .. DRAM_DIVK8"
+#endif
+
+#if defined(CORE_DIVK1)
+#define RA8876_CORE_DIVK    0
+#elif defined(CORE_DIVK2)
+#define RA8876_CORE_DIVK    1
+#elif defined(CORE_DIVK4)
+#define RA8876_CORE_DIVK    2
+#elif defined(CORE_DIVK8)
+#define RA8876_CORE_DIVK    3
+#else
+#error "SW_(1): define one of CORE_DIVK1 .. CORE_DIVK8"
+#endif
+
+// PLLDIVM is 0 unless DIVM2 is chosen.
+#ifdef SCAN_DIVM2
+#define RA8876_SCAN_DIVM    1
+#else
+#define RA8876_SCAN_DIVM    0
+#endif
+#ifdef DRAM_DIVM2
+#define RA8876_DRAM_DIVM    1
+#else
+#define RA8876_DRAM_DIVM    0
+#endif
+#ifdef CORE_DIVM2
+#define RA8876_CORE_DIVM    1
+#else
+#define RA8876_CORE_DIVM    0
+#endif
+
+// PLL = OSC_FREQ * (PLLDIVN + 1) / ((PLLDIVM + 1) * 2^PLLDIVK), so PLLDIVN
+// for a clock of 'mhz', rounded down; 0xFFFF when 'mhz' is out of reach.
+static constexpr uint16_t ra8876PllDivN(uint16_t mhz, uint8_t divm, uint8_t divk)
+{
+    return (uint32_t)mhz * (divm + 1) * (1UL << divk) / OSC_FREQ - 1;
+}
+
+// The VCO runs at OSC_FREQ * (PLLDIVN + 1) / (PLLDIVM + 1), in MHz.
+static constexpr uint32_t ra8876PllVco(uint16_t divn, uint8_t divm)
+{
+    return (uint32_t)OSC_FREQ * (divn + 1) / (divm + 1);
+}
+
+static constexpr uint32_t ra8876PllKhz(uint16_t divn, uint8_t divm, uint8_t divk)
+{
+    return 1000UL * ra8876PllVco(divn, divm) / (1UL << divk);
+}
+
+static constexpr uint16_t RA8876_SCAN_DIVN = ra8876PllDivN(SCAN_FREQ, RA8876_SCAN_DIVM, RA8876_SCAN_DIVK);
+static constexpr uint16_t RA8876_DRAM_DIVN = ra8876PllDivN(DRAM_FREQ, RA8876_DRAM_DIVM, RA8876_DRAM_DIVK);
+static constexpr uint16_t RA8876_CORE_DIVN = ra8876PllDivN(CORE_FREQ, RA8876_CORE_DIVM, RA8876_CORE_DIVK);
+
+// The clocks actually set, in kHz.
+static constexpr uint32_t RA8876_SCAN_KHZ = ra8876PllKhz(RA8876_SCAN_DIVN, RA8876_SCAN_DIVM, RA8876_SCAN_DIVK);
+static constexpr uint32_t RA8876_DRAM_KHZ = ra8876PllKhz(RA8876_DRAM_DIVN, RA8876_DRAM_DIVM, RA8876_DRAM_DIVK);
+static constexpr uint32_t RA8876_CORE_KHZ = ra8876PllKhz(RA8876_CORE_DIVN, RA8876_CORE_DIVM, RA8876_CORE_DIVK);
+
+// [06h] [08h] [0Ah] hold PLLDIVN in 6 bits, and each VCO must stay within
+// 100 - 600 MHz: raise PLLDIVK for a VCO that is too slow.
+static_assert(RA8876_SCAN_DIVN >= 1 && RA8876_SCAN_DIVN <= 63, "SW_(1): SCAN_FREQ out of reach of SCAN_DIVK/SCAN_DIVM");
+static_assert(RA8876_DRAM_DIVN >= 1 && RA8876_DRAM_DIVN <= 63, "SW_(1): DRAM_FREQ out of reach of DRAM_DIVK/DRAM_DIVM");
+static_assert(RA8876_CORE_DIVN >= 1 && RA8876_CORE_DIVN <= 63, "SW_(1): CORE_FREQ out of reach of CORE_DIVK/CORE_DIVM");
+static_assert(ra8876PllVco(RA8876_SCAN_DIVN, RA8876_SCAN_DIVM) >= 100 &&
+              ra8876PllVco(RA8876_SCAN_DIVN, RA8876_SCAN_DIVM) <= 600, "SW_(1): scan PLL VCO outside 100 - 600 MHz");
+static_assert(ra8876PllVco(RA8876_DRAM_DIVN, RA8876_DRAM_DIVM) >= 100 &&
+              ra8876PllVco(RA8876_DRAM_DIVN, RA8876_DRAM_DIVM) <= 600, "SW_(1): SDRAM PLL VCO outside 100 - 600 MHz");
+static_assert(ra8876PllVco(RA8876_CORE_DIVN, RA8876_CORE_DIVM) >= 100 &&
+              ra8876PllVco(RA8876_CORE_DIVN, RA8876_CORE_DIVM) <= 600, "SW_(1): core PLL VCO outside 100 - 600 MHz");
+
+// The core runs at most at 120 MHz and no faster than the SDRAM (at most
+// 166 MHz); the panel is scanned no faster than the core.
+static_assert(RA8876_CORE_KHZ <= 120000UL, "SW_(1): CORE_FREQ above 120 MHz");
+static_assert(RA8876_DRAM_KHZ <= 166000UL, "SW_(1): DRAM_FREQ above 166 MHz");
+static_assert(RA8876_CORE_KHZ <= RA8876_DRAM_KHZ, "SW_(1): CORE_FREQ above DRAM_FREQ");
+static_assert(RA8876_SCAN_KHZ <= RA8876_CORE_KHZ, "SW_(1): SCAN_FREQ above CORE_FREQ");
+
+//=====[14h] - [1Fh] from SW_(12)
+// Horizontal registers hold pixels / 8 - 1, plus a fine tuning register for
+// the remainder where there is one.
+static constexpr uint8_t ra8876Coarse(uint16_t px)
+{
+    return px / 8 - 1;
+}
+
+static constexpr uint8_t ra8876Fine(uint16_t px)
+{
+    return px % 8;
+}
+
+static_assert(RA8876_PANEL_WIDTH >= 8 && RA8876_PANEL_WIDTH <= 2048, "SW_(12): RA8876_PANEL_WIDTH out of range 8 - 2048");
+static_assert(RA8876_PANEL_HBP >= 8 && RA8876_PANEL_HBP <= 263, "SW_(12): RA8876_PANEL_HBP out of range 8 - 263");
+static_assert(RA8876_PANEL_HFP >= 8 && RA8876_PANEL_HFP <= 263, "SW_(12): RA8876_PANEL_HFP out of range 8 - 263");
+static_assert(RA8876_PANEL_HPW >= 8 && RA8876_PANEL_HPW <= 263, "SW_(12): RA8876_PANEL_HPW out of range 8 - 263");
+static_assert(RA8876_PANEL_HEIGHT >= 1 && RA8876_PANEL_HEIGHT <= 2048, "SW_(12): RA8876_PANEL_HEIGHT out of range 1 - 2048");
+static_assert(RA8876_PANEL_VBP >= 1 && RA8876_PANEL_VBP <= 1024, "SW_(12): RA8876_PANEL_VBP out of range 1 - 1024");
+static_assert(RA8876_PANEL_VFP >= 1 && RA8876_PANEL_VFP <= 256, "SW_(12): RA8876_PANEL_VFP out of range 1 - 256");
+static_assert(RA8876_PANEL_VPW >= 1 && RA8876_PANEL_VPW <= 64, "SW_(12): RA8876_PANEL_VPW out of range 1 - 64");
+
+static constexpr uint8_t RA8876_HDWR = ra8876Coarse(RA8876_PANEL_WIDTH);
+static constexpr uint8_t RA8876_HDWFTR = ra8876Fine(RA8876_PANEL_WIDTH);
+static constexpr uint8_t RA8876_HNDR = ra8876Coarse(RA8876_PANEL_HBP);
+static constexpr uint8_t RA8876_HNDFTR = ra8876Fine(RA8876_PANEL_HBP);
+static constexpr uint8_t RA8876_HSTR = ra8876Coarse(RA8876_PANEL_HFP);
+static constexpr uint8_t RA8876_HPWR = ra8876Coarse(RA8876_PANEL_HPW);
+static constexpr uint16_t RA8876_VDHR = RA8876_PANEL_HEIGHT - 1;
+static constexpr uint16_t RA8876_VNDR = RA8876_PANEL_VBP - 1;
+static constexpr uint8_t RA8876_VSTR = RA8876_PANEL_VFP - 1;
+static constexpr uint8_t RA8876_VPWR = RA8876_PANEL_VPW - 1;
+
+// Pixel clocks per line and lines per frame as scanned, HSYNC start and
+// width rounded down to 8.
+static constexpr uint32_t RA8876_LINE_CLOCKS = RA8876_PANEL_WIDTH + RA8876_PANEL_HBP +
+    (RA8876_HSTR + 1) * 8UL + (RA8876_HPWR + 1) * 8UL;
+static constexpr uint32_t RA8876_FRAME_LINES = RA8876_PANEL_HEIGHT + RA8876_PANEL_VBP +
+    RA8876_PANEL_VFP + RA8876_PANEL_VPW;
+static constexpr uint32_t RA8876_LINES_PER_S = RA8876_SCAN_KHZ * 1000UL / RA8876_LINE_CLOCKS;
+// Frame rate in hundredths of a hertz.
+static constexpr uint32_t RA8876_FRAME_CHZ = RA8876_LINES_PER_S * 100UL / RA8876_FRAME_LINES;
+
+//=====[E2h] [E3h]: SDRAM auto refresh interval
+// Every row refreshed in 64 ms, in MCLK cycles, less 2 for margin.
+#if defined(IS42S16400F) || defined(M12L32162A) || defined(MT48LC4M16A) || \
+    defined(K4S641632N) || defined(K4S281632K)
+#define RA8876_SDRAM_ROWS   4096
+#else
+#define RA8876_SDRAM_ROWS   8192
+#endif
+static constexpr uint16_t RA8876_SDRAM_ITV = 64UL * RA8876_DRAM_KHZ / RA8876_SDRAM_ROWS - 2;
+
+// SDRAM bandwidth in bytes per second: 16 bits per MCLK at best, less an
+// auto refresh of about RA8876_SDRAM_TRC cycles every RA8876_SDRAM_ITV, less
+// the panel scan reading the 16bpp main window once a frame. What is left is
+// for the BTE, the drawing engine, serial flash DMA and the host.
+#define RA8876_SDRAM_TRC    8
+static constexpr uint32_t RA8876_SDRAM_BYTES_PER_S = RA8876_DRAM_KHZ * 2000UL;
+static constexpr uint32_t RA8876_REFRESH_BYTES_PER_S =
+    RA8876_SDRAM_BYTES_PER_S / (RA8876_SDRAM_ITV + 2) * RA8876_SDRAM_TRC;
+static constexpr uint32_t RA8876_SCAN_BYTES_PER_S =
+    RA8876_LINES_PER_S * RA8876_PANEL_HEIGHT / RA8876_FRAME_LINES * RA8876_PANEL_WIDTH * 2UL;
+static_assert(RA8876_REFRESH_BYTES_PER_S + RA8876_SCAN_BYTES_PER_S < RA8876_SDRAM_BYTES_PER_S,
+              "SW_(1): the panel scan needs more than DRAM_FREQ gives");
+static constexpr uint32_t RA8876_BTE_BYTES_PER_S =
+    RA8876_SDRAM_BYTES_PER_S - RA8876_REFRESH_BYTES_PER_S - RA8876_SCAN_BYTES_PER_S;
+
+#include "RA8876_Bus.h"
+#include "RA8876_Irq.h"
+#include "RA8876_List.h"
+#ifdef RA8876_TRACE
+#include "RA8876_Trace.h"
+#endif
+#ifdef RA8876_STATS
+#include "RA8876_Stats.h"
+// Count the display's traffic under 'tag' until the end of the block.
+#define RA8876_STATS_SCOPE(tft, tag)    RA8876_StatsScope ra8876_scope_((tft).stats(), tag)
+#else
+#define RA8876_STATS_SCOPE(tft, tag)
+#endif
+
+// Result of LCD_SpiCalibrate(). Plain data, so a sketch can keep it in
+// EEPROM and hand it to LCD_SpiRestore() on later boots.
+#define RA8876_SPI_CAL_MAGIC    0x8876
+struct RA8876_SpiCal {
+    uint16_t magic;         // RA8876_SPI_CAL_MAGIC if calibration passed
+    uint16_t write_errors;  // miscompares one step above write_max_hz
+    uint16_t read_errors;   // miscompares one step above read_max_hz
+    uint32_t write_hz;      // clocks set: one step below the fastest pass,
+    uint32_t read_hz;       // unless nothing faster was tried
+    uint32_t write_max_hz;  // fastest clocks that passed every pattern
+    uint32_t read_max_hz;
+};
+
 #define color256_black   0x00
 #define color256_white   0xff
 #define color256_red     0xe0
@@ -672,11 +991,42 @@ const uint8_t gImage_pen_il[256] PROGMEM =
 };
 
 
+// Engine operation left running by the driver, see RA8876_Driver::fence().
+#define RA8876_ENGINE_IDLE      0
+#define RA8876_ENGINE_DRAW      1   // geometric draw, [67h] or [76h]
+#define RA8876_ENGINE_BTE       2   // BTE from SDRAM, or a fill
+#define RA8876_ENGINE_BTE_MCU   3   // BTE fed or read through the memory port
+#define RA8876_ENGINE_DMA       4   // serial flash DMA
+
+// BTE_Enable() classifies the operation from the code BTE_Operation_Code()
+// or List_Play() last wrote to [91h], without reading it back. Until one of
+// them has, and after LCD_ShadowInvalidate() (call it after writing [91h]
+// any other way), the code is RA8876_BTE_OP_UNKNOWN and read once.
+#define RA8876_BTE_OP_UNKNOWN   0xFF
+
 //--
-class ER_TFTM0784 {
+// Bus is one of the transports in RA8876_Bus.h; the constructor arguments
+// are passed on to it unchanged.
+template<class Bus>
+class RA8876_Driver {
 public:
-    ER_TFTM0784(uint8_t rs_pin, uint8_t cs_pin, uint8_t wr_pin, uint8_t rd_pin, uint8_t next_pin, uint8_t d0_pin, uint8_t d1_pin, uint8_t d2_pin, uint8_t d3_pin, uint8_t d4_pin, uint8_t d5_pin, uint8_t d6_pin, uint8_t d7_pin, uint8_t d8_pin, uint8_t d9_pin, uint8_t d10_pin, uint8_t d11_pin, uint8_t d12_pin, uint8_t d13_pin, uint8_t d14_pin, uint8_t d15_pin, uint8_t rst_pin); // 16-bit parallel mode
-    ER_TFTM0784(uint32_t spi_speed, uint8_t sdi_pin, uint8_t sdo_pin, uint8_t sclk_pin, uint8_t cs_pin, uint8_t rst_pin); // 4-pin SPI mode
+    template<typename... Args>
+    RA8876_Driver(Args... args) : bus_8876(args...)
+    {
+#ifdef RA8876_SHADOW_REGISTERS
+        reg_8876 = 0;
+#endif
+        LCD_ShadowInvalidate();
+        uploadBase_8876 = 0;
+        uploadSeq_8876 = 0;
+        irq_8876 = NULL;
+        engine_8876 = RA8876_ENGINE_IDLE;
+        list_8876 = NULL;
+    }
+    Bus &bus() { return bus_8876; }
+#ifdef RA8876_STATS
+    RA8876_Stats &stats() { return stats_8876; }
+#endif
     void LCD_DataWrite(uint8_t data);
     void LCD_DataWrite16(uint16_t data);
     uint16_t LCD_DataRead();
@@ -686,9 +1036,34 @@ public:
     void Text_Mode();
     void LCD_RegisterWrite(uint8_t Cmd, uint8_t Data);
     uint8_t LCD_RegisterRead(uint8_t Cmd);
+    uint8_t LCD_RegisterReadDirect(uint8_t Cmd);
+    void LCD_ShadowInvalidate();
+    void LCD_RegisterWriteList(const uint8_t (*pairs)[2], uint8_t count);
+    void LCD_RegisterWriteList_P(const uint8_t (*pairs)[2], uint8_t count);
+    void LCD_BatchBegin();
+    void LCD_BatchEnd();
+
+    // Find the fastest reliable SPI write and read clocks (up to max_hz)
+    // with test patterns in scratch registers and SDRAM, and switch to
+    // them. Run after RA8876_initial(). Returns zeros on the parallel bus.
+    RA8876_SpiCal LCD_SpiCalibrate(uint32_t max_hz);
+    bool LCD_SpiRestore(const RA8876_SpiCal &cal);
+    void LCD_SpiCalReport(Print &out, const RA8876_SpiCal &cal);
     
     
+    // Reset, PLL and SDRAM set-up, then every other configuration register
+    // in one burst from a table worked out at compile time, without reading
+    // anything back.
     void RA8876_initial();
+    // The table part of RA8876_initial() alone, for RA8876_Boot.
+    void RA8876_Register_Initial();
+    // After an MCU restart, in place of RA8876_HW_Reset() and
+    // RA8876_initial(): true if the RA8876 is still running as they left it
+    // (PLL on, SDRAM ready, the SW_(13) signature in place). The driver is
+    // then brought in line without touching the chip, so the picture on
+    // screen and everything in SDRAM stay. False: start cold. Call after
+    // RA8876_IO_Init().
+    bool RA8876_WarmStart();
     //Set PLL
     void RA8876_PLL_Initial();
     //Set SDRAM
@@ -712,6 +1087,38 @@ public:
     
     void Check_Busy_Draw();
     void Check_Busy_SFI_DMA();
+
+    // Let Check_BTE_Busy(), Check_Busy_Draw(), Check_2D_Busy() and
+    // Check_Busy_SFI_DMA() sleep until the RA8876 INT pin rather than poll:
+    // they check the engine once before and once after each interrupt.
+    // Call after RA8876_initial() with 'irq' attached to INT; NULL goes
+    // back to polling.
+    void Engine_IrqAttach(RA8876_Irq *irq);
+
+    // Draws, BTE operations and serial flash DMA are left running when
+    // started. The driver waits for them only when a register the running
+    // operation uses, or SDRAM through the memory port, is next touched, so
+    // setting up the next operation of another engine overlaps with it.
+    // fence() waits right away, e.g. before reading the picture back by
+    // other means; Check_BTE_Busy() and friends still work as barriers.
+    void fence();
+    uint8_t Engine_Running() const { return engine_8876; }
+
+    // Credit based flow control for streams to the memory write port: call
+    // Mem_WR_FIFO_Reset() after LCD_CmdWrite(0x04), then Mem_WR_FIFO_Reserve()
+    // before each data write. Replaces Check_Mem_WR_FIFO_not_Full() after
+    // each write, reading status once per block instead.
+    void Mem_WR_FIFO_Reset() { fifo_8876.reset(); }
+    void Mem_WR_FIFO_Reserve();
+
+    // Display lists, see RA8876_List.h. List_Record(rec) sends the
+    // register writes that follow into rec's list instead of the display;
+    // List_Record(NULL) stops. List_Play() sends a recorded list,
+    // List_Play_P() one kept in PROGMEM. Given a 'canvas' address, the list
+    // draws there instead of into the canvas it sets itself.
+    void List_Record(RA8876_ListRecorder *rec);
+    void List_Play(const uint8_t *list, uint16_t len, uint32_t canvas = RA8876_LIST_SAME_CANVAS);
+    void List_Play_P(const uint8_t *list, uint16_t len, uint32_t canvas = RA8876_LIST_SAME_CANVAS);
     
     //**[00h]**//
     void RA8876_SW_Reset();
@@ -1136,6 +1543,11 @@ public:
     
     //REG[B6h] Serial flash DMA Controller REG (DMA_CTRL)
     void Start_SFI_DMA();
+    // Start a serial flash DMA of a whole-panel 16bpp image at 'addr' into
+    // the canvas at 0, 0, in one register burst without reading anything
+    // back (SW_(14)). For a splash straight after RA8876_initial(); the DMA
+    // is left running.
+    void Splash_Flash(uint32_t addr);
     //void Check_Busy_SFI_DMA();
     
     //REG[B7h] Serial Flash/ROM Controller Register (SFL_CTRL)
@@ -1340,6 +1752,30 @@ public:
     void Show_String(const char *str);
     void Show_picture(uint32_t numbers, const uint16_t *datap);
     void Show_picture(uint32_t numbers, const uint8_t *datap);
+
+    // Streaming upload of 16bpp pixels from RAM to the memory write port,
+    // after canvas, active window and cursor are set up as for Show_picture.
+    // Upload_Chunk() returns a handle at once where the SPI core can do DMA
+    // (one chunk on the wire, one queued); the buffer must stay untouched
+    // until Upload_Done(handle). No other display call between Begin and End.
+    void Upload_Begin();
+    uint32_t Upload_Chunk(const uint16_t *pixels, uint32_t count);
+    bool Upload_Done(uint32_t handle);
+    void Upload_Wait(uint32_t handle);
+    void Upload_End();
+
+    // Read 16bpp pixels of a canvas region back from SDRAM, row by row,
+    // after canvas address and width are set up as for drawing. Between
+    // Begin and End the active window is the region; End puts it back.
+    // Read_Region() does all three into one buffer of w * h pixels.
+    void Readback_Begin(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void Readback_Chunk(uint16_t *pixels, uint32_t count);
+    void Readback_End();
+    void Read_Region(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t *pixels);
+    // Send a region to 'out' (Serial, or RA8876_FilePrint on Linux) as a
+    // 16bpp BMP file, a few pixels at a time.
+    void Screenshot(Print &out, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
     void LCD_Clear(uint16_t Color);
     void LCD_SetCursor(uint16_t Xpos, uint16_t Ypos);
     void LCD_PutChar(uint16_t x, uint16_t y, uint8_t c, uint16_t charColor, uint16_t bkColor);
@@ -1354,49 +1790,59 @@ public:
     void RA8876_IO_Init();
     
 private:
-    inline void bus_delay();
     void Enable_ExtInterrupt_Inpur_Flag();
     void Text_cursor_initial();
-    void dataBusSetDirection8(uint8_t dir);
-    void dataBusSetDirection16(uint8_t dir);
-    uint8_t dataBusRead8();
-    uint16_t dataBusRead16();
-    void dataBusWrite8(uint8_t x);
-    void dataBusWrite16(uint16_t x);
-    void startSend();
-    void endSend();
-    
-    uint8_t mode_8876;
-    uint32_t SPI_SPEED_8876;
-    
-    // pins
-    uint8_t RST_8876;
-    uint8_t CS_SER_8876;
-    uint8_t SDI_8876;
-    uint8_t SDO_8876;
-    uint8_t SCLK_8876;
-    uint8_t RS_8876;
-    uint8_t CS_PAR_8876;
-    uint8_t WR_8876;
-    uint8_t RD_8876;
-    uint8_t NEXT_8876;
-    uint8_t D0;
-    uint8_t D1;
-    uint8_t D2;
-    uint8_t D3;
-    uint8_t D4;
-    uint8_t D5;
-    uint8_t D6;
-    uint8_t D7;
-    uint8_t D8;
-    uint8_t D9;
-    uint8_t D10;
-    uint8_t D11;
-    uint8_t D12;
-    uint8_t D13;
-    uint8_t D14;
-    uint8_t D15;
+    void LCD_RegisterWrite16(uint8_t reg, uint16_t value);
+    void LCD_RegisterWrite32(uint8_t reg, uint32_t value);
+    void LCD_RegisterWriteXY(uint8_t reg, uint16_t WX, uint16_t HY);
+    void spiCalSave(uint8_t *save);
+    void spiCalRestore(const uint8_t *save);
+    void spiCalMask(uint8_t *mask);
+    void spiCalFill(uint8_t seed);
+    uint16_t spiCalCheck(uint8_t seed, const uint8_t *mask, bool sdram);
+    uint8_t spiCalSearch(uint32_t max_hz, bool read, const uint8_t *mask, uint16_t *errors);
+    bool engineDepends(uint8_t reg);
+    bool engineBusy(bool dma);
+    bool engineIrqStep(bool dma);
+    uint8_t shadowKeepMask(uint8_t reg);
+    void warmTag(uint16_t *tag);
+    void warmSeek();
+    uint8_t listRead(uint8_t reg, bool direct);
+    template<class Get>
+    void listPlay(const uint8_t *list, uint16_t len, uint32_t canvas, Get get);
+    
+    Bus bus_8876;
+    uint32_t uploadBase_8876;   // bus_8876.burstCompleted() at Upload_Begin()
+    uint32_t uploadSeq_8876;    // last handle given out by Upload_Chunk()
+    uint8_t readWin_8876[8];    // active window saved by Readback_Begin()
+    RA8876_FifoCredit fifo_8876;
+    RA8876_Irq *irq_8876;       // NULL: engine waits poll the bus
+    uint8_t engine_8876;        // RA8876_ENGINE_*, not waited for yet
+    uint8_t bteOp_8876;         // BTE operation code last written to [91h]
+    RA8876_ListRecorder *list_8876; // recording into, NULL: drawing
+#ifdef RA8876_STATS
+    RA8876_Stats stats_8876;
+#endif
+#ifdef RA8876_SHADOW_REGISTERS
+    void shadowSelect();
+    uint8_t shadow_8876[256];
+    uint8_t shadow_valid_8876[32];
+    uint8_t reg_8876;       // register selected by LCD_CmdWrite()
+    uint16_t latch_8876;    // register the RA8876 address latch points at, 0x100 = unknown
+#endif
 };
 
+#ifdef ARDUINO
+// The original class: bus selected at runtime by the constructor used.
+typedef RA8876_DynamicBus ER_TFTM0784_Bus;
+#else
+typedef RA8876_LinuxSpiBus ER_TFTM0784_Bus;
+#endif
+#ifdef RA8876_TRACE
+typedef RA8876_Driver<RA8876_TraceBus<ER_TFTM0784_Bus> > ER_TFTM0784;
+#else
+typedef RA8876_Driver<ER_TFTM0784_Bus> ER_TFTM0784;
+#endif
+
 #endif
 
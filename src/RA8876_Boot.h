@@ -0,0 +1,298 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Power-on bring-up of the SSD2828 and the RA8876 together. Most of the
+// bridge's sequence is waiting: the reset pulse, sleep out, display on and
+// its PLL settling add up to about 400 ms of delay(). RA8876_Boot runs the
+// RA8876 reset, PLL, SDRAM and register set-up, a clear of the canvas (or
+// a splash image from serial flash) and the application's splash drawing
+// inside those waits instead of after them, and turns the RA8876 display
+// on as soon as they are done. The panel shows it once the bridge has
+// finished.
+//
+//   RA8876_Boot<ER_TFTM0784> boot(tft, bridge);
+//   boot.setFlashSplash(0);                   // optional, image at 0 in flash
+//   boot.setSplash(drawLogo, NULL);           // optional
+//   boot.run();                               // or begin(), then step()
+//   boot.report(Serial);                      //   until it returns true
+//
+// Replaces Reset(), RA8876_IO_Init(), RA8876_HW_Reset(), Initial(),
+// RA8876_initial() and Display_ON() in setup(). A bridge step is sent as
+// soon as it is due; an RA8876 phase is only started while the bridge
+// waits, and runs to its end, so a long splash can delay the bridge but
+// never shortens its waits. Each phase is timed with micros() for
+// report(), and so is the first pixel: the later of the RA8876 display on
+// and the bridge's last step.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_BOOT_H__
+#define __RA8876_BOOT_H__
+
+#include "ER-TFTM0784-1.h"
+#include "2828.h"
+
+#define RA8876_BOOT_RESET       0   // RA8876_IO_Init(), RA8876_HW_Reset()
+#define RA8876_BOOT_PLL         1   // RA8876_SW_Reset(), RA8876_PLL_Initial()
+#define RA8876_BOOT_SDRAM       2   // RA8876_SDRAM_initial()
+#define RA8876_BOOT_REGISTERS   3   // RA8876_Register_Initial()
+#define RA8876_BOOT_CLEAR       4   // canvas fill or Splash_Flash(), left running
+#define RA8876_BOOT_SPLASH      5   // setSplash() function
+#define RA8876_BOOT_DISPLAY     6   // fence(), Display_ON(), once the engines are idle
+#define RA8876_BOOT_BRIDGE      7   // one SSD2828::Boot_Step()
+
+// Phases recorded: 7 RA8876 phases and the bridge's steps.
+#define RA8876_BOOT_RECORDS     16
+
+struct RA8876_BootPhase {
+    uint8_t phase;          // RA8876_BOOT_*
+    uint8_t wait_ms;        // bridge steps: the wait asked for after it
+    uint32_t start_us;      // since begin()
+    uint32_t busy_us;
+};
+
+template<class Driver>
+class RA8876_Boot {
+public:
+    typedef void (*Splash)(Driver &tft, void *ctx);
+
+    RA8876_Boot(Driver &tft, SSD2828 &bridge)
+        : tft_8876(tft), bridge_8876(bridge), splash_8876(NULL), ctx_8876(NULL),
+          clear_8876(0x0000), flash_8876(false), flashAddr_8876(0),
+          next_8876(RA8876_BOOT_RESET), count_8876(0), bridgeDone_8876(false),
+          done_8876(false), idle_8876(false), start_8876(0), due_8876(0),
+          total_8876(0), displayAt_8876(0), bridgeAt_8876(0) { }
+
+    // Colour the canvas is cleared to before the splash.
+    void setClear(uint16_t colour) { clear_8876 = colour; }
+    // Instead of the clear, a whole-panel 16bpp image from serial flash,
+    // see Splash_Flash().
+    void setFlashSplash(uint32_t addr) { flash_8876 = true; flashAddr_8876 = addr; }
+    // Drawn into the canvas after the clear, while the bridge still waits.
+    void setSplash(Splash fn, void *ctx) { splash_8876 = fn; ctx_8876 = ctx; }
+
+    void begin()
+    {
+        next_8876 = RA8876_BOOT_RESET;
+        count_8876 = 0;
+        bridgeDone_8876 = false;
+        done_8876 = false;
+        idle_8876 = false;
+        total_8876 = 0;
+        displayAt_8876 = 0;
+        bridgeAt_8876 = 0;
+        start_8876 = micros();
+        due_8876 = start_8876;
+        bridge_8876.Boot_Begin();
+    }
+
+    // Runs the next due bridge step or RA8876 phase, if any. True once both
+    // chips are done.
+    bool step()
+    {
+        if (done_8876)
+            return true;
+        idle_8876 = false;
+        uint32_t now = micros();
+        if (!bridgeDone_8876 && (int32_t)(now - due_8876) >= 0)
+        {
+            uint8_t ms = bridge_8876.Boot_Step();
+            uint32_t end = micros();
+            record(RA8876_BOOT_BRIDGE, ms, now, end);
+            due_8876 = end + ms * 1000UL;
+            if (ms == 0)
+            {
+                bridgeDone_8876 = true;
+                bridgeAt_8876 = end - start_8876;
+            }
+        }
+        else if (next_8876 < RA8876_BOOT_DISPLAY)
+        {
+            uint8_t phase = next_8876++;
+            run(phase);
+            record(phase, 0, now, micros());
+        }
+        else if (next_8876 == RA8876_BOOT_DISPLAY)
+        {
+            // A splash DMA may take longer than the bridge's waits: poll it
+            // rather than hold up the bridge.
+            if (engineBusy())
+            {
+                idle_8876 = true;
+                return false;
+            }
+            tft_8876.fence();
+            tft_8876.Display_ON();
+            uint32_t end = micros();
+            record(RA8876_BOOT_DISPLAY, 0, now, end);
+            displayAt_8876 = end - start_8876;
+            next_8876++;
+        }
+        else
+            idle_8876 = true;
+        if (!bridgeDone_8876 || next_8876 <= RA8876_BOOT_DISPLAY)
+            return false;
+        total_8876 = micros() - start_8876;
+        done_8876 = true;
+        return true;
+    }
+
+    // begin(), then step() until done, sleeping through the bridge's waits
+    // once nothing else is left.
+    void run()
+    {
+        begin();
+        while (!step())
+        {
+            if (!idle_8876 || next_8876 == RA8876_BOOT_DISPLAY)
+                continue;       // more to do, or polling the engines
+            int32_t left = (int32_t)(due_8876 - micros());
+            if (left > 0)
+                delay((left + 999) / 1000);
+        }
+    }
+
+    bool done() const { return done_8876; }
+    // begin() to both chips done, 0 before.
+    uint32_t total_us() const { return total_8876; }
+    // begin() to the splash on the panel, 0 before.
+    uint32_t firstPixel_us() const
+    {
+        if (!done_8876)
+            return 0;
+        return displayAt_8876 > bridgeAt_8876 ? displayAt_8876 : bridgeAt_8876;
+    }
+    uint8_t count() const { return count_8876; }
+    const RA8876_BootPhase &phase(uint8_t i) const { return rec_8876[i]; }
+
+    // The same work one step after the other: every phase's busy time plus
+    // every bridge wait.
+    uint32_t sequential_us() const
+    {
+        uint32_t us = 0;
+        for (uint8_t i = 0; i < count_8876; i++)
+            us += rec_8876[i].busy_us + rec_8876[i].wait_ms * 1000UL;
+        return us;
+    }
+
+    void report(Print &out)
+    {
+        out.print("RA8876 boot: ");
+        out.print((unsigned long)(total_8876 / 1000));
+        out.print(" ms, first pixel at ");
+        out.print((unsigned long)(firstPixel_us() / 1000));
+        out.print(" ms, ");
+        out.print((unsigned long)(sequential_us() / 1000));
+        out.println(" ms one after the other");
+        for (uint8_t i = 0; i < count_8876; i++)
+        {
+            const RA8876_BootPhase &r = rec_8876[i];
+            out.print("  at ");
+            out.print((unsigned long)(r.start_us / 1000));
+            out.print(" ms ");
+            out.print(name(r.phase));
+            out.print(" ");
+            out.print((unsigned long)r.busy_us);
+            out.print(" us");
+            if (r.wait_ms)
+            {
+                out.print(", wait ");
+                out.print((unsigned long)r.wait_ms);
+                out.print(" ms");
+            }
+            out.println("");
+        }
+    }
+
+private:
+    void run(uint8_t phase)
+    {
+        switch (phase)
+        {
+        case RA8876_BOOT_RESET:
+            tft_8876.RA8876_IO_Init();
+            tft_8876.RA8876_HW_Reset();
+            break;
+        case RA8876_BOOT_PLL:
+            tft_8876.LCD_ShadowInvalidate();
+            tft_8876.RA8876_SW_Reset();
+            tft_8876.RA8876_PLL_Initial();
+            break;
+        case RA8876_BOOT_SDRAM:
+            tft_8876.RA8876_SDRAM_initial();
+            break;
+        case RA8876_BOOT_REGISTERS:
+            tft_8876.RA8876_Register_Initial();
+            break;
+        case RA8876_BOOT_CLEAR:
+            if (flash_8876)
+            {
+                tft_8876.Splash_Flash(flashAddr_8876);
+                break;
+            }
+            tft_8876.Foreground_color_65k(clear_8876);
+            tft_8876.Square_Start_XY(0, 0);
+            tft_8876.Square_End_XY(RA8876_PANEL_WIDTH - 1, RA8876_PANEL_HEIGHT - 1);
+            tft_8876.Start_Square_Fill();
+            break;
+        case RA8876_BOOT_SPLASH:
+            if (splash_8876)
+                splash_8876(tft_8876, ctx_8876);
+            break;
+        }
+    }
+
+    // Draw/BTE core or serial flash DMA still running.
+    bool engineBusy()
+    {
+        if (tft_8876.LCD_StatusRead() & 0x08)
+            return true;
+        return flash_8876 && (tft_8876.LCD_RegisterReadDirect(0xB6) & 0x01);
+    }
+
+    void record(uint8_t phase, uint8_t wait_ms, uint32_t from, uint32_t to)
+    {
+        if (count_8876 == RA8876_BOOT_RECORDS)
+            return;
+        RA8876_BootPhase &r = rec_8876[count_8876++];
+        r.phase = phase;
+        r.wait_ms = wait_ms;
+        r.start_us = from - start_8876;
+        r.busy_us = to - from;
+    }
+
+    static const char *name(uint8_t phase)
+    {
+        switch (phase)
+        {
+        case RA8876_BOOT_RESET:     return "RA8876 reset";
+        case RA8876_BOOT_PLL:       return "RA8876 PLL";
+        case RA8876_BOOT_SDRAM:     return "RA8876 SDRAM";
+        case RA8876_BOOT_REGISTERS: return "RA8876 registers";
+        case RA8876_BOOT_CLEAR:     return "RA8876 clear";
+        case RA8876_BOOT_SPLASH:    return "RA8876 splash";
+        case RA8876_BOOT_DISPLAY:   return "display on";
+        default:                    return "SSD2828";
+        }
+    }
+
+    Driver &tft_8876;
+    SSD2828 &bridge_8876;
+    Splash splash_8876;
+    void *ctx_8876;
+    uint16_t clear_8876;
+    bool flash_8876;            // Splash_Flash() instead of the clear
+    uint32_t flashAddr_8876;
+    uint8_t next_8876;          // next RA8876 phase
+    uint8_t count_8876;
+    bool bridgeDone_8876;
+    bool done_8876;
+    bool idle_8876;             // the last step() found nothing to do
+    uint32_t start_8876;        // micros() at begin()
+    uint32_t due_8876;          // next bridge step
+    uint32_t total_8876;
+    uint32_t displayAt_8876;    // since begin(): RA8876 display on
+    uint32_t bridgeAt_8876;     //   and the bridge's last step
+    RA8876_BootPhase rec_8876[RA8876_BOOT_RECORDS];
+};
+
+#endif
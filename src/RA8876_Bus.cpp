@@ -0,0 +1,243 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 host bus transports, out-of-line parts of the 8080 parallel bus.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ER-TFTM0784-1.h"
+
+#ifdef ARDUINO
+//-----------------------------------------------------------------------------
+template<uint8_t WIDTH>
+RA8876_ParallelBus<WIDTH>::RA8876_ParallelBus(uint8_t rs_pin, uint8_t cs_pin, uint8_t wr_pin, uint8_t rd_pin, uint8_t next_pin, uint8_t d0_pin, uint8_t d1_pin, uint8_t d2_pin, uint8_t d3_pin, uint8_t d4_pin, uint8_t d5_pin, uint8_t d6_pin, uint8_t d7_pin, uint8_t d8_pin, uint8_t d9_pin, uint8_t d10_pin, uint8_t d11_pin, uint8_t d12_pin, uint8_t d13_pin, uint8_t d14_pin, uint8_t d15_pin, uint8_t rst_pin)
+{
+    const uint8_t d[16] = {d0_pin, d1_pin, d2_pin, d3_pin, d4_pin, d5_pin, d6_pin, d7_pin,
+                           d8_pin, d9_pin, d10_pin, d11_pin, d12_pin, d13_pin, d14_pin, d15_pin};
+    ctrl_8876[PAR_RS] = rs_pin;
+    ctrl_8876[PAR_CS] = cs_pin;
+    ctrl_8876[PAR_WR] = wr_pin;
+    ctrl_8876[PAR_RD] = rd_pin;
+    NEXT_8876 = next_pin;
+    RST_8876 = rst_pin;
+    for (uint8_t i = 0; i < WIDTH; i++)
+        D_8876[i] = d[i];
+    dataBusInit();
+    setCoreClock(OSC_FREQ);
+}
+
+template<uint8_t WIDTH>
+RA8876_ParallelBus<WIDTH>::RA8876_ParallelBus(uint8_t rs_pin, uint8_t cs_pin, uint8_t wr_pin, uint8_t rd_pin, uint8_t next_pin, uint8_t d0_pin, uint8_t d1_pin, uint8_t d2_pin, uint8_t d3_pin, uint8_t d4_pin, uint8_t d5_pin, uint8_t d6_pin, uint8_t d7_pin, uint8_t rst_pin)
+{
+    const uint8_t d[8] = {d0_pin, d1_pin, d2_pin, d3_pin, d4_pin, d5_pin, d6_pin, d7_pin};
+    ctrl_8876[PAR_RS] = rs_pin;
+    ctrl_8876[PAR_CS] = cs_pin;
+    ctrl_8876[PAR_WR] = wr_pin;
+    ctrl_8876[PAR_RD] = rd_pin;
+    NEXT_8876 = next_pin;
+    RST_8876 = rst_pin;
+    for (uint8_t i = 0; i < WIDTH; i++)
+        D_8876[i] = (i < 8) ? d[i] : d[7];
+    dataBusInit();
+    setCoreClock(OSC_FREQ);
+}
+
+template<uint8_t WIDTH>
+void RA8876_ParallelBus<WIDTH>::begin()
+{
+    digitalWrite(RST_8876, 1);
+    pinMode(RST_8876, OUTPUT);
+    digitalWrite(ctrl_8876[PAR_CS], 1);
+    digitalWrite(ctrl_8876[PAR_WR], 1);
+    digitalWrite(ctrl_8876[PAR_RD], 1);
+    pinMode(ctrl_8876[PAR_RS], OUTPUT);
+    pinMode(ctrl_8876[PAR_CS], OUTPUT);
+    pinMode(ctrl_8876[PAR_RD], OUTPUT);
+    pinMode(ctrl_8876[PAR_WR], OUTPUT);
+
+    dataBusDirection(0); // make databus inputs
+}
+
+template<uint8_t WIDTH>
+void RA8876_ParallelBus<WIDTH>::hwReset()
+{
+    pinMode(RST_8876, OUTPUT);
+    digitalWrite(RST_8876, 1);
+    delay(1);
+    digitalWrite(RST_8876, 0);
+    delay(1);
+    digitalWrite(RST_8876, 1);
+    setCoreClock(OSC_FREQ);
+}
+
+// Recalculate the bus_delay() loop count for a RA8876 core clock of
+// 'core_mhz'. A volatile loop iteration is taken as at least 4 MCU cycles.
+template<uint8_t WIDTH>
+void RA8876_ParallelBus<WIDTH>::setCoreClock(uint16_t core_mhz)
+{
+#ifdef F_CPU
+    bus_loops_8876 = (uint32_t)(1000 / core_mhz) * (F_CPU / 1000000UL) / 4000 + 1;
+#else
+    bus_loops_8876 = (1000 / core_mhz) / 2 + 1;
+#endif
+}
+
+// Build port/bitmask tables for the parallel bus so that a whole bus word
+// is written with one store per MCU port instead of 16 digitalWrite()s.
+template<uint8_t WIDTH>
+void RA8876_ParallelBus<WIDTH>::dataBusInit()
+{
+    uint8_t i, p, v, ports = 0;
+
+    dataDir_8876 = 0xFF;
+    dataPorts_8876 = 0;
+    burstDone_8876 = 0;
+#ifdef portOutputRegister
+    for (i = 0; i < 4; i++)
+    {
+        ctrlOut_8876[i] = (RA8876_PortReg *)portOutputRegister(digitalPinToPort(ctrl_8876[i]));
+        ctrlMask_8876[i] = digitalPinToBitMask(ctrl_8876[i]);
+    }
+
+    memset(dataMask_8876, 0, sizeof(dataMask_8876));
+    memset(dataLut_8876, 0, sizeof(dataLut_8876));
+    for (i = 0; i < WIDTH; i++)
+    {
+        RA8876_PortReg *out = (RA8876_PortReg *)portOutputRegister(digitalPinToPort(D_8876[i]));
+        RA8876_PortMask mask = digitalPinToBitMask(D_8876[i]);
+        for (p = 0; p < ports; p++)
+            if (dataOut_8876[p] == out)
+                break;
+        if (p == ports)
+        {
+            if (ports == RA8876_PAR_PORTS)
+                return;     // too scattered, stay on digitalWrite()
+            dataOut_8876[p] = out;
+            dataIn_8876[p] = (RA8876_PortReg *)portInputRegister(digitalPinToPort(D_8876[i]));
+            ports++;
+        }
+        dataMask_8876[p] |= mask;
+        dataPinPort_8876[i] = p;
+        dataPinMask_8876[i] = mask;
+        for (v = 0; v < 16; v++)
+            if (v & (1 << (i & 3)))
+                dataLut_8876[p][i >> 2][v] |= mask;
+    }
+    dataPorts_8876 = ports;
+#endif
+}
+
+template<uint8_t WIDTH>
+void RA8876_ParallelBus<WIDTH>::dataBusDirection(uint8_t dir)
+{
+    // 0: inputs, 1: outputs
+    dataDir_8876 = dir;
+    for (uint8_t i = 0; i < WIDTH; i++)
+    {
+        if (dir)
+            pinMode(D_8876[i], OUTPUT);
+        else
+        {
+            pinMode(D_8876[i], INPUT);
+            digitalWrite(D_8876[i], 0);
+        }
+    }
+}
+
+template<uint8_t WIDTH>
+uint16_t RA8876_ParallelBus<WIDTH>::dataBusRead()
+{
+    uint16_t res = 0;
+    uint8_t i;
+
+    if (dataPorts_8876 == 0)
+    {
+        for (i = WIDTH; i > 0; i--)
+        {
+            res <<= 1;
+            res |= digitalRead(D_8876[i - 1]);
+        }
+        return res;
+    }
+
+    RA8876_PortMask in[RA8876_PAR_PORTS];
+    for (i = 0; i < dataPorts_8876; i++)
+        in[i] = *dataIn_8876[i];
+    for (i = 0; i < WIDTH; i++)
+        if (in[dataPinPort_8876[i]] & dataPinMask_8876[i])
+            res |= 1 << i;
+    return res;
+}
+
+template class RA8876_ParallelBus<16>;
+template class RA8876_ParallelBus<8>;
+
+#if defined(SPI_HAS_TRANSFER_ASYNC)
+//==============================================================================
+// One DMA transfer moves at most this many bytes.
+#define RA8876_DMA_MAX  32766
+
+EventResponder RA8876_SpiDma::event_8876;
+const uint8_t *RA8876_SpiDma::cur_8876;
+uint32_t RA8876_SpiDma::curLeft_8876;
+const uint8_t *volatile RA8876_SpiDma::queued_8876;
+volatile uint32_t RA8876_SpiDma::queuedLen_8876;
+volatile bool RA8876_SpiDma::busy_8876;
+volatile uint32_t RA8876_SpiDma::completed_8876;
+
+// Start 'buf' now if the wire is idle, or queue it behind the running
+// transfer. Returns false if both slots are taken.
+bool RA8876_SpiDma::submit(const uint8_t *buf, uint32_t len)
+{
+    noInterrupts();
+    if (!busy_8876)
+    {
+        busy_8876 = true;
+        cur_8876 = buf;
+        curLeft_8876 = len;
+        interrupts();
+        event_8876.attachImmediate(done);
+        startNext();
+        return true;
+    }
+    if (queuedLen_8876 == 0)
+    {
+        queued_8876 = buf;
+        queuedLen_8876 = len;
+        interrupts();
+        return true;
+    }
+    interrupts();
+    return false;
+}
+
+void RA8876_SpiDma::startNext()
+{
+    uint32_t n = (curLeft_8876 > RA8876_DMA_MAX) ? RA8876_DMA_MAX : curLeft_8876;
+    const uint8_t *p = cur_8876;
+    cur_8876 += n;
+    curLeft_8876 -= n;
+    SPI.transfer(p, NULL, n, event_8876);
+}
+
+// DMA complete interrupt: continue the current buffer, then the queued one.
+void RA8876_SpiDma::done(EventResponderRef event)
+{
+    if (curLeft_8876)
+    {
+        startNext();
+        return;
+    }
+    completed_8876++;
+    if (queuedLen_8876)
+    {
+        cur_8876 = queued_8876;
+        curLeft_8876 = queuedLen_8876;
+        queuedLen_8876 = 0;
+        startNext();
+    }
+    else
+        busy_8876 = false;
+}
+#endif
+
+#endif // ARDUINO
@@ -0,0 +1,847 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 host bus transports
+//
+// RA8876_Driver<Bus> sends every command, data and status cycle through one
+// of these classes. Pick the one matching the wiring so the cycles compile to
+// straight-line code; ER_TFTM0784 uses RA8876_DynamicBus, which selects the
+// bus at runtime from the constructor that was called.
+//
+// Included from ER-TFTM0784-1.h after its configuration section. Outside
+// Arduino only the Linux spidev transport in RA8876_Linux.h is available.
+//
+// A transport provides:
+//   uint8_t mode()                    0: 16-bit 8080, 1: 8-bit 8080, 2: 4-wire SPI
+//   void begin()                      set up pins / peripheral (RA8876_IO_Init)
+//   void hwReset()                    pulse the RA8876 reset line
+//   void setCoreClock(uint16_t mhz)   RA8876 core clock changed (PLL on/off)
+//   void setSpeed(uint32_t write_hz, uint32_t read_hz)
+//   uint32_t writeSpeed(), readSpeed()
+//                                     SPI clocks, 0 on the parallel bus
+//   void cmdWrite(uint8_t)            command cycle, selects a register
+//   void dataWrite(uint8_t)           data cycle
+//   void dataWrite16(uint16_t)        16-bit memory data
+//   uint16_t dataRead()
+//   uint8_t statusRead()
+//   void batchBegin(), batchEnd()     keep the bus claimed across cycles
+//   void burstBegin(), burstWrite8(), burstWrite16(), burstEnd()
+//                                     stream memory data after cmdWrite(0x04)
+//   void burstPixels(const uint16_t *, uint32_t)
+//                                     send a buffer of 16bpp pixels in a burst
+//   bool burstAsync(const uint16_t *, uint32_t)
+//                                     same, but may return before the data is
+//                                     sent; false if no buffer slot is free
+//   uint32_t burstCompleted()         number of burstAsync() buffers finished
+//   void burstReadPixels(uint16_t *, uint32_t)
+//                                     read 16bpp pixels from the memory port,
+//                                     after cmdWrite(0x04) and a dummy read
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_BUS_H__
+#define __RA8876_BUS_H__
+
+// b7 = a0: 0:cmd/status 1:data
+// b6 = /wr 0:write 1:read
+
+#define RA8876_SPI_CMDWRITE    0x00
+#define RA8876_SPI_DATAWRITE   0x80
+#define RA8876_SPI_DATAREAD    0xc0
+#define RA8876_SPI_STATUSREAD  0x40
+
+// Bounce buffer for SPI.transfer(buf, n), which overwrites its buffer.
+#define RA8876_SPI_CHUNK       64
+
+//==============================================================================
+// Credit for writes to the memory write FIFO, so a writer that can outrun the
+// RA8876 reads status once per block instead of once per item. An empty FIFO
+// grants RA8876_WR_FIFO_DEPTH writes, never more: past that, the FIFO is only
+// safe if the RA8876 drains it faster than the bus fills it. When the FIFO is
+// not empty at the first look, the time it took to drain is kept and the next
+// wait sleeps most of it before reading status, so status reads follow the
+// drain rate rather than the item count.
+class RA8876_FifoCredit {
+public:
+    RA8876_FifoCredit() { reset(); }
+
+    // New stream, nothing known about the FIFO yet.
+    void reset()
+    {
+        credit_8876 = 0;
+        drain_8876 = 0;
+    }
+    // Use up one write; false if wait() must be called first.
+    bool take()
+    {
+        if (credit_8876 == 0)
+            return false;
+        credit_8876--;
+        return true;
+    }
+    // Wait for the FIFO to empty, reading the status register with the
+    // callable 'status', and grant the next block. Gives up after 10000
+    // reads like Check_Mem_WR_FIFO_not_Full(), granting a single write.
+    template<class StatusRead>
+    void wait(StatusRead status)
+    {
+        uint32_t start = micros();
+        uint16_t tries = 0;
+
+        if (drain_8876)
+            sleep(drain_8876 - drain_8876 / 4);
+        while (!(status() & 0x40) && ++tries < 10000);  // write FIFO not empty
+        if (tries == 10000)
+        {
+            credit_8876 = 1;
+            return;
+        }
+        credit_8876 = RA8876_WR_FIFO_DEPTH;
+        if (tries || drain_8876)
+        {
+            uint32_t us = micros() - start;
+            drain_8876 = (us > 0xFFFF) ? 0xFFFF : (us ? us : 1);
+        }
+    }
+
+private:
+    // delayMicroseconds() is only accurate up to a few ms on AVR.
+    static void sleep(uint16_t us)
+    {
+        if (us >= 1000)
+            delay(us / 1000);
+        delayMicroseconds(us % 1000);
+    }
+
+    uint16_t credit_8876;   // writes left before the next wait()
+    uint16_t drain_8876;    // us the last block took to drain, 0 = kept up
+                            // so far in this stream
+};
+
+#ifdef ARDUINO
+#include <SPI.h>
+
+// Template pin argument meaning "pin is passed to the constructor".
+#define RA8876_PIN_RUNTIME     0xFF
+
+#if defined(__AVR__)
+typedef volatile uint8_t RA8876_PortReg;
+typedef uint8_t RA8876_PortMask;
+#else
+typedef volatile uint32_t RA8876_PortReg;
+typedef uint32_t RA8876_PortMask;
+#endif
+
+#if defined(SPI_HAS_TRANSFER_ASYNC)
+//==============================================================================
+// Double-buffered DMA for burstAsync() on cores with asynchronous
+// SPI.transfer() (Teensy): one buffer on the wire, one queued behind it.
+// There is a single SPI peripheral, so the state is shared.
+class RA8876_SpiDma {
+public:
+    static bool submit(const uint8_t *buf, uint32_t len);
+    static bool busy() { return busy_8876; }
+    static uint32_t completed() { return completed_8876; }
+
+private:
+    static void startNext();
+    static void done(EventResponderRef event);
+
+    static EventResponder event_8876;
+    static const uint8_t *cur_8876;
+    static uint32_t curLeft_8876;
+    static const uint8_t *volatile queued_8876;
+    static volatile uint32_t queuedLen_8876;
+    static volatile bool busy_8876;
+    static volatile uint32_t completed_8876;
+};
+#endif
+
+//==============================================================================
+// Several RA8876 on one SPI bus, each with its own CS. A transport joins with
+// setGroup(); members are numbered in the order they join. Between begin()
+// and end() all members' cycles share one SPI transaction at the group's
+// clock, instead of opening one per cycle or batch. While broadcast() has a
+// mask set, write cycles from any member assert the CS of every member in
+// the mask, so an identical register sequence (initialisation, a full-screen
+// fill) reaches all those panels in the time of one. Reads only ever select
+// the member that issued them, so the panels must be in the same state.
+class RA8876_SpiGroup {
+public:
+    RA8876_SpiGroup(SPIClass &port = SPI) : spi_8876(&port), count_8876(0), open_8876(0), hz_8876(0), mask_8876(0) { }
+
+    SPIClass &spi() { return *spi_8876; }
+    uint8_t members() const { return count_8876; }
+    uint16_t all() const { return (uint16_t)((1UL << count_8876) - 1); }
+
+    // Member number of 'cs_pin', joining if new; RA8876_SPI_GROUP_MAX if full.
+    uint8_t add(uint8_t cs_pin)
+    {
+        uint8_t i;
+        for (i = 0; i < count_8876 && cs_8876[i] != cs_pin; i++);
+        if (i == count_8876 && count_8876 < RA8876_SPI_GROUP_MAX)
+            cs_8876[count_8876++] = cs_pin;
+        return i;
+    }
+
+    // Nestable. Use the slowest clock any member can take.
+    void begin(uint32_t hz)
+    {
+        if (open_8876++ == 0)
+        {
+            hz_8876 = hz;
+            spi_8876->beginTransaction(SPISettings(hz, MSBFIRST, SPI_MODE0));
+        }
+    }
+    void end()
+    {
+        if (open_8876 && --open_8876 == 0)
+            spi_8876->endTransaction();
+    }
+    bool open() const { return open_8876 != 0; }
+    uint32_t speed() const { return hz_8876; }
+
+    // Members to write to together, e.g. all(); 0 ends the broadcast.
+    void broadcast(uint16_t mask) { mask_8876 = mask; }
+    uint16_t broadcasting() const { return mask_8876; }
+
+    // CS framing of one cycle issued by 'cs_pin'.
+    void select(uint8_t cs_pin, bool write) { frame(cs_pin, write, LOW); }
+    void deselect(uint8_t cs_pin, bool write) { frame(cs_pin, write, HIGH); }
+
+private:
+    void frame(uint8_t cs_pin, bool write, uint8_t level)
+    {
+        if (!write || mask_8876 == 0)
+        {
+            digitalWrite(cs_pin, level);
+            return;
+        }
+        for (uint8_t i = 0; i < count_8876; i++)
+            if (mask_8876 & (1 << i))
+                digitalWrite(cs_8876[i], level);
+    }
+
+    SPIClass *spi_8876;
+    uint8_t cs_8876[RA8876_SPI_GROUP_MAX];
+    uint8_t count_8876;
+    uint8_t open_8876;      // begin() nesting depth
+    uint32_t hz_8876;
+    uint16_t mask_8876;
+};
+
+//==============================================================================
+// 4-wire SPI. CS and RST may be fixed at compile time:
+//   RA8876_SpiBus                 pins passed to the constructor
+//   RA8876_SpiBusPins<10, 9>      CS on 10, RST on 9
+template<uint8_t CS_PIN = RA8876_PIN_RUNTIME, uint8_t RST_PIN = RA8876_PIN_RUNTIME>
+class RA8876_SpiBusPins {
+public:
+    RA8876_SpiBusPins(uint32_t spi_speed, uint8_t /*sdi_pin*/, uint8_t /*sdo_pin*/, uint8_t /*sclk_pin*/, uint8_t cs_pin, uint8_t rst_pin)
+    {
+        SPI_SPEED_8876 = spi_speed;
+        SPI_READ_8876 = spi_speed;
+        CS_SER_8876 = cs_pin;
+        RST_8876 = rst_pin;
+        batch_8876 = 0;
+        burstDone_8876 = 0;
+        spi_8876 = &SPI;
+        group_8876 = NULL;
+    }
+    RA8876_SpiBusPins(uint32_t spi_speed)
+    {
+        SPI_SPEED_8876 = spi_speed;
+        SPI_READ_8876 = spi_speed;
+        CS_SER_8876 = CS_PIN;
+        RST_8876 = RST_PIN;
+        batch_8876 = 0;
+        burstDone_8876 = 0;
+        spi_8876 = &SPI;
+        group_8876 = NULL;
+    }
+
+    uint8_t mode() const { return 2; }
+
+    // Another SPI peripheral than SPI, e.g. SPI1. Call before begin().
+    void setSpi(SPIClass &port) { spi_8876 = &port; }
+    // Share the bus with other displays, see RA8876_SpiGroup. Call before
+    // begin(); NULL leaves the group.
+    void setGroup(RA8876_SpiGroup *group)
+    {
+        group_8876 = group;
+        if (group)
+        {
+            spi_8876 = &group->spi();
+            group->add(cs());
+        }
+    }
+    RA8876_SpiGroup *group() const { return group_8876; }
+
+    void begin()
+    {
+        digitalWrite(rst(), 1);
+        pinMode(rst(), OUTPUT);
+        digitalWrite(cs(), 1);
+        pinMode(cs(), OUTPUT);
+        spi_8876->begin();
+    }
+
+    void hwReset()
+    {
+        pinMode(rst(), OUTPUT);
+        digitalWrite(rst(), 1);
+        delay(1);
+        digitalWrite(rst(), 0);
+        delay(1);
+        digitalWrite(rst(), 1);
+    }
+
+    void setCoreClock(uint16_t) { }
+
+    // The RA8876 takes writes at a higher SCLK than it can answer reads,
+    // so read cycles may run at their own clock.
+    void setSpeed(uint32_t write_hz, uint32_t read_hz)
+    {
+        SPI_SPEED_8876 = write_hz;
+        SPI_READ_8876 = read_hz;
+        if (batch_8876 && !shared())
+        {
+            spi_8876->endTransaction();
+            spi_8876->beginTransaction(SPISettings(SPI_SPEED_8876, MSBFIRST, SPI_MODE0));
+        }
+    }
+    uint32_t writeSpeed() const { return SPI_SPEED_8876; }
+    uint32_t readSpeed() const { return SPI_READ_8876; }
+
+    void cmdWrite(uint8_t Cmd)
+    {
+        // b0=0b00000000
+        // b1 reg_num
+        startSend();
+        spi_8876->transfer(RA8876_SPI_CMDWRITE);
+        spi_8876->transfer(Cmd);
+        endSend();
+    }
+
+    void dataWrite(uint8_t data)
+    {
+        // b0 = 0b10000000
+        // b1   reg_dat / mem_dat
+        startSend();
+        spi_8876->transfer(RA8876_SPI_DATAWRITE);
+        spi_8876->transfer(data);
+        endSend();
+    }
+
+    void dataWrite16(uint16_t data)
+    {
+        startSend();
+        spi_8876->transfer(RA8876_SPI_DATAWRITE);
+        spi_8876->transfer(data & 0xFF); // LSB first!!!
+        spi_8876->transfer(data >> 8);
+        endSend();
+    }
+
+    uint16_t dataRead()
+    {
+        // b0=0b11000000
+        // b1 reg dat/mem dat
+        startRead();
+        spi_8876->transfer(RA8876_SPI_DATAREAD);
+        uint16_t data = spi_8876->transfer(0xff);
+        endRead();
+        return data;
+    }
+
+    uint8_t statusRead()
+    {
+        // b0=0b01000000
+        startRead();
+        spi_8876->transfer(RA8876_SPI_STATUSREAD);
+        uint8_t data = spi_8876->transfer(0xff);
+        endRead();
+        return data;
+    }
+
+    // Keep one SPI transaction open across several bus cycles. The RA8876
+    // still needs CS to be toggled for every command/data cycle, but the
+    // SPI.beginTransaction()/pinMode() overhead is only paid once.
+    // Batches may be nested; the transaction closes at the outermost end.
+    void batchBegin()
+    {
+        if (batch_8876++ == 0 && !shared())
+        {
+            spi_8876->beginTransaction(SPISettings(SPI_SPEED_8876, MSBFIRST, SPI_MODE0));
+            pinMode(cs(), OUTPUT);
+        }
+    }
+
+    void batchEnd()
+    {
+        if (batch_8876 == 0)
+            return;
+        if (--batch_8876 == 0 && !shared())
+            spi_8876->endTransaction();
+    }
+
+    void burstBegin()
+    {
+        startSend();
+        spi_8876->transfer(RA8876_SPI_DATAWRITE);
+    }
+    void burstWrite8(uint8_t data) { spi_8876->transfer(data); }
+    void burstWrite16(uint16_t data)
+    {
+        spi_8876->transfer(data & 0xFF); // LSB first!!!
+        spi_8876->transfer(data >> 8);
+    }
+    void burstEnd()
+    {
+#if defined(SPI_HAS_TRANSFER_ASYNC)
+        while (RA8876_SpiDma::busy());
+#endif
+        endSend();
+    }
+
+    // The RA8876 takes the LSB of each pixel first, which is the in-memory
+    // order on the little-endian MCUs this runs on, so buffers go out as-is.
+    void burstPixels(const uint16_t *data, uint32_t count)
+    {
+        const uint8_t *p = (const uint8_t *)data;
+        uint32_t n = count * 2;
+#if defined(SPI_HAS_TRANSFER_ASYNC)
+        if (spi_8876 == &SPI)
+        {
+            spi_8876->transfer(p, NULL, n);
+            return;
+        }
+#endif
+        uint8_t buf[RA8876_SPI_CHUNK];
+        while (n)
+        {
+            uint16_t k = (n > sizeof(buf)) ? sizeof(buf) : n;
+            memcpy(buf, p, k);
+            spi_8876->transfer(buf, k);
+            p += k;
+            n -= k;
+        }
+    }
+
+    bool burstAsync(const uint16_t *data, uint32_t count)
+    {
+#if defined(SPI_HAS_TRANSFER_ASYNC)
+        if (spi_8876 == &SPI)
+            return RA8876_SpiDma::submit((const uint8_t *)data, count * 2);
+#endif
+        burstPixels(data, count);
+        burstDone_8876++;
+        return true;
+    }
+
+    uint32_t burstCompleted()
+    {
+#if defined(SPI_HAS_TRANSFER_ASYNC)
+        if (spi_8876 == &SPI)
+            return RA8876_SpiDma::completed();
+#endif
+        return burstDone_8876;
+    }
+
+    // The RA8876 keeps shifting out memory port data while CS stays low,
+    // so a whole run of pixels is one read cycle.
+    void burstReadPixels(uint16_t *data, uint32_t count)
+    {
+        uint8_t buf[RA8876_SPI_CHUNK];
+
+        startRead();
+        spi_8876->transfer(RA8876_SPI_DATAREAD);
+        while (count)
+        {
+            uint16_t k = (count > sizeof(buf) / 2) ? sizeof(buf) : count * 2;
+            memset(buf, 0xFF, k);
+            spi_8876->transfer(buf, k);
+            for (uint16_t i = 0; i < k; i += 2)
+                *data++ = buf[i] | buf[i + 1] << 8;    // LSB first
+            count -= k / 2;
+        }
+        endRead();
+    }
+
+private:
+    uint8_t cs() const { return CS_PIN != RA8876_PIN_RUNTIME ? CS_PIN : CS_SER_8876; }
+    uint8_t rst() const { return RST_PIN != RA8876_PIN_RUNTIME ? RST_PIN : RST_8876; }
+
+    // Inside a group transaction every cycle runs at the group's clock.
+    bool shared() const { return group_8876 && group_8876->open(); }
+
+    void select(bool write)
+    {
+        if (group_8876)
+            group_8876->select(cs(), write);
+        else
+            digitalWrite(cs(), LOW);
+    }
+
+    void deselect(bool write)
+    {
+        if (group_8876)
+            group_8876->deselect(cs(), write);
+        else
+            digitalWrite(cs(), HIGH);
+    }
+
+    void startSend()
+    {
+        // Inside a batch the transaction is already open, only CS
+        // has to frame the next cycle.
+        if (batch_8876 == 0 && !shared())
+        {
+            spi_8876->beginTransaction(SPISettings(SPI_SPEED_8876, MSBFIRST, SPI_MODE0));
+            pinMode(cs(), OUTPUT);
+        }
+        select(true);
+    }
+
+    void endSend()
+    {
+        deselect(true);
+        if (batch_8876 == 0 && !shared())
+            spi_8876->endTransaction();
+    }
+
+    // A batch holds the transaction at the write clock; a read at another
+    // clock steps out of it for the one cycle.
+    void startRead()
+    {
+        if (SPI_READ_8876 == SPI_SPEED_8876 || shared())
+        {
+            if (batch_8876 == 0 && !shared())
+            {
+                spi_8876->beginTransaction(SPISettings(SPI_SPEED_8876, MSBFIRST, SPI_MODE0));
+                pinMode(cs(), OUTPUT);
+            }
+            select(false);
+            return;
+        }
+        if (batch_8876)
+            spi_8876->endTransaction();
+        spi_8876->beginTransaction(SPISettings(SPI_READ_8876, MSBFIRST, SPI_MODE0));
+        pinMode(cs(), OUTPUT);
+        select(false);
+    }
+
+    void endRead()
+    {
+        deselect(false);
+        if (SPI_READ_8876 == SPI_SPEED_8876 || shared())
+        {
+            if (batch_8876 == 0 && !shared())
+                spi_8876->endTransaction();
+            return;
+        }
+        spi_8876->endTransaction();
+        if (batch_8876)
+            spi_8876->beginTransaction(SPISettings(SPI_SPEED_8876, MSBFIRST, SPI_MODE0));
+    }
+
+    uint32_t SPI_SPEED_8876;    // write cycles
+    uint32_t SPI_READ_8876;     // data and status reads
+    uint8_t CS_SER_8876;
+    uint8_t RST_8876;
+    uint8_t batch_8876; // batchBegin() nesting depth
+    uint32_t burstDone_8876;
+    SPIClass *spi_8876;
+    RA8876_SpiGroup *group_8876;
+};
+
+typedef RA8876_SpiBusPins<> RA8876_SpiBus;
+
+//==============================================================================
+// 8080 parallel bus, 8 or 16 data lines. The constructor builds port/bitmask
+// tables from the pin numbers: a nibble lookup per MCU port turns a bus word
+// into one store per port. Pins spread over more than RA8876_PAR_PORTS ports
+// fall back to digitalWrite()/digitalRead().
+#define PAR_RS  0
+#define PAR_CS  1
+#define PAR_WR  2
+#define PAR_RD  3
+
+template<uint8_t WIDTH>
+class RA8876_ParallelBus {
+public:
+    RA8876_ParallelBus(uint8_t rs_pin, uint8_t cs_pin, uint8_t wr_pin, uint8_t rd_pin, uint8_t next_pin, uint8_t d0_pin, uint8_t d1_pin, uint8_t d2_pin, uint8_t d3_pin, uint8_t d4_pin, uint8_t d5_pin, uint8_t d6_pin, uint8_t d7_pin, uint8_t d8_pin, uint8_t d9_pin, uint8_t d10_pin, uint8_t d11_pin, uint8_t d12_pin, uint8_t d13_pin, uint8_t d14_pin, uint8_t d15_pin, uint8_t rst_pin); // 16-bit parallel mode
+    RA8876_ParallelBus(uint8_t rs_pin, uint8_t cs_pin, uint8_t wr_pin, uint8_t rd_pin, uint8_t next_pin, uint8_t d0_pin, uint8_t d1_pin, uint8_t d2_pin, uint8_t d3_pin, uint8_t d4_pin, uint8_t d5_pin, uint8_t d6_pin, uint8_t d7_pin, uint8_t rst_pin); // 8-bit parallel mode
+
+    uint8_t mode() const { return (WIDTH == 16) ? 0 : 1; }
+
+    void begin();
+    void hwReset();
+    void setCoreClock(uint16_t core_mhz);
+    void setSpeed(uint32_t, uint32_t) { }
+    uint32_t writeSpeed() const { return 0; }
+    uint32_t readSpeed() const { return 0; }
+
+    void cmdWrite(uint8_t Cmd)
+    {
+        dataBusSetDirection(1);
+        parWrite(PAR_RS, 0);
+        parWrite(PAR_CS, 0);
+        dataBusWrite(Cmd);
+        parStrobe();
+        parWrite(PAR_CS, 1);
+        bus_delay(RA8876_PAR_TWH);
+    }
+
+    void dataWrite(uint8_t data)
+    {
+        dataBusSetDirection(1);
+        parWrite(PAR_RS, 1);
+        parWrite(PAR_CS, 0);
+        dataBusWrite(data);
+        parStrobe();
+        parWrite(PAR_CS, 1);
+        bus_delay(RA8876_PAR_TWH);
+    }
+
+    void dataWrite16(uint16_t data)
+    {
+        burstBegin();
+        burstWrite16(data);
+        burstEnd();
+    }
+
+    uint16_t dataRead()
+    {
+        return readCycle(1);
+    }
+
+    uint8_t statusRead()
+    {
+        return readCycle(0);
+    }
+
+    void batchBegin() { }
+    void batchEnd() { }
+
+    void burstBegin()
+    {
+        fifo_8876.reset();
+        burstResume();
+    }
+    void burstWrite8(uint8_t data)
+    {
+        dataBusWrite(data);
+        parStrobe();
+    }
+    void burstWrite16(uint16_t data)
+    {
+        dataBusWrite(data);
+        parStrobe();
+        if (WIDTH == 8)     // 8-bit bus: second strobe carries the MSB
+        {
+            dataBusWrite(data >> 8);
+            parStrobe();
+        }
+    }
+    void burstEnd()
+    {
+        parWrite(PAR_CS, 1);
+        bus_delay(RA8876_PAR_TWH);
+    }
+
+    // The parallel bus can outrun the memory write FIFO, so look at it
+    // whenever the FIFO credit runs out.
+    void burstPixels(const uint16_t *data, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (!fifo_8876.take())
+            {
+                burstEnd();
+                fifo_8876.wait([this]() { return statusRead(); });
+                fifo_8876.take();
+                burstResume();
+            }
+            burstWrite16(data[i]);
+        }
+    }
+
+    bool burstAsync(const uint16_t *data, uint32_t count)
+    {
+        burstPixels(data, count);
+        burstDone_8876++;
+        return true;
+    }
+
+    uint32_t burstCompleted() { return burstDone_8876; }
+
+    // An 8-bit bus reads the LSB of each pixel first.
+    void burstReadPixels(uint16_t *data, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            uint16_t data0 = readCycle(1);
+            data[i] = (WIDTH == 16) ? data0 : (data0 & 0xFF) | readCycle(1) << 8;
+        }
+    }
+
+private:
+    void dataBusInit();
+    void dataBusDirection(uint8_t dir);
+    uint16_t dataBusRead();
+
+    void burstResume()
+    {
+        dataBusSetDirection(1);
+        parWrite(PAR_RS, 1);
+        parWrite(PAR_CS, 0);
+    }
+
+    // Wait 'tc' RA8876 core clock periods.
+    void bus_delay(uint8_t tc)
+    {
+        for (volatile uint16_t i = tc * bus_loops_8876; i; i--);
+    }
+
+    void parWrite(uint8_t sig, uint8_t level)
+    {
+#ifdef portOutputRegister
+        if (level)
+            *ctrlOut_8876[sig] |= ctrlMask_8876[sig];
+        else
+            *ctrlOut_8876[sig] &= ~ctrlMask_8876[sig];
+#else
+        digitalWrite(ctrl_8876[sig], level);
+#endif
+    }
+
+    // Latch the word on the data bus with a /WR pulse.
+    void parStrobe()
+    {
+        parWrite(PAR_WR, 0);
+        bus_delay(RA8876_PAR_TWR);
+        parWrite(PAR_WR, 1);
+    }
+
+    // The bus stays in the last direction until a cycle needs the other one,
+    // so back-to-back writes don't touch pinMode() at all.
+    void dataBusSetDirection(uint8_t dir)
+    {
+        // 0: inputs, 1: outputs
+        if (dir != dataDir_8876)
+            dataBusDirection(dir);
+    }
+
+    void dataBusWrite(uint16_t x)
+    {
+        if (dataPorts_8876 == 0)
+        {
+            for (uint8_t i = 0; i < WIDTH; i++, x >>= 1)
+                digitalWrite(D_8876[i], x & 1);
+            return;
+        }
+        for (uint8_t p = 0; p < dataPorts_8876; p++)
+        {
+            RA8876_PortMask set = dataLut_8876[p][0][x & 0x0F] | dataLut_8876[p][1][(x >> 4) & 0x0F];
+            if (WIDTH == 16)
+                set |= dataLut_8876[p][2][(x >> 8) & 0x0F] | dataLut_8876[p][3][(x >> 12) & 0x0F];
+            *dataOut_8876[p] = (*dataOut_8876[p] & ~dataMask_8876[p]) | set;
+        }
+    }
+
+    // rs = 0: status read, rs = 1: data read
+    uint16_t readCycle(uint8_t rs)
+    {
+        dataBusSetDirection(0);
+        parWrite(PAR_RS, rs);
+        parWrite(PAR_CS, 0);
+        parWrite(PAR_RD, 0);
+        bus_delay(RA8876_PAR_TRD);
+        uint16_t data = dataBusRead();
+        parWrite(PAR_RD, 1);
+        parWrite(PAR_CS, 1);
+        bus_delay(RA8876_PAR_TWH);
+        return data;
+    }
+
+    uint16_t bus_loops_8876;    // bus_delay() loop count per Tc
+    uint8_t dataDir_8876;       // latched data bus direction, 0xFF = unknown
+    uint8_t dataPorts_8876;     // 0 = pins not port mapped, use digitalWrite()
+    uint32_t burstDone_8876;
+    RA8876_FifoCredit fifo_8876;    // burstPixels() flow control
+    RA8876_PortReg *dataOut_8876[RA8876_PAR_PORTS];
+    RA8876_PortReg *dataIn_8876[RA8876_PAR_PORTS];
+    RA8876_PortMask dataMask_8876[RA8876_PAR_PORTS];
+    RA8876_PortMask dataLut_8876[RA8876_PAR_PORTS][WIDTH / 4][16];  // data nibble -> port bits
+    uint8_t dataPinPort_8876[WIDTH];
+    RA8876_PortMask dataPinMask_8876[WIDTH];
+    RA8876_PortReg *ctrlOut_8876[4];    // RS, CS, WR, RD
+    RA8876_PortMask ctrlMask_8876[4];
+
+    // pins
+    uint8_t RST_8876;
+    uint8_t NEXT_8876;
+    uint8_t ctrl_8876[4];               // RS, CS, WR, RD
+    uint8_t D_8876[WIDTH];
+};
+
+typedef RA8876_ParallelBus<16> RA8876_Parallel16Bus;
+typedef RA8876_ParallelBus<8> RA8876_Parallel8Bus;
+
+//==============================================================================
+// Bus chosen at runtime by the constructor, as the original ER_TFTM0784 did.
+// Every cycle goes through a switch on mode(); use one of the fixed
+// transports above when the wiring is known at compile time.
+class RA8876_DynamicBus {
+public:
+    RA8876_DynamicBus(uint8_t rs_pin, uint8_t cs_pin, uint8_t wr_pin, uint8_t rd_pin, uint8_t next_pin, uint8_t d0_pin, uint8_t d1_pin, uint8_t d2_pin, uint8_t d3_pin, uint8_t d4_pin, uint8_t d5_pin, uint8_t d6_pin, uint8_t d7_pin, uint8_t d8_pin, uint8_t d9_pin, uint8_t d10_pin, uint8_t d11_pin, uint8_t d12_pin, uint8_t d13_pin, uint8_t d14_pin, uint8_t d15_pin, uint8_t rst_pin) // 16-bit parallel mode
+    : par16(rs_pin, cs_pin, wr_pin, rd_pin, next_pin, d0_pin, d1_pin, d2_pin, d3_pin, d4_pin, d5_pin, d6_pin, d7_pin, d8_pin, d9_pin, d10_pin, d11_pin, d12_pin, d13_pin, d14_pin, d15_pin, rst_pin), mode_8876(0) { }
+    RA8876_DynamicBus(uint8_t rs_pin, uint8_t cs_pin, uint8_t wr_pin, uint8_t rd_pin, uint8_t next_pin, uint8_t d0_pin, uint8_t d1_pin, uint8_t d2_pin, uint8_t d3_pin, uint8_t d4_pin, uint8_t d5_pin, uint8_t d6_pin, uint8_t d7_pin, uint8_t rst_pin) // 8-bit parallel mode
+    : par8(rs_pin, cs_pin, wr_pin, rd_pin, next_pin, d0_pin, d1_pin, d2_pin, d3_pin, d4_pin, d5_pin, d6_pin, d7_pin, rst_pin), mode_8876(1) { }
+    RA8876_DynamicBus(uint32_t spi_speed, uint8_t sdi_pin, uint8_t sdo_pin, uint8_t sclk_pin, uint8_t cs_pin, uint8_t rst_pin) // 4-pin SPI mode
+    : spi(spi_speed, sdi_pin, sdo_pin, sclk_pin, cs_pin, rst_pin), mode_8876(2) { }
+
+#define RA8876_DYNAMIC_BUS(call) \
+    switch (mode_8876) { case 0: return par16.call; case 1: return par8.call; default: return spi.call; }
+
+    uint8_t mode() const { return mode_8876; }
+    // SPI transport only, see RA8876_SpiBusPins.
+    void setSpi(SPIClass &port) { if (mode_8876 == 2) spi.setSpi(port); }
+    void setGroup(RA8876_SpiGroup *group) { if (mode_8876 == 2) spi.setGroup(group); }
+    void begin() { RA8876_DYNAMIC_BUS(begin()) }
+    void hwReset() { RA8876_DYNAMIC_BUS(hwReset()) }
+    void setCoreClock(uint16_t core_mhz) { RA8876_DYNAMIC_BUS(setCoreClock(core_mhz)) }
+    void setSpeed(uint32_t write_hz, uint32_t read_hz) { RA8876_DYNAMIC_BUS(setSpeed(write_hz, read_hz)) }
+    uint32_t writeSpeed() const { RA8876_DYNAMIC_BUS(writeSpeed()) }
+    uint32_t readSpeed() const { RA8876_DYNAMIC_BUS(readSpeed()) }
+    void cmdWrite(uint8_t Cmd) { RA8876_DYNAMIC_BUS(cmdWrite(Cmd)) }
+    void dataWrite(uint8_t data) { RA8876_DYNAMIC_BUS(dataWrite(data)) }
+    void dataWrite16(uint16_t data) { RA8876_DYNAMIC_BUS(dataWrite16(data)) }
+    uint16_t dataRead() { RA8876_DYNAMIC_BUS(dataRead()) }
+    uint8_t statusRead() { RA8876_DYNAMIC_BUS(statusRead()) }
+    void batchBegin() { RA8876_DYNAMIC_BUS(batchBegin()) }
+    void batchEnd() { RA8876_DYNAMIC_BUS(batchEnd()) }
+    void burstBegin() { RA8876_DYNAMIC_BUS(burstBegin()) }
+    void burstWrite8(uint8_t data) { RA8876_DYNAMIC_BUS(burstWrite8(data)) }
+    void burstWrite16(uint16_t data) { RA8876_DYNAMIC_BUS(burstWrite16(data)) }
+    void burstEnd() { RA8876_DYNAMIC_BUS(burstEnd()) }
+    void burstPixels(const uint16_t *data, uint32_t count) { RA8876_DYNAMIC_BUS(burstPixels(data, count)) }
+    bool burstAsync(const uint16_t *data, uint32_t count) { RA8876_DYNAMIC_BUS(burstAsync(data, count)) }
+    uint32_t burstCompleted() { RA8876_DYNAMIC_BUS(burstCompleted()) }
+    void burstReadPixels(uint16_t *data, uint32_t count) { RA8876_DYNAMIC_BUS(burstReadPixels(data, count)) }
+
+#undef RA8876_DYNAMIC_BUS
+
+private:
+    union {
+        RA8876_SpiBus spi;
+        RA8876_Parallel16Bus par16;
+        RA8876_Parallel8Bus par8;
+    };
+    uint8_t mode_8876;
+};
+
+#else
+#include "RA8876_Linux.h"
+#endif // ARDUINO
+
+#endif
@@ -0,0 +1,88 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// The few Arduino core calls the drivers use, for builds outside Arduino
+// (Linux spidev backend, host tools). Included instead of <Arduino.h> when
+// ARDUINO is not defined.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_HOST_H__
+#define __RA8876_HOST_H__
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define PROGMEM
+#define pgm_read_byte(p)        (*(const uint8_t *)(p))
+#define pgm_read_byte_near(p)   (*(const uint8_t *)(p))
+#define pgm_read_word(p)        (*(const uint16_t *)(p))
+#define pgm_read_word_near(p)   (*(const uint16_t *)(p))
+#define pgm_read_dword(p)       (*(const uint32_t *)(p))
+
+#define HIGH    1
+#define LOW     0
+
+static inline void delay(unsigned long ms) { usleep(ms * 1000); }
+static inline void delayMicroseconds(unsigned int us) { usleep(us); }
+
+static inline unsigned long micros()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long)ts.tv_sec * 1000000UL + ts.tv_nsec / 1000;
+}
+static inline unsigned long millis() { return micros() / 1000; }
+
+// Enough of Arduino's Print for the drivers' reports.
+class Print {
+public:
+    virtual ~Print() { }
+    virtual size_t write(uint8_t c) = 0;
+    size_t write(const uint8_t *buf, size_t n)
+    {
+        size_t done = 0;
+        while (n--)
+            done += write(*buf++);
+        return done;
+    }
+    size_t print(const char *str)
+    {
+        size_t n = 0;
+        while (*str)
+            n += write(*str++);
+        return n;
+    }
+    size_t print(unsigned long value)
+    {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%lu", value);
+        return print(buf);
+    }
+    size_t print(unsigned int value) { return print((unsigned long)value); }
+    size_t print(long value)
+    {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%ld", value);
+        return print(buf);
+    }
+    size_t print(int value) { return print((long)value); }
+    size_t println(const char *str = "") { return print(str) + print("\r\n"); }
+    size_t println(unsigned long value) { return print(value) + println(); }
+};
+
+// Print to a stdio stream, e.g. RA8876_FilePrint out(stdout).
+class RA8876_FilePrint : public Print {
+public:
+    RA8876_FilePrint(FILE *file) : file_8876(file) { }
+    size_t write(uint8_t c) { return fputc(c, file_8876) == EOF ? 0 : 1; }
+
+private:
+    FILE *file_8876;
+};
+
+#endif
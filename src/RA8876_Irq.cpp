@@ -0,0 +1,231 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 INT pin, see RA8876_Irq.h.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ER-TFTM0784-1.h"
+
+#if defined(ARDUINO) || defined(__linux__)
+
+#ifdef __AVR__
+#include <avr/sleep.h>
+#endif
+#ifndef ARDUINO
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+#endif
+
+//-----------------------------------------------------------------------------
+void RA8876_Irq::onEvent(Callback cb, void *ctx)
+{
+#ifdef ARDUINO
+    noInterrupts();
+#endif
+    cb_8876 = cb;
+    ctx_8876 = ctx;
+#ifdef ARDUINO
+    interrupts();
+#endif
+}
+
+void RA8876_Irq::fire()
+{
+    count_8876++;
+    if (cb_8876)
+        cb_8876(ctx_8876);
+}
+
+#ifdef ARDUINO
+
+#if RA8876_IRQ_PINS > 4
+#error "RA8876_IRQ_PINS: at most 4"
+#endif
+
+static RA8876_Irq *irqs[RA8876_IRQ_PINS];
+
+template<uint8_t N>
+static void irqHandler()
+{
+    irqs[N]->fire();
+}
+
+static void (*const irqHandlers[4])() = { irqHandler<0>, irqHandler<1>, irqHandler<2>, irqHandler<3> };
+
+//-----------------------------------------------------------------------------
+RA8876_Irq::RA8876_Irq()
+{
+    count_8876 = 0;
+    cb_8876 = NULL;
+    ctx_8876 = NULL;
+    pin_8876 = 0;
+    slot_8876 = RA8876_IRQ_PINS;
+}
+
+bool RA8876_Irq::attach(uint8_t pin)
+{
+    uint8_t slot;
+
+    detach();
+    for (slot = 0; slot < RA8876_IRQ_PINS && irqs[slot]; slot++);
+    if (slot == RA8876_IRQ_PINS)
+        return false;
+    irqs[slot] = this;
+    pin_8876 = pin;
+    slot_8876 = slot;
+    pinMode(pin, INPUT);
+    attachInterrupt(digitalPinToInterrupt(pin), irqHandlers[slot], FALLING);
+    return true;
+}
+
+void RA8876_Irq::detach()
+{
+    if (slot_8876 == RA8876_IRQ_PINS)
+        return;
+    detachInterrupt(digitalPinToInterrupt(pin_8876));
+    irqs[slot_8876] = NULL;
+    slot_8876 = RA8876_IRQ_PINS;
+}
+
+bool RA8876_Irq::attached() const
+{
+    return slot_8876 != RA8876_IRQ_PINS;
+}
+
+#if defined(__AVR__) || \
+    (defined(__arm__) && !defined(ARDUINO_ARCH_MBED) && !defined(ARDUINO_ARCH_RP2040))
+#define RA8876_IRQ_IDLE
+#endif
+
+// Idles the core until the next interrupt: INT, or the millis() tick at the
+// latest, so the timeout still runs. The count is checked with interrupts
+// off so an INT just before the sleep is not slept through: AVR's sei takes
+// effect after the next instruction, sleep_cpu(), and wfi wakes on an
+// interrupt that is pending while masked. Cores with a scheduler yield.
+bool RA8876_Irq::wait(uint8_t seen, uint16_t timeout_ms)
+{
+    uint32_t start = millis();
+
+    for (;;)
+    {
+#ifdef RA8876_IRQ_IDLE
+        noInterrupts();
+        if (count_8876 != seen)
+        {
+            interrupts();
+            return true;
+        }
+#ifdef __AVR__
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        sleep_enable();
+        interrupts();
+        sleep_cpu();
+        sleep_disable();
+#else
+        __asm__ volatile ("wfi");
+        interrupts();
+#endif
+#else
+        if (count_8876 != seen)
+            return true;
+        yield();
+#endif
+        if (millis() - start >= timeout_ms)
+            return count_8876 != seen;
+    }
+}
+
+void RA8876_Irq::service()
+{
+}
+
+#else // Linux
+
+//-----------------------------------------------------------------------------
+RA8876_Irq::RA8876_Irq()
+{
+    count_8876 = 0;
+    cb_8876 = NULL;
+    ctx_8876 = NULL;
+    fd_8876 = -1;
+}
+
+// Requests 'line' as an input with falling edge events.
+bool RA8876_Irq::attach(const char *gpiochip, unsigned line)
+{
+    struct gpio_v2_line_request req;
+    int fd;
+
+    detach();
+    if (gpiochip == NULL)
+        return false;
+    fd = ::open(gpiochip, O_RDWR);
+    if (fd < 0)
+        return false;
+    memset(&req, 0, sizeof(req));
+    req.offsets[0] = line;
+    req.num_lines = 1;
+    strcpy(req.consumer, "ra8876-int");
+    req.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    if (ioctl(fd, GPIO_V2_GET_LINE_IOCTL, &req) >= 0)
+        fd_8876 = req.fd;
+    ::close(fd);
+    return fd_8876 >= 0;
+}
+
+void RA8876_Irq::detach()
+{
+    if (fd_8876 >= 0)
+        ::close(fd_8876);
+    fd_8876 = -1;
+}
+
+bool RA8876_Irq::attached() const
+{
+    return fd_8876 >= 0;
+}
+
+// Read the edge events queued on the line, waiting up to 'timeout_ms'
+// (-1 forever) for the first. True if there were any.
+bool RA8876_Irq::take(int timeout_ms)
+{
+    struct gpio_v2_line_event ev[16];
+    struct pollfd pfd;
+    ssize_t n;
+
+    pfd.fd = fd_8876;       // poll() just sleeps on a negative fd
+    pfd.events = POLLIN;
+    if (poll(&pfd, 1, timeout_ms) <= 0)
+        return false;
+    n = ::read(fd_8876, ev, sizeof(ev));
+    if (n < 0)
+        return false;
+    for (ssize_t i = 0; i < n / (ssize_t)sizeof(ev[0]); i++)
+        fire();
+    return n >= (ssize_t)sizeof(ev[0]);
+}
+
+bool RA8876_Irq::wait(uint8_t seen, uint16_t timeout_ms)
+{
+    uint32_t start = millis();
+
+    while (count_8876 == seen)
+    {
+        uint32_t spent = millis() - start;
+        if (spent >= timeout_ms)
+            return false;
+        take(timeout_ms - spent);
+    }
+    return true;
+}
+
+void RA8876_Irq::service()
+{
+    while (take(0));
+}
+
+#endif
+
+#endif
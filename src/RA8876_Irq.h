@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 INT pin. The RA8876 asserts INT (active low) when the serial flash
+// DMA, a draw or a BTE operation completes, once
+// RA8876_Driver::Engine_IrqAttach() has enabled that interrupt. An
+// RA8876_Irq counts those events, so Check_BTE_Busy(), Check_Busy_Draw(),
+// Check_2D_Busy() and Check_Busy_SFI_DMA() sleep until INT instead of
+// polling the bus. On AVR and ARM Arduino cores the core idles (sleep_cpu(),
+// wfi) between INT and the millis() tick; cores with a scheduler, such as
+// ESP32 and mbed, yield() instead.
+//
+// On Arduino the count is kept by an interrupt handler and the callback runs
+// in interrupt context. On Linux the pin is a GPIO character device line
+// with falling edge events; they are counted, and the callback run, from
+// wait() and service().
+//
+// The RA8876 keeps INT asserted until the driver clears the flag, so a
+// callback must not touch the bus. It can only note that an engine is done.
+// INT is shared with the other RA8876 interrupts (Vsync, key scan, PWM...):
+// any of them left pending holds INT low, and the engine waits fall back to
+// checking every RA8876_IRQ_TIMEOUT_MS.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_IRQ_H__
+#define __RA8876_IRQ_H__
+
+#include <stdint.h>
+
+class RA8876_Irq {
+public:
+    typedef void (*Callback)(void *ctx);
+
+    RA8876_Irq();
+    ~RA8876_Irq() { detach(); }
+#ifdef ARDUINO
+    // 'pin' must support attachInterrupt(). At most RA8876_IRQ_PINS
+    // RA8876_Irq objects are attached at a time.
+    bool attach(uint8_t pin);
+#else
+    bool attach(const char *gpiochip, unsigned line);
+#endif
+    void detach();
+    bool attached() const;
+
+    // Called on every INT event with 'ctx', NULL for none.
+    void onEvent(Callback cb, void *ctx);
+    // Events so far; wraps around. One byte, so AVR reads it atomically.
+    uint8_t count() const { return count_8876; }
+    // Sleep until count() differs from 'seen' or 'timeout_ms' has passed.
+    // True if an event arrived.
+    bool wait(uint8_t seen, uint16_t timeout_ms);
+    // Take events that have arrived without waiting. Only needed on Linux.
+    void service();
+
+    // Interrupt handler side.
+    void fire();
+
+private:
+    volatile uint8_t count_8876;
+    Callback cb_8876;
+    void *ctx_8876;
+#ifdef ARDUINO
+    uint8_t pin_8876;
+    uint8_t slot_8876;      // RA8876_IRQ_PINS = not attached
+#else
+    int fd_8876;
+
+    bool take(int timeout_ms);
+#endif
+};
+
+#endif
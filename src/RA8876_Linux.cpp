@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Linux userspace backend, see RA8876_Linux.h.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#if !defined(ARDUINO) && defined(__linux__)
+
+#include "ER-TFTM0784-1.h"
+
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+
+//-----------------------------------------------------------------------------
+RA8876_LinuxSpi::RA8876_LinuxSpi()
+{
+    fd_8876 = -1;
+    bits_8876 = 8;
+    ok_8876 = false;
+    hook_8876 = NULL;
+    hookCtx_8876 = NULL;
+    used_8876 = 0;
+    count_8876 = 0;
+}
+
+// With a hook set 'dev' is not opened and may be NULL.
+bool RA8876_LinuxSpi::open(const char *dev, uint8_t bits)
+{
+    uint8_t mode = SPI_MODE_0;
+
+    bits_8876 = bits;
+    used_8876 = 0;
+    count_8876 = 0;
+    if (hook_8876)
+        return ok_8876 = true;
+    close();
+    fd_8876 = ::open(dev, O_RDWR);
+    ok_8876 = fd_8876 >= 0 &&
+              ioctl(fd_8876, SPI_IOC_WR_MODE, &mode) >= 0 &&
+              ioctl(fd_8876, SPI_IOC_WR_BITS_PER_WORD, &bits) >= 0;
+    return ok_8876;
+}
+
+void RA8876_LinuxSpi::close()
+{
+    if (fd_8876 >= 0)
+        ::close(fd_8876);
+    fd_8876 = -1;
+    ok_8876 = false;
+}
+
+uint16_t RA8876_LinuxSpi::add(uint16_t len, uint32_t hz, bool read)
+{
+    if (count_8876 == RA8876_LINUX_SPI_XFERS || room() < len)
+        flush();
+    off_8876[count_8876] = used_8876;
+    len_8876[count_8876] = len;
+    hz_8876[count_8876] = hz;
+    read_8876[count_8876] = read;
+    count_8876++;
+    used_8876 += len;
+    return off_8876[count_8876 - 1];
+}
+
+uint8_t *RA8876_LinuxSpi::extend(uint16_t len)
+{
+    uint8_t *p = tx_8876 + used_8876;
+    len_8876[count_8876 - 1] += len;
+    used_8876 += len;
+    return p;
+}
+
+// Send everything queued as one message. cs_change on all but the last
+// transfer raises CS between them; on the last it would keep CS low.
+bool RA8876_LinuxSpi::flush()
+{
+    struct spi_ioc_transfer xfer[RA8876_LINUX_SPI_XFERS];
+    uint16_t i, n = count_8876;
+    int res;
+
+    if (n == 0)
+        return true;
+    memset(xfer, 0, n * sizeof(xfer[0]));
+    for (i = 0; i < n; i++)
+    {
+        xfer[i].tx_buf = (uintptr_t)(tx_8876 + off_8876[i]);
+        xfer[i].rx_buf = read_8876[i] ? (uintptr_t)(rx_8876 + off_8876[i]) : 0;
+        xfer[i].len = len_8876[i];
+        xfer[i].speed_hz = hz_8876[i];
+        xfer[i].bits_per_word = bits_8876;
+        xfer[i].cs_change = (i + 1 < n);
+    }
+    used_8876 = 0;
+    count_8876 = 0;
+    if (hook_8876)
+        res = hook_8876(hookCtx_8876, xfer, n);
+    else if (fd_8876 >= 0)
+        res = ioctl(fd_8876, SPI_IOC_MESSAGE(n), xfer);
+    else
+        res = -1;
+    if (res < 0)
+        ok_8876 = false;
+    return res >= 0;
+}
+
+//-----------------------------------------------------------------------------
+bool RA8876_LinuxGpio::open(const char *chip, unsigned line, uint8_t value)
+{
+    struct gpio_v2_line_request req;
+    int fd;
+
+    close();
+    if (chip == NULL)
+        return true;
+    fd = ::open(chip, O_RDWR);
+    if (fd < 0)
+        return false;
+    memset(&req, 0, sizeof(req));
+    req.offsets[0] = line;
+    req.num_lines = 1;
+    strcpy(req.consumer, "ra8876");
+    req.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+    req.config.num_attrs = 1;
+    req.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+    req.config.attrs[0].attr.values = value ? 1 : 0;
+    req.config.attrs[0].mask = 1;
+    if (ioctl(fd, GPIO_V2_GET_LINE_IOCTL, &req) >= 0)
+        fd_8876 = req.fd;
+    ::close(fd);
+    return fd_8876 >= 0;
+}
+
+void RA8876_LinuxGpio::write(uint8_t value)
+{
+    struct gpio_v2_line_values v;
+
+    if (fd_8876 < 0)
+        return;
+    v.bits = value ? 1 : 0;
+    v.mask = 1;
+    ioctl(fd_8876, GPIO_V2_LINE_SET_VALUES_IOCTL, &v);
+}
+
+void RA8876_LinuxGpio::close()
+{
+    if (fd_8876 >= 0)
+        ::close(fd_8876);
+    fd_8876 = -1;
+}
+
+//-----------------------------------------------------------------------------
+RA8876_LinuxSpiBus::RA8876_LinuxSpiBus(const char *spidev, uint32_t spi_speed, const char *gpiochip, unsigned rst_line)
+{
+    dev_8876 = spidev;
+    chip_8876 = gpiochip;
+    rstLine_8876 = rst_line;
+    SPI_SPEED_8876 = spi_speed;
+    SPI_READ_8876 = spi_speed;
+    batch_8876 = 0;
+    burstDone_8876 = 0;
+}
+
+void RA8876_LinuxSpiBus::begin()
+{
+    spi_8876.open(dev_8876, 8);
+    rst_8876.open(chip_8876, rstLine_8876, 1);
+}
+
+void RA8876_LinuxSpiBus::hwReset()
+{
+    rst_8876.write(1);
+    delay(1);
+    rst_8876.write(0);
+    delay(1);
+    rst_8876.write(1);
+}
+
+void RA8876_LinuxSpiBus::writeCycle(uint8_t prefix, uint8_t data)
+{
+    uint8_t *p = spi_8876.tx(spi_8876.add(2, SPI_SPEED_8876, false));
+    p[0] = prefix;
+    p[1] = data;
+    if (batch_8876 == 0)
+        spi_8876.flush();
+}
+
+// Queued writes go out in the same message as the read.
+uint8_t RA8876_LinuxSpiBus::readCycle(uint8_t prefix)
+{
+    uint16_t off = spi_8876.add(2, SPI_READ_8876, true);
+    uint8_t *p = spi_8876.tx(off);
+    p[0] = prefix;
+    p[1] = 0xFF;
+    spi_8876.flush();
+    return spi_8876.rx(off)[1];
+}
+
+void RA8876_LinuxSpiBus::burstBegin()
+{
+    *spi_8876.tx(spi_8876.add(1, SPI_SPEED_8876, false)) = RA8876_SPI_DATAWRITE;
+}
+
+// A burst that outgrows the message is sent and continued in a new CS frame,
+// which the memory write port accepts like one long burst.
+uint8_t *RA8876_LinuxSpiBus::burstRoom(uint16_t len)
+{
+    if (spi_8876.room() < len)
+    {
+        spi_8876.flush();
+        burstBegin();
+    }
+    return spi_8876.extend(len);
+}
+
+void RA8876_LinuxSpiBus::burstPixels(const uint16_t *data, uint32_t count)
+{
+    while (count)
+    {
+        if (spi_8876.room() < 2)
+        {
+            spi_8876.flush();
+            burstBegin();
+        }
+        uint32_t n = spi_8876.room() / 2;
+        if (n > count)
+            n = count;
+        uint8_t *p = spi_8876.extend(n * 2);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            *p++ = data[i] & 0xFF; // LSB first!!!
+            *p++ = data[i] >> 8;
+        }
+        data += n;
+        count -= n;
+    }
+}
+
+// One read transfer per message; the RA8876 keeps shifting out memory port
+// data while CS stays low.
+void RA8876_LinuxSpiBus::burstReadPixels(uint16_t *data, uint32_t count)
+{
+    while (count)
+    {
+        uint32_t n = (RA8876_LINUX_SPI_BUF - 1) / 2;
+        if (n > count)
+            n = count;
+        uint16_t off = spi_8876.add(1 + n * 2, SPI_READ_8876, true);
+        uint8_t *p = spi_8876.tx(off);
+        p[0] = RA8876_SPI_DATAREAD;
+        memset(p + 1, 0xFF, n * 2);
+        spi_8876.flush();
+        p = spi_8876.rx(off) + 1;
+        for (uint32_t i = 0; i < n; i++)
+            data[i] = p[2 * i] | p[2 * i + 1] << 8;    // LSB first
+        data += n;
+        count -= n;
+    }
+}
+
+#endif
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Linux userspace backend: RA8876 and SSD2828 over /dev/spidevX.Y, reset
+// lines over the GPIO character device (/dev/gpiochipN).
+//
+// Bus cycles are queued as spi_ioc_transfers, one per RA8876 cycle with CS
+// toggled between them, and sent with a single SPI_IOC_MESSAGE ioctl when a
+// read needs its answer, a batch or burst ends, or the queue is full. A
+// register sequence written inside LCD_BatchBegin()/LCD_BatchEnd() or a
+// picture burst is one syscall.
+//
+// Without hardware, RA8876_LinuxSpi::setHook() replaces the ioctl, and a
+// NULL gpiochip leaves the reset line out.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_LINUX_H__
+#define __RA8876_LINUX_H__
+
+#include <stdint.h>
+#include <linux/spi/spidev.h>
+
+// One message holds at most this many bytes (the spidev module's bufsiz,
+// 4096 by default) and transfers.
+#define RA8876_LINUX_SPI_BUF    4096
+#define RA8876_LINUX_SPI_XFERS  128
+
+// Stands in for ioctl(fd, SPI_IOC_MESSAGE(count), xfer): returns the bytes
+// transferred or -1.
+typedef int (*RA8876_SpiHook)(void *ctx, struct spi_ioc_transfer *xfer, unsigned count);
+
+//==============================================================================
+// Builds one SPI_IOC_MESSAGE from queued transfers. Buffers are referenced by
+// offset until flush(), so the object may be copied.
+class RA8876_LinuxSpi {
+public:
+    RA8876_LinuxSpi();
+    bool open(const char *dev, uint8_t bits);
+    void close();
+    void setHook(RA8876_SpiHook hook, void *ctx) { hook_8876 = hook; hookCtx_8876 = ctx; }
+    bool ok() const { return ok_8876; }
+
+    // Queue a 'len' byte transfer at 'hz' and return its offset for tx()/rx().
+    // 'read' transfers get their rx buffer filled by flush().
+    uint16_t add(uint16_t len, uint32_t hz, bool read);
+    // Grow the last transfer by 'len' bytes, returns where they go.
+    uint8_t *extend(uint16_t len);
+    uint16_t room() const { return RA8876_LINUX_SPI_BUF - used_8876; }
+    uint8_t *tx(uint16_t off) { return tx_8876 + off; }
+    uint8_t *rx(uint16_t off) { return rx_8876 + off; }
+    bool flush();
+
+private:
+    int fd_8876;
+    uint8_t bits_8876;
+    bool ok_8876;
+    RA8876_SpiHook hook_8876;
+    void *hookCtx_8876;
+    uint16_t used_8876;     // bytes queued
+    uint16_t count_8876;    // transfers queued
+    uint16_t off_8876[RA8876_LINUX_SPI_XFERS];
+    uint16_t len_8876[RA8876_LINUX_SPI_XFERS];
+    uint32_t hz_8876[RA8876_LINUX_SPI_XFERS];
+    bool read_8876[RA8876_LINUX_SPI_XFERS];
+    uint8_t tx_8876[RA8876_LINUX_SPI_BUF];
+    uint8_t rx_8876[RA8876_LINUX_SPI_BUF];
+};
+
+//==============================================================================
+// One output line requested from a GPIO chip.
+class RA8876_LinuxGpio {
+public:
+    RA8876_LinuxGpio() : fd_8876(-1) { }
+    bool open(const char *chip, unsigned line, uint8_t value);
+    void write(uint8_t value);
+    void close();
+
+private:
+    int fd_8876;
+};
+
+//==============================================================================
+// RA8876 4-wire SPI on spidev, CS driven by the SPI controller.
+class RA8876_LinuxSpiBus {
+public:
+    RA8876_LinuxSpiBus(const char *spidev, uint32_t spi_speed, const char *gpiochip, unsigned rst_line);
+
+    RA8876_LinuxSpi &spi() { return spi_8876; }
+    bool ok() const { return spi_8876.ok(); }
+
+    uint8_t mode() const { return 2; }
+    void begin();
+    void hwReset();
+    void setCoreClock(uint16_t) { }
+    void setSpeed(uint32_t write_hz, uint32_t read_hz) { SPI_SPEED_8876 = write_hz; SPI_READ_8876 = read_hz; }
+    uint32_t writeSpeed() const { return SPI_SPEED_8876; }
+    uint32_t readSpeed() const { return SPI_READ_8876; }
+
+    void cmdWrite(uint8_t Cmd) { writeCycle(RA8876_SPI_CMDWRITE, Cmd); }
+    void dataWrite(uint8_t data) { writeCycle(RA8876_SPI_DATAWRITE, data); }
+    void dataWrite16(uint16_t data)
+    {
+        burstBegin();
+        burstWrite16(data);
+        burstEnd();
+    }
+    uint16_t dataRead() { return readCycle(RA8876_SPI_DATAREAD); }
+    uint8_t statusRead() { return readCycle(RA8876_SPI_STATUSREAD); }
+
+    // Cycles inside a batch stay queued until the outermost batchEnd().
+    void batchBegin() { batch_8876++; }
+    void batchEnd()
+    {
+        if (batch_8876 && --batch_8876 == 0)
+            spi_8876.flush();
+    }
+
+    void burstBegin();
+    void burstWrite8(uint8_t data) { *burstRoom(1) = data; }
+    void burstWrite16(uint16_t data)
+    {
+        uint8_t *p = burstRoom(2);
+        p[0] = data & 0xFF; // LSB first!!!
+        p[1] = data >> 8;
+    }
+    void burstEnd()
+    {
+        if (batch_8876 == 0)
+            spi_8876.flush();
+    }
+    void burstPixels(const uint16_t *data, uint32_t count);
+    bool burstAsync(const uint16_t *data, uint32_t count)
+    {
+        burstPixels(data, count);
+        burstDone_8876++;
+        return true;
+    }
+    uint32_t burstCompleted() { return burstDone_8876; }
+    void burstReadPixels(uint16_t *data, uint32_t count);
+
+private:
+    void writeCycle(uint8_t prefix, uint8_t data);
+    uint8_t readCycle(uint8_t prefix);
+    uint8_t *burstRoom(uint16_t len);
+
+    const char *dev_8876;
+    const char *chip_8876;
+    unsigned rstLine_8876;
+    uint32_t SPI_SPEED_8876;    // write cycles
+    uint32_t SPI_READ_8876;     // data and status reads
+    uint8_t batch_8876;
+    uint32_t burstDone_8876;
+    RA8876_LinuxSpi spi_8876;
+    RA8876_LinuxGpio rst_8876;
+};
+
+#endif
@@ -0,0 +1,178 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 display lists, see RA8876_List.h.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ER-TFTM0784-1.h"
+
+//-----------------------------------------------------------------------------
+RA8876_DisplayList::RA8876_DisplayList(uint8_t *buf, uint16_t size)
+{
+    buf_8876 = buf;
+    size_8876 = size;
+    len_8876 = 0;
+    overflow_8876 = false;
+}
+
+//-----------------------------------------------------------------------------
+RA8876_ListRecorder::RA8876_ListRecorder(RA8876_DisplayList &list)
+    : list_8876(list)
+{
+    begin();
+}
+
+// Empties the list and forgets the registers written to it.
+void RA8876_ListRecorder::begin()
+{
+    list_8876.len_8876 = 0;
+    list_8876.overflow_8876 = false;
+    open_8876 = 0xFFFF;
+    reg_8876 = 0;
+    memset(known_8876, 0, sizeof(known_8876));
+}
+
+bool RA8876_ListRecorder::reserve(uint16_t n)
+{
+    RA8876_DisplayList &l = list_8876;
+
+    if (l.overflow_8876 || n > l.size_8876 - l.len_8876)
+    {
+        l.overflow_8876 = true;
+        return false;
+    }
+    return true;
+}
+
+void RA8876_ListRecorder::write(uint8_t data, uint8_t keep)
+{
+    uint8_t reg = reg_8876;
+    uint8_t *buf = list_8876.buf_8876;
+    uint16_t &len = list_8876.len_8876;
+    uint8_t *item = open_8876 == 0xFFFF ? NULL : buf + open_8876;
+
+    if (reg == 0x04)
+    {
+        if (item && item[0] == RA8876_LIST_PORT && item[1] < 0xFF)
+        {
+            if (!reserve(1))
+                return;
+            item[1]++;
+        }
+        else
+        {
+            if (!reserve(3))
+                return;
+            open_8876 = len;
+            buf[len++] = RA8876_LIST_PORT;
+            buf[len++] = 1;
+        }
+        buf[len++] = data;
+        return;
+    }
+
+    if (keep)
+    {
+        // Bits outside 'keep' are self-clearing triggers, always keep them.
+        if ((known_8876[reg >> 3] & (1 << (reg & 7))) &&
+            image_8876[reg] == data && (data & ~keep) == 0)
+            return;
+        image_8876[reg] = data & keep;
+        known_8876[reg >> 3] |= 1 << (reg & 7);
+    }
+    // Extend a run of writes to consecutive registers.
+    if (item && item[0] < 0x7F && item[1] + item[0] == reg)
+    {
+        if (!reserve(1))
+            return;
+        item[0]++;
+    }
+    else
+    {
+        if (!reserve(3))
+            return;
+        open_8876 = len;
+        buf[len++] = 1;
+        buf[len++] = reg;
+    }
+    buf[len++] = data;
+}
+
+void RA8876_ListRecorder::write16(uint16_t data)
+{
+    uint8_t *buf = list_8876.buf_8876;
+    uint16_t &len = list_8876.len_8876;
+    uint8_t *item = open_8876 == 0xFFFF ? NULL : buf + open_8876;
+
+    if (item && item[0] == RA8876_LIST_PORT16 && item[1] < 0xFF)
+    {
+        if (!reserve(2))
+            return;
+        item[1]++;
+    }
+    else
+    {
+        if (!reserve(4))
+            return;
+        open_8876 = len;
+        buf[len++] = RA8876_LIST_PORT16;
+        buf[len++] = 1;
+    }
+    buf[len++] = (uint8_t)data;
+    buf[len++] = (uint8_t)(data >> 8);
+}
+
+// The value 'reg' was last given in the list, if any.
+bool RA8876_ListRecorder::read(uint8_t reg, uint8_t *data) const
+{
+    if (!(known_8876[reg >> 3] & (1 << (reg & 7))))
+        return false;
+    *data = image_8876[reg];
+    return true;
+}
+
+void RA8876_ListRecorder::wait(uint8_t engine)
+{
+    uint8_t *buf = list_8876.buf_8876;
+    uint8_t op = RA8876_LIST_WAIT | engine;
+
+    // Nothing was started since the same wait.
+    if (open_8876 != 0xFFFF && buf[open_8876] == op)
+        return;
+    if (!reserve(1))
+        return;
+    open_8876 = list_8876.len_8876;
+    buf[list_8876.len_8876++] = op;
+}
+
+void RA8876_ListRecorder::running(uint8_t engine)
+{
+    if (!reserve(1))
+        return;
+    open_8876 = list_8876.len_8876;
+    list_8876.buf_8876[list_8876.len_8876++] = RA8876_LIST_RUNNING | engine;
+}
+
+// As a C array, e.g. for a PROGMEM table played with List_Play_P().
+void RA8876_DisplayList::print(Print &out, const char *name) const
+{
+    static const char hex[] = "0123456789ABCDEF";
+
+    out.print("const uint8_t ");
+    out.print(name);
+    out.println("[] PROGMEM = {");
+    for (uint16_t i = 0; i < len_8876; i++)
+    {
+        uint8_t b = buf_8876[i];
+        if (i % 16 == 0)
+            out.print("    ");
+        out.print("0x");
+        out.write(hex[b >> 4]);
+        out.write(hex[b & 15]);
+        if (i % 16 == 15 || i + 1 == len_8876)
+            out.println(",");
+        else
+            out.print(", ");
+    }
+    out.println("};");
+}
@@ -0,0 +1,106 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 display lists
+//
+// A display list is the register traffic of a sequence of draw calls,
+// recorded once and sent again with RA8876_Driver::List_Play(). While
+// RA8876_Driver::List_Record() has a recorder attached, register writes,
+// text written through the memory port and engine waits go into the
+// recorder's list instead of to the display. Writes that would not change a
+// register already written in the list are dropped as they are recorded.
+//
+//   static uint8_t buf[512];
+//   RA8876_DisplayList bezel(buf, sizeof(buf));
+//
+//   RA8876_ListRecorder rec(bezel);           // only while recording
+//   tft.List_Record(&rec);
+//   tft.Foreground_color_65k(Blue);
+//   tft.Line_Start_XY(0, 0);
+//   ...
+//   tft.List_Record(NULL);
+//   tft.List_Play(bezel.data(), bezel.length());
+//
+// The list itself is only its buffer and length. The register image that
+// drops repeated writes lives in the RA8876_ListRecorder, about 300 bytes,
+// which can be a local of the function doing the recording.
+//
+// Getters and read-modify-write setters (Text_Mode(), Font_Select_...) see
+// the values recorded so far and otherwise read the display as it is during
+// recording. Only register writes, memory port text and waits are recorded:
+// Show_picture(), the Upload_ functions and other bursts, and reads of
+// display memory, still go to the display and must stay outside a
+// recording. print() writes the list as a C array to keep in PROGMEM.
+//
+// List format, a sequence of items:
+//   0x01..0x7F n, reg, n bytes    write the bytes to reg, reg+1, ...
+//   0x80 | e                      wait for engine e (RA8876_ENGINE_*)
+//   0x88 | e                      engine e left running at the end
+//   0xC0 n, n bytes               write n bytes to the memory port [04h]
+//   0xC1 n, n words               write n 16-bit words, low byte first
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_LIST_H__
+#define __RA8876_LIST_H__
+
+#include <stdint.h>
+
+#define RA8876_LIST_WAIT        0x80
+#define RA8876_LIST_RUNNING     0x88
+#define RA8876_LIST_PORT        0xC0
+#define RA8876_LIST_PORT16      0xC1
+
+// List_Play() canvas argument: keep the canvas address the list sets.
+#define RA8876_LIST_SAME_CANVAS 0xFFFFFFFFUL
+
+class Print;
+
+class RA8876_DisplayList {
+public:
+    RA8876_DisplayList(uint8_t *buf, uint16_t size);
+
+    const uint8_t *data() const { return buf_8876; }
+    uint16_t length() const { return len_8876; }
+    // False if the buffer overflowed; the list is then cut short.
+    bool ok() const { return !overflow_8876; }
+    void print(Print &out, const char *name) const;
+
+private:
+    friend class RA8876_ListRecorder;
+
+    uint8_t *buf_8876;
+    uint16_t size_8876;
+    uint16_t len_8876;
+    bool overflow_8876;
+};
+
+// Recording state for one RA8876_DisplayList, see List_Record().
+class RA8876_ListRecorder {
+public:
+    RA8876_ListRecorder(RA8876_DisplayList &list);
+
+    RA8876_DisplayList &list() { return list_8876; }
+
+    // Called by RA8876_Driver.
+    void begin();
+    void select(uint8_t reg) { reg_8876 = reg; }
+    uint8_t selected() const { return reg_8876; }
+    // 'keep' as RA8876_Driver::shadowKeepMask(): the bits that stay as
+    // written, 0 for registers that must always be written.
+    void write(uint8_t data, uint8_t keep);
+    void write16(uint16_t data);
+    bool read(uint8_t reg, uint8_t *data) const;
+    void wait(uint8_t engine);
+    void running(uint8_t engine);
+
+private:
+    bool reserve(uint16_t n);
+
+    RA8876_DisplayList &list_8876;
+    uint16_t open_8876;     // offset of the item being extended, 0xFFFF = none
+    uint8_t reg_8876;       // register selected by the last command
+    uint8_t image_8876[256];
+    uint8_t known_8876[32];
+};
+
+#endif
@@ -0,0 +1,551 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Software RA8876 and SSD2828 for host builds, see RA8876_Model.h.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#if !defined(ARDUINO) && defined(__linux__)
+
+#include "RA8876_Model.h"
+#include "2828.h"
+
+#include <stdlib.h>
+
+//-----------------------------------------------------------------------------
+RA8876_BusMeter::RA8876_BusMeter()
+{
+    clearStats();
+    now_8876 = 0;
+    clock_8876 = 0;
+    csGap_8876 = 0;
+    message_8876 = 0;
+}
+
+// One CS frame: counts it and returns its time on the wire. spidev sends
+// 9-bit words in two bytes each.
+uint64_t RA8876_BusMeter::account(const struct spi_ioc_transfer &xfer)
+{
+    uint32_t hz = clock_8876 ? clock_8876 : xfer.speed_hz;
+    uint8_t bits = xfer.bits_per_word ? xfer.bits_per_word : 8;
+    uint32_t words = bits > 8 ? xfer.len / 2 : xfer.len;
+    uint64_t ns = 0;
+
+    if (hz)
+        ns = ((uint64_t)words * bits * 1000000000ULL + hz - 1) / hz;
+    stats_8876.frames++;
+    stats_8876.bytes += words;
+    stats_8876.bus_ns += ns + csGap_8876;
+    now_8876 += csGap_8876;
+    return ns;
+}
+
+void RA8876_BusMeter::report(Print &out, const char *name)
+{
+    const RA8876_ModelStats &s = stats_8876;
+
+    out.print(name);
+    out.print(": ");
+    out.print((unsigned long)s.messages);
+    out.print(" messages, ");
+    out.print((unsigned long)s.frames);
+    out.print(" CS frames, ");
+    out.print((unsigned long)s.bytes);
+    out.print(" bytes, ");
+    out.print((unsigned long)(s.bus_ns / 1000));
+    out.println(" us");
+    if (s.cmd_writes || s.data_writes || s.data_reads || s.status_reads)
+    {
+        out.print("  cmd ");
+        out.print((unsigned long)s.cmd_writes);
+        out.print(", data write ");
+        out.print((unsigned long)s.data_writes);
+        out.print(", data read ");
+        out.print((unsigned long)s.data_reads);
+        out.print(", status ");
+        out.print((unsigned long)s.status_reads);
+        out.print(", port bytes ");
+        out.print((unsigned long)s.port_bytes);
+        out.print(", engines ");
+        out.print((unsigned long)s.engines);
+        out.print(", FIFO overruns ");
+        out.println((unsigned long)s.overruns);
+    }
+    if (s.packets)
+    {
+        out.print("  packet bytes ");
+        out.println((unsigned long)s.packets);
+    }
+}
+
+//-----------------------------------------------------------------------------
+RA8876_Model::RA8876_Model()
+{
+    sdram_8876 = (uint8_t *)calloc(1, RA8876_MODEL_SDRAM_SIZE);
+    cgrom_8876 = NULL;
+    flash_8876 = NULL;
+    flashSize_8876 = 0;
+    reset();
+}
+
+RA8876_Model::~RA8876_Model()
+{
+    free(sdram_8876);
+}
+
+void RA8876_Model::reset()
+{
+    memset(reg_8876, 0, sizeof(reg_8876));
+    sel_8876 = 0;
+    engine_8876 = RA8876_ENGINE_IDLE;
+    busyUntil_8876 = 0;
+    bteLeft_8876 = 0;
+    pixel_8876 = 0;
+    dummy_8876 = true;
+    fifoAt_8876 = 0;
+    fifoCost_8876 = RA8876_MODEL_FIFO_NS;
+    readAt_8876 = 0;
+    sdramAt_8876 = 0;
+    bteX_8876 = 0;
+    bteY_8876 = 0;
+    bteUnit_8876 = 0;
+    bteHave_8876 = 0;
+    bteRow_8876 = true;
+}
+
+int RA8876_Model::hook(void *ctx, struct spi_ioc_transfer *xfer, unsigned count)
+{
+    RA8876_Model *m = (RA8876_Model *)ctx;
+    int bytes = 0;
+
+    m->stats_8876.messages++;
+    m->stats_8876.bus_ns += m->message_8876;
+    m->now_8876 += m->message_8876;
+    for (unsigned i = 0; i < count; i++)
+    {
+        m->frame(xfer[i], m->account(xfer[i]));
+        bytes += xfer[i].len;
+    }
+    return bytes;
+}
+
+// A prefix byte, then one cycle per byte: a data burst writes or reads the
+// selected register again for every byte. Model time moves on byte by byte
+// through the frame's 'ns'.
+void RA8876_Model::frame(const struct spi_ioc_transfer &xfer, uint64_t ns)
+{
+    uint64_t begin = now_8876;
+
+    const uint8_t *tx = (const uint8_t *)(uintptr_t)xfer.tx_buf;
+    uint8_t *rx = (uint8_t *)(uintptr_t)xfer.rx_buf;
+
+    now_8876 = begin + ns;
+    if (xfer.len < 2)
+        return;
+    for (uint32_t i = 1; i < xfer.len; i++)
+    {
+        uint8_t in = 0xFF;
+        now_8876 = begin + ns * (i + 1) / xfer.len;
+        switch (tx[0])
+        {
+        case RA8876_SPI_CMDWRITE:
+            stats_8876.cmd_writes++;
+            cmdWrite(tx[i]);
+            break;
+        case RA8876_SPI_DATAWRITE:
+            stats_8876.data_writes++;
+            dataWrite(tx[i]);
+            break;
+        case RA8876_SPI_DATAREAD:
+            stats_8876.data_reads++;
+            in = dataRead();
+            break;
+        case RA8876_SPI_STATUSREAD:
+            stats_8876.status_reads++;
+            in = status();
+            break;
+        }
+        if (rx)
+            rx[i] = in;
+    }
+    if (rx)
+        rx[0] = 0xFF;
+    now_8876 = begin + ns;
+}
+
+// Retire an engine whose time is up.
+void RA8876_Model::update()
+{
+    if (engine_8876 == RA8876_ENGINE_IDLE || now_8876 < busyUntil_8876)
+        return;
+    if (engine_8876 == RA8876_ENGINE_BTE_MCU && bteLeft_8876)
+        return;
+    switch (engine_8876)
+    {
+    case RA8876_ENGINE_DRAW:
+        reg_8876[0x67] &= ~0x80;
+        reg_8876[0x76] &= ~0x80;
+        break;
+    case RA8876_ENGINE_BTE:
+    case RA8876_ENGINE_BTE_MCU:
+        reg_8876[0x90] &= ~0x10;
+        break;
+    case RA8876_ENGINE_DMA:
+        reg_8876[0xB6] &= ~0x01;
+        break;
+    }
+    reg_8876[0x0C] |= 0x04;
+    engine_8876 = RA8876_ENGINE_IDLE;
+}
+
+void RA8876_Model::start(uint8_t engine, uint64_t ns)
+{
+    stats_8876.engines++;
+    engine_8876 = engine;
+    busyUntil_8876 = now_8876 + ns;
+}
+
+uint8_t RA8876_Model::status()
+{
+    uint8_t s = 0;
+    uint64_t queued = fifoAt_8876 > now_8876 ? fifoAt_8876 - now_8876 : 0;
+
+    update();
+    if (queued > (uint64_t)(RA8876_WR_FIFO_DEPTH - 1) * fifoCost_8876)
+        s |= 0x80;
+    if (queued == 0)
+        s |= 0x40;
+    if (now_8876 - readAt_8876 >= RA8876_RD_FIFO_DEPTH * RA8876_MODEL_FIFO_NS)
+        s |= 0x20;
+    if (now_8876 - readAt_8876 < RA8876_MODEL_FIFO_NS)
+        s |= 0x10;
+    if (engine_8876 != RA8876_ENGINE_IDLE && engine_8876 != RA8876_ENGINE_DMA)
+        s |= 0x08;
+    if (now_8876 >= sdramAt_8876)
+        s |= 0x04;
+    if (reg_8876[0xDF] & 0x80)
+        s |= 0x02;
+    if (reg_8876[0x0B] & reg_8876[0x0C] & 0x1F)
+        s |= 0x01;
+    return s;
+}
+
+void RA8876_Model::cmdWrite(uint8_t reg)
+{
+    sel_8876 = reg;
+}
+
+void RA8876_Model::dataWrite(uint8_t data)
+{
+    uint8_t reg = sel_8876;
+
+    update();
+    if (reg == 0x04)
+    {
+        // Text is drawn straight from the FIFO, which then drains one
+        // character at a time.
+        uint64_t cost = RA8876_MODEL_FIFO_NS;
+        if ((reg_8876[0x03] & 0x04) && engine_8876 != RA8876_ENGINE_BTE_MCU)
+        {
+            uint32_t h = 16 + 8 * ((reg_8876[0xCC] >> 4) & 3);
+            cost = (uint64_t)h * h / 2 * (1 + ((reg_8876[0xCD] >> 2) & 3)) *
+                   (1 + (reg_8876[0xCD] & 3)) * RA8876_MODEL_PIXEL_NS;
+        }
+        uint64_t empty = fifoAt_8876 > now_8876 ? fifoAt_8876 : now_8876;
+        if (empty - now_8876 >= RA8876_WR_FIFO_DEPTH * cost)
+            stats_8876.overruns++;
+        fifoAt_8876 = empty + cost;
+        fifoCost_8876 = cost;
+        stats_8876.port_bytes++;
+
+        if (engine_8876 == RA8876_ENGINE_BTE_MCU)
+        {
+            if (bteLeft_8876)
+            {
+                bteData(data);
+                if (--bteLeft_8876 == 0)
+                    busyUntil_8876 = now_8876;
+            }
+            return;
+        }
+        if (reg_8876[0x03] & 0x04)          // text mode: one character
+        {
+            engine_8876 = RA8876_ENGINE_DRAW;
+            busyUntil_8876 = fifoAt_8876;
+            text(data);
+            return;
+        }
+        if (reg_8876[0x03] & 0x03)          // gamma, cursor RAM or palette
+            return;
+        uint32_t addr = portAddress();
+        if (addr < RA8876_MODEL_SDRAM_SIZE)
+            sdram_8876[addr] = data;
+        portAdvance();
+        return;
+    }
+
+    switch (reg)
+    {
+    case 0x00:
+        if (data & 0x01)                    // software reset
+        {
+            reset();
+            return;
+        }
+        break;
+    case 0x0C:                              // flags: write 1 to clear
+        reg_8876[0x0C] &= ~(data & 0x1F);
+        return;
+    case 0x5F: case 0x60: case 0x61: case 0x62:
+        dummy_8876 = true;
+        pixel_8876 = 0;
+        break;
+    case 0x67:
+    case 0x76:
+        reg_8876[reg] = data;
+        if (data & 0x80)
+        {
+            start(RA8876_ENGINE_DRAW, drawTime(reg, data));
+            draw(reg, data);
+        }
+        return;
+    case 0x90:
+        if ((data & 0x10) && !(reg_8876[0x90] & 0x10))
+        {
+            uint8_t op = reg_8876[0x91] & 0x0F;
+            uint32_t px = (uint32_t)reg16(0xB1) * reg16(0xB3);
+
+            reg_8876[0x90] = data;
+            bteX_8876 = 0;
+            bteY_8876 = 0;
+            bteHave_8876 = 0;
+            bteRow_8876 = true;
+            if ((1 << op) & 0x0B13)         // fed through the memory port
+            {
+                start(RA8876_ENGINE_BTE_MCU, 0);
+                bteLeft_8876 = bteBytes();
+            }
+            else                            // fills write, the rest read too
+            {
+                uint8_t passes = (op == 6 || op == 7 || op == 12) ? 1 : 2;
+                start(RA8876_ENGINE_BTE, (uint64_t)px * passes * RA8876_MODEL_PIXEL_NS);
+                bteRun();
+            }
+            return;
+        }
+        break;
+    case 0xB6:
+        reg_8876[0xB6] = data;
+        if (data & 0x01)
+        {
+            uint32_t px = (uint32_t)reg16(0xC6) * reg16(0xC8);
+            if (px == 0)                    // linear mode: a pixel count
+                px = reg32(0xC6);
+            start(RA8876_ENGINE_DMA, (uint64_t)px * RA8876_MODEL_DMA_NS);
+            dmaRun();
+        }
+        return;
+    case 0xE4:
+        if (data & 0x01)
+            sdramAt_8876 = now_8876 + RA8876_MODEL_SDRAM_INIT_NS;
+        break;
+    }
+    reg_8876[reg] = data;
+}
+
+uint8_t RA8876_Model::dataRead()
+{
+    uint8_t reg = sel_8876;
+
+    update();
+    if (reg != 0x04)
+        return reg_8876[reg];
+
+    stats_8876.port_bytes++;
+    readAt_8876 = now_8876;
+    if (engine_8876 == RA8876_ENGINE_BTE_MCU)
+    {
+        if (bteLeft_8876 && --bteLeft_8876 == 0)
+            busyUntil_8876 = now_8876;
+        return 0;
+    }
+    if (dummy_8876)
+    {
+        dummy_8876 = false;
+        return 0;
+    }
+    if (reg_8876[0x03] & 0x07)
+        return 0;
+    uint32_t addr = portAddress();
+    uint8_t data = addr < RA8876_MODEL_SDRAM_SIZE ? sdram_8876[addr] : 0;
+    portAdvance();
+    return data;
+}
+
+// Bytes per canvas pixel.
+uint8_t RA8876_Model::depth() const
+{
+    uint8_t d = reg_8876[0x5E] & 0x03;
+    return d == 0 ? 1 : d == 1 ? 2 : 3;
+}
+
+uint32_t RA8876_Model::portAddress() const
+{
+    if (reg_8876[0x5E] & 0x04)              // linear
+        return reg32(0x5F);
+    uint32_t x = reg16(0x5F), y = reg16(0x61);
+    return reg32(0x50) + (y * reg16(0x54) + x) * depth() + pixel_8876;
+}
+
+// Next byte; in XY mode the cursor moves on after a whole pixel, wrapping
+// at the active window's right and bottom edges.
+void RA8876_Model::portAdvance()
+{
+    if (reg_8876[0x5E] & 0x04)
+    {
+        uint32_t a = reg32(0x5F) + 1;
+        setReg16(0x5F, a & 0xFFFF);
+        setReg16(0x61, a >> 16);
+        return;
+    }
+    if (++pixel_8876 < depth())
+        return;
+    pixel_8876 = 0;
+    uint16_t x = reg16(0x5F) + 1, y = reg16(0x61);
+    if (x >= reg16(0x56) + reg16(0x5A))
+    {
+        x = reg16(0x56);
+        if (++y >= reg16(0x58) + reg16(0x5C))
+            y = reg16(0x58);
+    }
+    setReg16(0x5F, x);
+    setReg16(0x61, y);
+}
+
+static uint32_t modelSpan(uint16_t a, uint16_t b)
+{
+    return (a > b ? a - b : b - a) + 1;
+}
+
+static uint32_t modelLine(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    uint32_t dx = modelSpan(x1, x2), dy = modelSpan(y1, y2);
+    return dx > dy ? dx : dy;
+}
+
+// Pixels the draw engine touches for DCR0 [67h] or DCR1 [76h] = 'data'.
+uint64_t RA8876_Model::drawTime(uint8_t reg, uint8_t data) const
+{
+    uint16_t x1 = reg16(0x68), y1 = reg16(0x6A), x2 = reg16(0x6C), y2 = reg16(0x6E);
+    uint16_t x3 = reg16(0x70), y3 = reg16(0x72);
+    uint32_t a = reg16(0x77), b = reg16(0x79);
+    uint64_t px;
+
+    if (reg == 0x67)
+    {
+        if (!(data & 0x02))                 // line
+            px = modelLine(x1, y1, x2, y2);
+        else if (data & 0x20)               // filled triangle: half its box
+        {
+            uint16_t xl = x1 < x2 ? x1 : x2, xh = x1 < x2 ? x2 : x1;
+            uint16_t yl = y1 < y2 ? y1 : y2, yh = y1 < y2 ? y2 : y1;
+            xl = x3 < xl ? x3 : xl;
+            xh = x3 > xh ? x3 : xh;
+            yl = y3 < yl ? y3 : yl;
+            yh = y3 > yh ? y3 : yh;
+            px = (uint64_t)(xh - xl + 1) * (yh - yl + 1) / 2;
+        }
+        else
+            px = modelLine(x1, y1, x2, y2) + modelLine(x2, y2, x3, y3) + modelLine(x3, y3, x1, y1);
+    }
+    else
+    {
+        bool fill = data & 0x40;
+        switch ((data >> 4) & 3)
+        {
+        case 0:                             // ellipse
+            px = fill ? 3 * a * b + a + b : 4 * (a + b);
+            break;
+        case 1:                             // quarter curve
+            px = fill ? (3 * a * b) / 4 + a + b : a + b;
+            break;
+        default:                            // rectangle, rounded or not
+            px = fill ? (uint64_t)modelSpan(x1, x2) * modelSpan(y1, y2) :
+                        2 * (modelSpan(x1, x2) + modelSpan(y1, y2));
+            break;
+        }
+    }
+    return px * RA8876_MODEL_PIXEL_NS;
+}
+
+// Port bytes an MPU BTE takes: S0 pixels, or for colour expansion rows of
+// 8 or 16-bit units (16 with a 16bpp S0), the first one of each row used
+// from the start bit in the ROP field down.
+uint32_t RA8876_Model::bteBytes() const
+{
+    uint8_t op = reg_8876[0x91] & 0x0F;
+    uint8_t s0 = (reg_8876[0x92] >> 5) & 3;
+    uint8_t bytes = s0 == 0 ? 1 : s0 == 1 ? 2 : 3;
+    uint32_t w = reg16(0xB1), h = reg16(0xB3);
+
+    if (op == 8 || op == 9)
+    {
+        uint8_t unit = s0 == 1 ? 2 : 1;
+        uint8_t first = (reg_8876[0x91] >> 4) % (unit * 8) + 1;
+        uint32_t units = w <= first ? 1 : 1 + (w - first + unit * 8 - 1) / (unit * 8);
+        return units * unit * h;
+    }
+    return w * h * bytes;
+}
+
+//-----------------------------------------------------------------------------
+SSD2828_Model::SSD2828_Model()
+{
+    memset(reg_2828, 0, sizeof(reg_2828));
+    sel_2828 = 0;
+    high_2828 = false;
+}
+
+int SSD2828_Model::hook(void *ctx, struct spi_ioc_transfer *xfer, unsigned count)
+{
+    SSD2828_Model *m = (SSD2828_Model *)ctx;
+    int bytes = 0;
+
+    m->stats_8876.messages++;
+    m->stats_8876.bus_ns += m->message_8876;
+    m->now_8876 += m->message_8876;
+    for (unsigned i = 0; i < count; i++)
+    {
+        const uint8_t *tx = (const uint8_t *)(uintptr_t)xfer[i].tx_buf;
+        m->now_8876 += m->account(xfer[i]);
+        for (uint32_t j = 0; j + 1 < xfer[i].len; j += 2)
+            m->word(tx[j] | tx[j + 1] << 8);
+        bytes += xfer[i].len;
+    }
+    return bytes;
+}
+
+// Bit 8 set: a data byte for the register, low byte first, or a byte of
+// the generic packet when the register is the packet drop register [BFh].
+void SSD2828_Model::word(uint16_t w)
+{
+    uint8_t data = w & 0xFF;
+
+    if (!(w & 0x100))
+    {
+        sel_2828 = data;
+        high_2828 = false;
+        return;
+    }
+    if (sel_2828 == PACKET_DROP_REGISTER)
+    {
+        stats_8876.packets++;
+        return;
+    }
+    if (high_2828)
+        reg_2828[sel_2828] = (reg_2828[sel_2828] & 0x00FF) | data << 8;
+    else
+        reg_2828[sel_2828] = (reg_2828[sel_2828] & 0xFF00) | data;
+    high_2828 = !high_2828;
+}
+
+#endif
@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Software RA8876 and SSD2828 for host builds: the Linux drivers run
+// unchanged with the model answering their spidev messages, so a screen's
+// bus cost can be measured, and driver changes compared, without a panel.
+//
+//   ER_TFTM0784 tft((const char *)NULL, 20000000, (const char *)NULL, 0);
+//   SSD2828 bridge(NULL, NULL, 0);
+//   RA8876_Model model;
+//   SSD2828_Model bridgeModel;
+//
+//   model.attach(tft.bus().spi());
+//   bridgeModel.attach(bridge.spi());
+//   ...
+//   model.report(out);
+//
+// Both models count SPI_IOC_MESSAGEs, CS frames and bytes and turn them
+// into an estimated bus time: the bits of each frame at its clock (or at
+// setClock() for every frame), plus setCsGap() per frame and
+// setMessageCost() per message. delay() calls in the drivers are not
+// counted.
+//
+// RA8876_Model keeps the register file and the 16 MB SDRAM. The memory
+// port [04h] writes and reads SDRAM in graphic mode, at the cursor inside
+// the active window (XY mode) or at the linear address ([5Eh] bit 2), left
+// to right and top down only; the first read after the cursor moves is the
+// dummy read. Draws, BTE operations, CGROM text and serial flash DMA are
+// drawn into SDRAM as they start (RA8876_Raster.cpp), and timed: they keep
+// status bit 3 (or [B6h] bit 0) set for a time estimated from their size,
+// then clear their start bit and raise the [0Ch] bit 2 flag. The write FIFO
+// drains RA8876_MODEL_FIFO_NS per byte, or one character's drawing time per
+// byte in text mode, and counts writes into a full FIFO as overruns; the
+// read FIFO refills at RA8876_MODEL_FIFO_NS. Time only moves with bus
+// traffic, so every status poll of a busy wait shows up in the estimate.
+//
+// The drawing follows the datasheet with the usual integer algorithms
+// (Bresenham lines, midpoint ellipses); check it once against a panel, see
+// extras/ra8876_golden. Text needs the CGROM glyphs from setCgrom(), read
+// off a panel with ra8876_golden cgrom; without them only the character
+// background is drawn. DMA copies from the image given to setFlash(), in
+// block mode. Not drawn: the external font ROM and user-defined fonts, font
+// rotation, BTE memory copy with colour expansion (ops 14, 15), MPU reads,
+// and per-pixel alpha in S1.
+//
+// SSD2828_Model keeps the 16-bit register file and counts the generic
+// packet bytes sent through [BFh].
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_MODEL_H__
+#define __RA8876_MODEL_H__
+
+#include "ER-TFTM0784-1.h"
+
+#if !defined(ARDUINO) && defined(__linux__)
+
+// Core time per pixel drawn or moved, memory write FIFO drain time per byte,
+// serial flash DMA time per pixel, SDRAM initialisation after [E4h] bit 0.
+#define RA8876_MODEL_PIXEL_NS       10
+#define RA8876_MODEL_FIFO_NS        20
+#define RA8876_MODEL_DMA_NS         80
+#define RA8876_MODEL_SDRAM_INIT_NS  20000UL
+
+#define RA8876_MODEL_SDRAM_SIZE     (16UL << 20)
+
+// setCgrom() table: 256 glyphs of 8x16, then 12x24, then 16x32, rows of
+// whole bytes with the leftmost pixel in bit 7.
+#define RA8876_MODEL_CGROM_SIZE     (256 * (16 * 1 + 24 * 2 + 32 * 2))
+
+struct RA8876_ModelStats {
+    uint32_t messages;      // SPI_IOC_MESSAGE calls
+    uint32_t frames;        // CS cycles
+    uint64_t bytes;         // bytes (or 9-bit words) on the wire, prefixes included
+    uint64_t bus_ns;        // estimated bus time
+    uint32_t cmd_writes;    // RA8876: cycles by prefix
+    uint32_t data_writes;
+    uint32_t data_reads;
+    uint32_t status_reads;
+    uint64_t port_bytes;    // RA8876: memory port data written and read
+    uint32_t overruns;      // RA8876: bytes written into a full FIFO
+    uint32_t engines;       // RA8876: draws, BTEs and DMAs started
+    uint32_t packets;       // SSD2828: generic packet bytes
+};
+
+//==============================================================================
+// Counting and timing shared by both models.
+class RA8876_BusMeter {
+public:
+    RA8876_BusMeter();
+
+    // 0: every frame at the clock the driver asked for.
+    void setClock(uint32_t hz) { clock_8876 = hz; }
+    void setCsGap(uint32_t ns) { csGap_8876 = ns; }
+    void setMessageCost(uint32_t ns) { message_8876 = ns; }
+
+    const RA8876_ModelStats &stats() const { return stats_8876; }
+    void clearStats() { memset(&stats_8876, 0, sizeof(stats_8876)); }
+    // Model time: bus time since construction, never cleared.
+    uint64_t now() const { return now_8876; }
+    void report(Print &out, const char *name);
+
+protected:
+    uint64_t account(const struct spi_ioc_transfer &xfer);
+
+    RA8876_ModelStats stats_8876;
+    uint64_t now_8876;
+    uint32_t clock_8876;
+    uint32_t csGap_8876;
+    uint32_t message_8876;
+};
+
+//==============================================================================
+class RA8876_Model : public RA8876_BusMeter {
+public:
+    RA8876_Model();
+    ~RA8876_Model();
+
+    void attach(RA8876_LinuxSpi &spi) { spi.setHook(hook, this); }
+    static int hook(void *ctx, struct spi_ioc_transfer *xfer, unsigned count);
+
+    // Power-on state: registers 0, SDRAM kept.
+    void reset();
+    uint8_t reg(uint8_t reg) const { return reg_8876[reg]; }
+    uint8_t *sdram() { return sdram_8876; }
+    uint8_t status();
+    void report(Print &out) { RA8876_BusMeter::report(out, "RA8876"); }
+
+    // Kept by pointer, NULL to drop.
+    void setCgrom(const uint8_t *glyphs) { cgrom_8876 = glyphs; }
+    void setFlash(const uint8_t *data, uint32_t size) { flash_8876 = data; flashSize_8876 = size; }
+    // A w x h window of the image at 'addr', 'width' pixels per line and
+    // 'bytes' per pixel, as a binary PPM.
+    void writePpm(Print &out, uint32_t addr, uint16_t width, uint16_t w, uint16_t h, uint8_t bytes = 2);
+
+private:
+    void frame(const struct spi_ioc_transfer &xfer, uint64_t ns);
+    void cmdWrite(uint8_t reg);
+    void dataWrite(uint8_t data);
+    uint8_t dataRead();
+    void update();
+    void start(uint8_t engine, uint64_t ns);
+    uint16_t reg16(uint8_t reg) const { return reg_8876[reg] | reg_8876[reg + 1] << 8; }
+    void setReg16(uint8_t reg, uint16_t v) { reg_8876[reg] = v & 0xFF; reg_8876[reg + 1] = v >> 8; }
+    uint32_t reg32(uint8_t reg) const { return reg16(reg) | (uint32_t)reg16(reg + 2) << 16; }
+    uint8_t depth() const;
+    uint32_t portAddress() const;
+    void portAdvance();
+    uint64_t drawTime(uint8_t reg, uint8_t data) const;
+    uint32_t bteBytes() const;
+
+    // RA8876_Raster.cpp
+    uint32_t colour(uint8_t reg, uint8_t bytes) const;
+    uint32_t get(uint32_t addr, uint8_t bytes) const;
+    void put(uint32_t addr, uint8_t bytes, uint32_t v);
+    void plot(int32_t x, int32_t y, uint32_t c);
+    void span(int32_t x1, int32_t x2, int32_t y, uint32_t c);
+    void line(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t c);
+    void draw(uint8_t reg, uint8_t data);
+    void triangle(bool fill, uint32_t c);
+    void ellipse(uint8_t quadrants, bool fill, uint32_t c);
+    void roundRect(bool fill, uint32_t c);
+    void bteRun();
+    void bteData(uint8_t data);
+    void bteWrite(uint16_t x, uint16_t y, uint32_t s0);
+    uint32_t bteSource(uint8_t src, uint16_t x, uint16_t y, uint8_t bytes) const;
+    void text(uint8_t code);
+    void dmaRun();
+
+    uint8_t *sdram_8876;
+    uint8_t reg_8876[256];
+    uint8_t sel_8876;           // register selected by the last command
+    uint8_t engine_8876;        // RA8876_ENGINE_* running
+    uint64_t busyUntil_8876;
+    uint32_t bteLeft_8876;      // port bytes an MPU BTE still takes
+    uint8_t pixel_8876;         // bytes of the current pixel written so far
+    bool dummy_8876;            // next port read is the dummy read
+    uint64_t fifoAt_8876;       // write FIFO empty from this time
+    uint64_t fifoCost_8876;     // drain time of the last byte written
+    uint64_t readAt_8876;       // time of the last port read
+    uint64_t sdramAt_8876;      // SDRAM ready from this time
+    const uint8_t *cgrom_8876;
+    const uint8_t *flash_8876;
+    uint32_t flashSize_8876;
+    uint16_t bteX_8876;         // MPU BTE: next pixel in the BTE window
+    uint16_t bteY_8876;
+    uint32_t bteUnit_8876;      // MPU BTE: data assembled so far
+    uint8_t bteHave_8876;       // bytes of it
+    bool bteRow_8876;           // colour expansion: next unit starts a row
+};
+
+//==============================================================================
+class SSD2828_Model : public RA8876_BusMeter {
+public:
+    SSD2828_Model();
+
+    void attach(RA8876_LinuxSpi &spi) { spi.setHook(hook, this); }
+    static int hook(void *ctx, struct spi_ioc_transfer *xfer, unsigned count);
+
+    uint16_t reg(uint8_t reg) const { return reg_2828[reg]; }
+    void report(Print &out) { RA8876_BusMeter::report(out, "SSD2828"); }
+
+private:
+    void word(uint16_t w);
+
+    uint16_t reg_2828[256];
+    uint8_t sel_2828;
+    bool high_2828;             // next data byte is the register's high byte
+};
+
+#endif
+
+#endif
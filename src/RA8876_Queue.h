@@ -0,0 +1,359 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// Command queue in front of an RA8876_Driver, for drawing from several
+// threads or cores. The driver itself has no locking: the canvas, the BTE
+// windows and the colour registers are shared state, so two threads drawing
+// at once corrupt each other's operations. Instead, any number of producers
+// push high-level commands here and one display task calls drain(), which is
+// the only code touching the driver.
+//
+//   RA8876_Queue<ER_TFTM0784> queue(tft);
+//   queue.fill(0, 0, 99, 99, 0xF800);         // any thread, never blocks
+//   queue.drain();                            // display task
+//
+// The queue is a bounded ring with a sequence number per slot (Vyukov's
+// MPMC queue, used with a single consumer): push() claims a slot with one
+// compare-and-swap and never waits for other producers or the display task.
+// A full queue drops the command and counts it. drain() merges neighbouring
+// commands where the result is the same: fills of one colour that join into
+// one rectangle, and a fill hidden by the next one.
+//
+// Needs the GCC __atomic builtins; not built on AVR, which has no threads.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_QUEUE_H__
+#define __RA8876_QUEUE_H__
+
+#include "ER-TFTM0784-1.h"
+
+#if !defined(__AVR__)
+
+#define RA8876_QCMD_FILL        0   // x0, y0, x1, y1, fg
+#define RA8876_QCMD_RECT        1   // x0, y0, x1, y1, fg
+#define RA8876_QCMD_LINE        2   // x0, y0, x1, y1, fg
+#define RA8876_QCMD_CIRCLE      3   // centre x0, y0, radius x1, fg
+#define RA8876_QCMD_DISC        4   // centre x0, y0, radius x1, fg
+#define RA8876_QCMD_TEXT        5   // x0, y0, fg, bg, text
+#define RA8876_QCMD_CALL        6   // fn(driver, ctx)
+
+struct RA8876_QueueStats {
+    uint32_t pushed;        // commands accepted
+    uint32_t dropped;       // commands refused, queue full
+    uint32_t executed;      // driver operations run by drain()
+    uint32_t merged;        // commands folded into a neighbour
+    uint16_t depth;         // commands waiting at the last drain()
+    uint16_t max_depth;
+    uint32_t wait_us_max;   // push() to execution
+    uint32_t wait_us_total;
+};
+
+template<class Driver, uint16_t DEPTH = RA8876_QUEUE_DEPTH>
+class RA8876_Queue {
+    static_assert((DEPTH & (DEPTH - 1)) == 0, "RA8876_Queue DEPTH must be a power of two");
+
+public:
+    typedef void (*Call)(Driver &tft, void *ctx);
+
+    RA8876_Queue(Driver &tft) : tft_8876(tft)
+    {
+        for (uint32_t i = 0; i < DEPTH; i++)
+            cell_8876[i].seq = i;
+        head_8876 = 0;
+        tail_8876 = 0;
+        memset(&stats_8876, 0, sizeof(stats_8876));
+    }
+
+    // Producers. False if the queue was full and the command dropped.
+    bool fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+    {
+        return shape(RA8876_QCMD_FILL, x0, y0, x1, y1, color);
+    }
+    bool rect(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+    {
+        return shape(RA8876_QCMD_RECT, x0, y0, x1, y1, color);
+    }
+    bool line(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+    {
+        Cmd c;
+        c.op = RA8876_QCMD_LINE;
+        c.x0 = x0; c.y0 = y0; c.x1 = x1; c.y1 = y1;
+        c.fg = color;
+        return push(c);
+    }
+    bool circle(uint16_t x, uint16_t y, uint16_t r, uint16_t color, bool filled)
+    {
+        Cmd c;
+        c.op = filled ? RA8876_QCMD_DISC : RA8876_QCMD_CIRCLE;
+        c.x0 = x; c.y0 = y; c.x1 = r;
+        c.fg = color;
+        return push(c);
+    }
+    // CGROM text; cut to RA8876_QUEUE_TEXT - 1 characters.
+    bool text(uint16_t x, uint16_t y, uint16_t fg, uint16_t bg, const char *str)
+    {
+        Cmd c;
+        c.op = RA8876_QCMD_TEXT;
+        c.x0 = x; c.y0 = y;
+        c.fg = fg; c.bg = bg;
+        strncpy(c.text, str, sizeof(c.text) - 1);
+        c.text[sizeof(c.text) - 1] = '\0';
+        return push(c);
+    }
+    // Anything else: 'fn' runs on the display task, in order with the rest.
+    bool call(Call fn, void *ctx)
+    {
+        Cmd c;
+        c.op = RA8876_QCMD_CALL;
+        c.fn = fn;
+        c.ctx = ctx;
+        return push(c);
+    }
+
+    // Display task: run up to 'max' commands, merging where possible.
+    // Returns the number taken from the queue.
+    uint16_t drain(uint16_t max = 0xFFFF)
+    {
+        Cmd cur, next;
+        uint16_t taken = 0;
+
+        stats_8876.depth = pending();
+        if (stats_8876.depth > stats_8876.max_depth)
+            stats_8876.max_depth = stats_8876.depth;
+        if (max == 0 || !pop(cur))
+            return 0;
+        taken = 1;
+        for (;;)
+        {
+            bool more = taken < max && pop(next);
+            if (more)
+                taken++;
+            if (more && merge(cur, next))
+            {
+                stats_8876.merged++;
+                continue;
+            }
+            run(cur);
+            if (!more)
+                break;
+            cur = next;
+        }
+        return taken;
+    }
+
+    // Commands waiting; exact only on the display task.
+    uint16_t pending() const
+    {
+        return (uint16_t)(__atomic_load_n(&head_8876, __ATOMIC_ACQUIRE) - tail_8876);
+    }
+
+    // Copy of the counters, cleared if 'clear'. Display task only.
+    RA8876_QueueStats stats(bool clear = false)
+    {
+        RA8876_QueueStats out;
+        out.pushed = __atomic_load_n(&stats_8876.pushed, __ATOMIC_RELAXED);
+        out.dropped = __atomic_load_n(&stats_8876.dropped, __ATOMIC_RELAXED);
+        out.executed = stats_8876.executed;
+        out.merged = stats_8876.merged;
+        out.depth = stats_8876.depth;
+        out.max_depth = stats_8876.max_depth;
+        out.wait_us_max = stats_8876.wait_us_max;
+        out.wait_us_total = stats_8876.wait_us_total;
+        if (clear)
+        {
+            __atomic_fetch_sub(&stats_8876.pushed, out.pushed, __ATOMIC_RELAXED);
+            __atomic_fetch_sub(&stats_8876.dropped, out.dropped, __ATOMIC_RELAXED);
+            stats_8876.executed = 0;
+            stats_8876.merged = 0;
+            stats_8876.max_depth = 0;
+            stats_8876.wait_us_max = 0;
+            stats_8876.wait_us_total = 0;
+        }
+        return out;
+    }
+
+    void report(Print &out)
+    {
+        RA8876_QueueStats s = stats();
+        out.print("RA8876 queue: pushed ");
+        out.print(s.pushed);
+        out.print(", dropped ");
+        out.print(s.dropped);
+        out.print(", run ");
+        out.print(s.executed);
+        out.print(", merged ");
+        out.print(s.merged);
+        out.print(", depth ");
+        out.print((unsigned long)s.depth);
+        out.print(" max ");
+        out.print((unsigned long)s.max_depth);
+        out.print(", wait max ");
+        out.print(s.wait_us_max);
+        out.print(" us avg ");
+        out.print(s.executed ? s.wait_us_total / s.executed : 0UL);
+        out.println(" us");
+    }
+
+private:
+    struct Cmd {
+        uint8_t op;
+        uint16_t x0, y0, x1, y1;
+        uint16_t fg, bg;
+        uint32_t stamp;         // micros() at push()
+        Call fn;
+        void *ctx;
+        char text[RA8876_QUEUE_TEXT];
+    };
+    struct Cell {
+        uint32_t seq;           // == position: free for that push; +1: full
+        Cmd cmd;
+    };
+
+    bool shape(uint8_t op, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color)
+    {
+        Cmd c;
+        c.op = op;
+        c.x0 = x0 < x1 ? x0 : x1;
+        c.x1 = x0 < x1 ? x1 : x0;
+        c.y0 = y0 < y1 ? y0 : y1;
+        c.y1 = y0 < y1 ? y1 : y0;
+        c.fg = color;
+        return push(c);
+    }
+
+    bool push(Cmd &c)
+    {
+        uint32_t pos = __atomic_load_n(&head_8876, __ATOMIC_RELAXED);
+        Cell *cell;
+
+        for (;;)
+        {
+            cell = &cell_8876[pos & (DEPTH - 1)];
+            int32_t dif = (int32_t)(__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) - pos);
+            if (dif == 0)
+            {
+                if (__atomic_compare_exchange_n(&head_8876, &pos, pos + 1, true,
+                                                __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                    break;
+            }
+            else if (dif < 0)
+            {
+                __atomic_fetch_add(&stats_8876.dropped, 1, __ATOMIC_RELAXED);
+                return false;
+            }
+            else
+                pos = __atomic_load_n(&head_8876, __ATOMIC_RELAXED);
+        }
+        c.stamp = micros();
+        cell->cmd = c;
+        __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+        __atomic_fetch_add(&stats_8876.pushed, 1, __ATOMIC_RELAXED);
+        return true;
+    }
+
+    bool pop(Cmd &c)
+    {
+        Cell *cell = &cell_8876[tail_8876 & (DEPTH - 1)];
+
+        if (__atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE) != tail_8876 + 1)
+            return false;
+        c = cell->cmd;
+        __atomic_store_n(&cell->seq, tail_8876 + DEPTH, __ATOMIC_RELEASE);
+        tail_8876++;
+        return true;
+    }
+
+    static bool covers(const Cmd &a, const Cmd &b)
+    {
+        return a.x0 <= b.x0 && a.x1 >= b.x1 && a.y0 <= b.y0 && a.y1 >= b.y1;
+    }
+
+    // Fold 'b' into 'a' if drawing 'a' alone gives the same picture.
+    bool merge(Cmd &a, const Cmd &b)
+    {
+        if (a.op != RA8876_QCMD_FILL || b.op != RA8876_QCMD_FILL)
+            return false;
+        if (covers(b, a))                   // 'a' is painted over
+        {
+            uint32_t stamp = a.stamp;
+            a = b;
+            a.stamp = stamp;
+            return true;
+        }
+        if (a.fg != b.fg)
+            return false;
+        if (covers(a, b))
+            return true;
+        if (a.y0 == b.y0 && a.y1 == b.y1 && (b.x0 == a.x1 + 1 || a.x0 == b.x1 + 1))
+        {
+            a.x0 = a.x0 < b.x0 ? a.x0 : b.x0;
+            a.x1 = a.x1 > b.x1 ? a.x1 : b.x1;
+            return true;
+        }
+        if (a.x0 == b.x0 && a.x1 == b.x1 && (b.y0 == a.y1 + 1 || a.y0 == b.y1 + 1))
+        {
+            a.y0 = a.y0 < b.y0 ? a.y0 : b.y0;
+            a.y1 = a.y1 > b.y1 ? a.y1 : b.y1;
+            return true;
+        }
+        return false;
+    }
+
+    void run(const Cmd &c)
+    {
+        uint32_t wait = micros() - c.stamp;
+
+        stats_8876.executed++;
+        stats_8876.wait_us_total += wait;
+        if (wait > stats_8876.wait_us_max)
+            stats_8876.wait_us_max = wait;
+        switch (c.op)
+        {
+        case RA8876_QCMD_FILL:
+        case RA8876_QCMD_RECT:
+            tft_8876.Foreground_color_65k(c.fg);
+            tft_8876.Square_Start_XY(c.x0, c.y0);
+            tft_8876.Square_End_XY(c.x1, c.y1);
+            if (c.op == RA8876_QCMD_FILL)
+                tft_8876.Start_Square_Fill();
+            else
+                tft_8876.Start_Square();
+            break;
+        case RA8876_QCMD_LINE:
+            tft_8876.Foreground_color_65k(c.fg);
+            tft_8876.Line_Start_XY(c.x0, c.y0);
+            tft_8876.Line_End_XY(c.x1, c.y1);
+            tft_8876.Start_Line();
+            break;
+        case RA8876_QCMD_CIRCLE:
+        case RA8876_QCMD_DISC:
+            tft_8876.Foreground_color_65k(c.fg);
+            tft_8876.Circle_Center_XY(c.x0, c.y0);
+            tft_8876.Circle_Radius_R(c.x1);
+            if (c.op == RA8876_QCMD_DISC)
+                tft_8876.Start_Circle_or_Ellipse_Fill();
+            else
+                tft_8876.Start_Circle_or_Ellipse();
+            break;
+        case RA8876_QCMD_TEXT:
+            tft_8876.Foreground_color_65k(c.fg);
+            tft_8876.Background_color_65k(c.bg);
+            tft_8876.Goto_Text_XY(c.x0, c.y0);
+            tft_8876.Show_String(c.text);
+            break;
+        case RA8876_QCMD_CALL:
+            c.fn(tft_8876, c.ctx);
+            break;
+        }
+    }
+
+    Driver &tft_8876;
+    Cell cell_8876[DEPTH];
+    uint32_t head_8876;         // next push position, shared by producers
+    uint32_t tail_8876;         // next pop position, display task only
+    RA8876_QueueStats stats_8876;
+};
+
+#endif // !__AVR__
+
+#endif
@@ -0,0 +1,616 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876_Model drawing: the draw engine, BTE, CGROM text and serial flash
+// DMA rendered into the model's SDRAM, see RA8876_Model.h.
+//
+// Pixels are kept in the format of the image they are in: 1 byte RGB332,
+// 2 bytes RGB565 or 3 bytes RGB888, low byte first. Colour registers hold
+// R, G, B in three bytes and are converted the same way.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#if !defined(ARDUINO) && defined(__linux__)
+
+#include "RA8876_Model.h"
+
+// Bytes per pixel for a 2-bit colour depth field: 8, 16, 24bpp.
+static uint8_t rasterBytes(uint8_t depth)
+{
+    return depth == 0 ? 1 : depth == 1 ? 2 : 3;
+}
+
+static uint32_t rasterToRgb(uint32_t v, uint8_t bytes)
+{
+    if (bytes == 1)
+        return (v & 0xE0) << 16 | ((v << 3) & 0xE0) << 8 | ((v << 6) & 0xC0);
+    if (bytes == 2)
+        return ((v >> 8) & 0xF8) << 16 | ((v >> 3) & 0xFC) << 8 | ((v << 3) & 0xF8);
+    return v & 0xFFFFFF;
+}
+
+static uint32_t rasterFromRgb(uint32_t rgb, uint8_t bytes)
+{
+    uint8_t r = rgb >> 16, g = rgb >> 8, b = rgb;
+
+    if (bytes == 1)
+        return (r & 0xE0) | (g & 0xE0) >> 3 | b >> 6;
+    if (bytes == 2)
+        return (r & 0xF8) << 8 | (g & 0xFC) << 3 | b >> 3;
+    return rgb & 0xFFFFFF;
+}
+
+static uint32_t rasterConvert(uint32_t v, uint8_t from, uint8_t to)
+{
+    return from == to ? v : rasterFromRgb(rasterToRgb(v, from), to);
+}
+
+// The 16 BTE raster operations on S0 and S1.
+static uint32_t rasterRop(uint8_t rop, uint32_t s0, uint32_t s1, uint8_t bytes)
+{
+    uint32_t mask = bytes == 1 ? 0xFF : bytes == 2 ? 0xFFFF : 0xFFFFFF;
+    uint32_t d = 0;
+
+    switch (rop & 0x0F)
+    {
+    case 0:  d = 0; break;
+    case 1:  d = ~(s0 | s1); break;
+    case 2:  d = ~s0 & s1; break;
+    case 3:  d = ~s0; break;
+    case 4:  d = s0 & ~s1; break;
+    case 5:  d = ~s1; break;
+    case 6:  d = s0 ^ s1; break;
+    case 7:  d = ~(s0 & s1); break;
+    case 8:  d = s0 & s1; break;
+    case 9:  d = ~(s0 ^ s1); break;
+    case 10: d = s1; break;
+    case 11: d = ~s0 | s1; break;
+    case 12: d = s0; break;
+    case 13: d = s0 | ~s1; break;
+    case 14: d = s0 | s1; break;
+    case 15: d = mask; break;
+    }
+    return d & mask;
+}
+
+// S0 x (1 - alpha) + S1 x alpha, alpha in 32nds, per channel.
+static uint32_t rasterBlend(uint32_t s0, uint32_t s1, uint8_t alpha, uint8_t bytes)
+{
+    uint32_t a = rasterToRgb(s0, bytes), b = rasterToRgb(s1, bytes), rgb = 0;
+
+    for (uint8_t shift = 0; shift < 24; shift += 8)
+    {
+        uint32_t c = (((a >> shift) & 0xFF) * (32 - alpha) + ((b >> shift) & 0xFF) * alpha) / 32;
+        rgb |= c << shift;
+    }
+    return rasterFromRgb(rgb, bytes);
+}
+
+//-----------------------------------------------------------------------------
+// Colour register triple at 'reg' (R, G, B) as a pixel of 'bytes'.
+uint32_t RA8876_Model::colour(uint8_t reg, uint8_t bytes) const
+{
+    uint32_t rgb = (uint32_t)reg_8876[reg] << 16 | reg_8876[reg + 1] << 8 | reg_8876[reg + 2];
+    return rasterFromRgb(rgb, bytes);
+}
+
+uint32_t RA8876_Model::get(uint32_t addr, uint8_t bytes) const
+{
+    uint32_t v = 0;
+
+    for (uint8_t i = 0; i < bytes; i++)
+        if (addr + i < RA8876_MODEL_SDRAM_SIZE)
+            v |= (uint32_t)sdram_8876[addr + i] << (8 * i);
+    return v;
+}
+
+void RA8876_Model::put(uint32_t addr, uint8_t bytes, uint32_t v)
+{
+    for (uint8_t i = 0; i < bytes; i++)
+        if (addr + i < RA8876_MODEL_SDRAM_SIZE)
+            sdram_8876[addr + i] = v >> (8 * i);
+}
+
+// One canvas pixel, clipped to the active window.
+void RA8876_Model::plot(int32_t x, int32_t y, uint32_t c)
+{
+    int32_t wx = reg16(0x56), wy = reg16(0x58);
+
+    if (x < wx || y < wy || x >= wx + reg16(0x5A) || y >= wy + reg16(0x5C))
+        return;
+    put(reg32(0x50) + ((uint32_t)y * reg16(0x54) + x) * depth(), depth(), c);
+}
+
+void RA8876_Model::span(int32_t x1, int32_t x2, int32_t y, uint32_t c)
+{
+    if (x1 > x2)
+    {
+        int32_t t = x1;
+        x1 = x2;
+        x2 = t;
+    }
+    for (int32_t x = x1; x <= x2; x++)
+        plot(x, y, c);
+}
+
+void RA8876_Model::line(int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t c)
+{
+    int32_t dx = x2 > x1 ? x2 - x1 : x1 - x2, sx = x1 < x2 ? 1 : -1;
+    int32_t dy = y2 > y1 ? y1 - y2 : y2 - y1, sy = y1 < y2 ? 1 : -1;
+    int32_t err = dx + dy;
+
+    for (;;)
+    {
+        plot(x1, y1, c);
+        if (x1 == x2 && y1 == y2)
+            break;
+        int32_t e2 = 2 * err;
+        if (e2 >= dy)
+        {
+            err += dy;
+            x1 += sx;
+        }
+        if (e2 <= dx)
+        {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Widest x offset of a midpoint ellipse with radii a, b for each y offset
+// 0..b, and the outline points through 'point'.
+template<class Point>
+static void rasterEllipse(int32_t a, int32_t b, int32_t *widest, Point point)
+{
+    int64_t a2 = (int64_t)a * a, b2 = (int64_t)b * b;
+    int32_t x = 0, y = b;
+    int64_t d = 4 * b2 - 4 * a2 * b + a2;
+
+    for (int32_t i = 0; i <= b; i++)
+        widest[i] = 0;
+    while (b2 * x < a2 * y)
+    {
+        point(x, y);
+        if (x > widest[y])
+            widest[y] = x;
+        if (d < 0)
+            d += 4 * b2 * (2 * x + 3);
+        else
+        {
+            d += 4 * (b2 * (2 * x + 3) + a2 * (2 - 2 * y));
+            y--;
+        }
+        x++;
+    }
+    d = b2 * (2 * x + 1) * (2 * x + 1) + 4 * a2 * (y - 1) * (y - 1) - 4 * a2 * b2;
+    while (y >= 0)
+    {
+        point(x, y);
+        if (x > widest[y])
+            widest[y] = x;
+        if (d > 0)
+            d += 4 * a2 * (3 - 2 * y);
+        else
+        {
+            d += 4 * (b2 * (2 * x + 2) + a2 * (3 - 2 * y));
+            x++;
+        }
+        y--;
+    }
+}
+
+// Quadrant bits: 1 left-down, 2 left-up, 4 right-up, 8 right-down, the
+// [76h] curve codes 00, 01, 10, 11.
+void RA8876_Model::ellipse(uint8_t quadrants, bool fill, uint32_t c)
+{
+    int32_t cx = reg16(0x7B), cy = reg16(0x7D);
+    int32_t a = reg16(0x77), b = reg16(0x79);
+    int32_t *widest = new int32_t[b + 1];
+
+    if (a == 0 || b == 0)
+    {
+        line(cx - a, cy - b, cx + a, cy + b, c);
+        delete[] widest;
+        return;
+    }
+    rasterEllipse(a, b, widest, [&](int32_t x, int32_t y) {
+        if (fill)
+            return;
+        if (quadrants & 1) plot(cx - x, cy + y, c);
+        if (quadrants & 2) plot(cx - x, cy - y, c);
+        if (quadrants & 4) plot(cx + x, cy - y, c);
+        if (quadrants & 8) plot(cx + x, cy + y, c);
+    });
+    if (fill)
+    {
+        for (int32_t y = 0; y <= b; y++)
+        {
+            int32_t w = widest[y];
+            if (quadrants & 1) span(cx - w, cx, cy + y, c);
+            if (quadrants & 2) span(cx - w, cx, cy - y, c);
+            if (quadrants & 4) span(cx, cx + w, cy - y, c);
+            if (quadrants & 8) span(cx, cx + w, cy + y, c);
+        }
+    }
+    delete[] widest;
+}
+
+// Rectangle from point 1 to point 2 with elliptic corners of radii [77h],
+// [79h], cut down to half the rectangle.
+void RA8876_Model::roundRect(bool fill, uint32_t c)
+{
+    int32_t x1 = reg16(0x68), y1 = reg16(0x6A), x2 = reg16(0x6C), y2 = reg16(0x6E);
+    int32_t a = reg16(0x77), b = reg16(0x79);
+    int32_t t;
+
+    if (x1 > x2) { t = x1; x1 = x2; x2 = t; }
+    if (y1 > y2) { t = y1; y1 = y2; y2 = t; }
+    if (2 * a > x2 - x1) a = (x2 - x1) / 2;
+    if (2 * b > y2 - y1) b = (y2 - y1) / 2;
+
+    int32_t lx = x1 + a, rx = x2 - a, ty = y1 + b, by = y2 - b;
+    int32_t *widest = new int32_t[b + 1];
+
+    rasterEllipse(a, b, widest, [&](int32_t x, int32_t y) {
+        if (fill)
+            return;
+        plot(lx - x, by + y, c);
+        plot(lx - x, ty - y, c);
+        plot(rx + x, ty - y, c);
+        plot(rx + x, by + y, c);
+    });
+    if (fill)
+    {
+        for (int32_t y = 0; y <= b; y++)
+        {
+            span(lx - widest[y], rx + widest[y], ty - y, c);
+            span(lx - widest[y], rx + widest[y], by + y, c);
+        }
+        for (int32_t y = ty + 1; y < by; y++)
+            span(x1, x2, y, c);
+    }
+    else
+    {
+        span(lx, rx, y1, c);
+        span(lx, rx, y2, c);
+        for (int32_t y = ty; y <= by; y++)
+        {
+            plot(x1, y, c);
+            plot(x2, y, c);
+        }
+    }
+    delete[] widest;
+}
+
+// Points 1, 2, 3. A filled triangle covers the rows of its three edges,
+// each from the leftmost to the rightmost edge pixel.
+void RA8876_Model::triangle(bool fill, uint32_t c)
+{
+    int32_t x[3] = { reg16(0x68), reg16(0x6C), reg16(0x70) };
+    int32_t y[3] = { reg16(0x6A), reg16(0x6E), reg16(0x72) };
+
+    if (!fill)
+    {
+        line(x[0], y[0], x[1], y[1], c);
+        line(x[1], y[1], x[2], y[2], c);
+        line(x[2], y[2], x[0], y[0], c);
+        return;
+    }
+
+    int32_t top = y[0], bottom = y[0];
+    for (uint8_t i = 1; i < 3; i++)
+    {
+        if (y[i] < top) top = y[i];
+        if (y[i] > bottom) bottom = y[i];
+    }
+    int32_t rows = bottom - top + 1;
+    int32_t *lo = new int32_t[rows], *hi = new int32_t[rows];
+    for (int32_t i = 0; i < rows; i++)
+    {
+        lo[i] = 0x7FFFFFFF;
+        hi[i] = -1;
+    }
+    for (uint8_t e = 0; e < 3; e++)
+    {
+        int32_t x1 = x[e], y1 = y[e], x2 = x[(e + 1) % 3], y2 = y[(e + 1) % 3];
+        int32_t dx = x2 > x1 ? x2 - x1 : x1 - x2, sx = x1 < x2 ? 1 : -1;
+        int32_t dy = y2 > y1 ? y1 - y2 : y2 - y1, sy = y1 < y2 ? 1 : -1;
+        int32_t err = dx + dy;
+        for (;;)
+        {
+            if (x1 < lo[y1 - top]) lo[y1 - top] = x1;
+            if (x1 > hi[y1 - top]) hi[y1 - top] = x1;
+            if (x1 == x2 && y1 == y2)
+                break;
+            int32_t e2 = 2 * err;
+            if (e2 >= dy) { err += dy; x1 += sx; }
+            if (e2 <= dx) { err += dx; y1 += sy; }
+        }
+    }
+    for (int32_t i = 0; i < rows; i++)
+        if (hi[i] >= 0)
+            span(lo[i], hi[i], top + i, c);
+    delete[] lo;
+    delete[] hi;
+}
+
+// A draw started by writing 'data' with its start bit to DCR0 [67h] or
+// DCR1 [76h], in the foreground colour.
+void RA8876_Model::draw(uint8_t reg, uint8_t data)
+{
+    uint32_t c = colour(0xD2, depth());
+
+    if (reg == 0x67)
+    {
+        if (data & 0x02)
+            triangle(data & 0x20, c);
+        else
+            line(reg16(0x68), reg16(0x6A), reg16(0x6C), reg16(0x6E), c);
+        return;
+    }
+
+    bool fill = data & 0x40;
+    switch ((data >> 4) & 3)
+    {
+    case 0:
+        ellipse(0x0F, fill, c);
+        break;
+    case 1:
+        ellipse(1 << (data & 3), fill, c);
+        break;
+    case 2:
+        if (fill)
+        {
+            int32_t y1 = reg16(0x6A), y2 = reg16(0x6E), t;
+            if (y1 > y2) { t = y1; y1 = y2; y2 = t; }
+            for (int32_t y = y1; y <= y2; y++)
+                span(reg16(0x68), reg16(0x6C), y, c);
+        }
+        else
+        {
+            int32_t x1 = reg16(0x68), y1 = reg16(0x6A), x2 = reg16(0x6C), y2 = reg16(0x6E);
+            line(x1, y1, x2, y1, c);
+            line(x2, y1, x2, y2, c);
+            line(x2, y2, x1, y2, c);
+            line(x1, y2, x1, y1, c);
+        }
+        break;
+    case 3:
+        roundRect(fill, c);
+        break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Pixel (x, y) of BTE source 'src' (0: S0, 1: S1) converted to 'bytes'.
+uint32_t RA8876_Model::bteSource(uint8_t src, uint16_t x, uint16_t y, uint8_t bytes) const
+{
+    uint8_t base = src ? 0x9D : 0x93;
+    uint8_t depth = src ? (reg_8876[0x92] >> 2) & 7 : (reg_8876[0x92] >> 5) & 3;
+    uint8_t from;
+
+    if (src && depth == 3)                  // S1 constant colour
+        return colour(0x9D, bytes);
+    if (src)                                // 8 and 16-bit alpha modes as plain pixels
+        from = depth >= 4 ? depth - 3 : rasterBytes(depth);
+    else
+        from = rasterBytes(depth);
+    uint32_t addr = reg32(base) + ((uint32_t)(reg16(base + 8) + y) * reg16(base + 4) +
+                                   reg16(base + 6) + x) * from;
+    return rasterConvert(get(addr, from), from, bytes);
+}
+
+// Destination pixel (x, y) of the BTE window for S0 pixel 's0' (already in
+// the destination format), by the operation code.
+void RA8876_Model::bteWrite(uint16_t x, uint16_t y, uint32_t s0)
+{
+    uint8_t op = reg_8876[0x91] & 0x0F, rop = reg_8876[0x91] >> 4;
+    uint8_t bytes = rasterBytes(reg_8876[0x92] & 3);
+    uint32_t addr = reg32(0xA7) + ((uint32_t)(reg16(0xAF) + y) * reg16(0xAB) + reg16(0xAD) + x) * bytes;
+    uint32_t d;
+
+    switch (op)
+    {
+    case 4:                                 // chroma key: background colour is transparent
+    case 5:
+    case 7:
+        if (s0 == colour(0xD5, bytes))
+            return;
+        d = s0;
+        break;
+    case 10:                                // opacity
+    case 11:
+    {
+        uint8_t alpha = (reg_8876[0xB5] & 0x20) ? 32 : reg_8876[0xB5] & 0x1F;
+        d = rasterBlend(s0, bteSource(1, x, y, bytes), alpha, bytes);
+        break;
+    }
+    case 8:                                 // colour expansion, s0 is the colour
+    case 9:
+    case 12:                                // solid fill
+        d = s0;
+        break;
+    default:                                // ROP with S1
+        d = rasterRop(rop, s0, bteSource(1, x, y, bytes), bytes);
+        break;
+    }
+    put(addr, bytes, d);
+}
+
+// A BTE that needs no MPU data, run at once.
+void RA8876_Model::bteRun()
+{
+    uint8_t op = reg_8876[0x91] & 0x0F;
+    uint8_t bytes = rasterBytes(reg_8876[0x92] & 3);
+    uint16_t w = reg16(0xB1), h = reg16(0xB3);
+    uint16_t n = (reg_8876[0x90] & 0x01) ? 16 : 8;
+
+    switch (op)
+    {
+    case 2:                                 // memory copy, positive direction
+    case 5:
+    case 10:
+        for (uint16_t y = 0; y < h; y++)
+            for (uint16_t x = 0; x < w; x++)
+                bteWrite(x, y, bteSource(0, x, y, bytes));
+        break;
+    case 3:                                 // memory copy, negative direction
+        for (uint16_t y = h; y-- > 0; )
+            for (uint16_t x = w; x-- > 0; )
+                bteWrite(x, y, bteSource(0, x, y, bytes));
+        break;
+    case 6:                                 // pattern fill from the S0 pattern
+    case 7:
+        for (uint16_t y = 0; y < h; y++)
+            for (uint16_t x = 0; x < w; x++)
+                bteWrite(x, y, bteSource(0, x % n, y % n, bytes));
+        break;
+    case 12:
+    {
+        uint32_t c = colour(0xD2, bytes);
+        for (uint16_t y = 0; y < h; y++)
+            for (uint16_t x = 0; x < w; x++)
+                bteWrite(x, y, c);
+        break;
+    }
+    }
+}
+
+// One byte of MPU data for the running BTE. Colour expansion takes 8 or
+// 16-bit units (16 with a 16bpp S0), low byte first: 1 bits paint the
+// foreground colour, 0 bits the background colour or, with chroma key,
+// nothing. Each row starts a new unit at the start bit in the ROP field
+// and drops the unit's bits past the window edge. The other operations
+// take one S0 pixel per 1, 2 or 3 bytes.
+void RA8876_Model::bteData(uint8_t data)
+{
+    uint8_t op = reg_8876[0x91] & 0x0F;
+    uint8_t s0 = (reg_8876[0x92] >> 5) & 3;
+    uint8_t bytes = rasterBytes(reg_8876[0x92] & 3);
+    uint16_t w = reg16(0xB1), h = reg16(0xB3);
+    uint8_t unit = (op == 8 || op == 9) ? (s0 == 1 ? 2 : 1) : rasterBytes(s0);
+
+    if (w == 0 || bteY_8876 >= h)
+        return;
+    bteUnit_8876 |= (uint32_t)data << (8 * bteHave_8876);
+    if (++bteHave_8876 < unit)
+        return;
+    uint32_t v = bteUnit_8876;
+    bteUnit_8876 = 0;
+    bteHave_8876 = 0;
+
+    if (op == 8 || op == 9)
+    {
+        int8_t bit = bteRow_8876 ? (reg_8876[0x91] >> 4) % (unit * 8) : unit * 8 - 1;
+        uint32_t fg = colour(0xD2, bytes), bg = colour(0xD5, bytes);
+        bteRow_8876 = false;
+        for (; bit >= 0; bit--)
+        {
+            if (v & (1UL << bit))
+                bteWrite(bteX_8876, bteY_8876, fg);
+            else if (op == 8)
+                bteWrite(bteX_8876, bteY_8876, bg);
+            if (++bteX_8876 == w)
+            {
+                bteX_8876 = 0;
+                bteY_8876++;
+                bteRow_8876 = true;
+                break;
+            }
+        }
+        return;
+    }
+    if (op == 0 || op == 4 || op == 11)
+        bteWrite(bteX_8876, bteY_8876, rasterConvert(v, unit, bytes));
+    if (++bteX_8876 == w)
+    {
+        bteX_8876 = 0;
+        bteY_8876++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// One character from the internal CGROM at the text cursor [63h]..[66h],
+// which then moves right, or to the next line at the active window's edge.
+void RA8876_Model::text(uint8_t code)
+{
+    uint8_t size = (reg_8876[0xCC] >> 4) & 3;
+    if (size > 2)
+        size = 2;
+    uint8_t h = 16 + 8 * size, w = h / 2, row = (w + 7) / 8;
+    uint8_t sx = 1 + ((reg_8876[0xCD] >> 2) & 3), sy = 1 + (reg_8876[0xCD] & 3);
+    bool transparent = reg_8876[0xCD] & 0x40;
+    bool internal = (reg_8876[0xCC] & 0xC0) == 0;
+    uint32_t fg = colour(0xD2, depth()), bg = colour(0xD5, depth());
+    int32_t wx = reg16(0x56), wr = wx + reg16(0x5A);
+    int32_t x = reg16(0x63), y = reg16(0x65);
+    static const uint32_t base[3] = { 0, 256 * 16, 256 * (16 + 48) };
+    const uint8_t *glyph = (cgrom_8876 && internal) ? cgrom_8876 + base[size] + (uint32_t)code * h * row : NULL;
+
+    if (x + w * sx > wr)
+    {
+        x = wx;
+        y += h * sy + (reg_8876[0xD0] & 0x1F);
+    }
+    for (uint8_t gy = 0; gy < h; gy++)
+        for (uint8_t gx = 0; gx < w; gx++)
+        {
+            bool ink = glyph && (glyph[gy * row + gx / 8] & (0x80 >> (gx % 8)));
+            if (!ink && transparent)
+                continue;
+            for (uint8_t j = 0; j < sy; j++)
+                for (uint8_t i = 0; i < sx; i++)
+                    plot(x + gx * sx + i, y + gy * sy + j, ink ? fg : bg);
+        }
+    x += w * sx + (reg_8876[0xD1] & 0x3F);
+    setReg16(0x63, x);
+    setReg16(0x65, y);
+}
+
+// Block mode serial flash DMA: [C6h] x [C8h] pixels from the flash image
+// at [BCh], [CAh] pixels per line, to the canvas at [C0h], [C2h].
+void RA8876_Model::dmaRun()
+{
+    uint8_t bytes = depth();
+    uint32_t src = reg32(0xBC);
+    uint16_t w = reg16(0xC6), h = reg16(0xC8), sw = reg16(0xCA);
+    uint16_t dx = reg16(0xC0), dy = reg16(0xC2);
+
+    if (!flash_8876)
+        return;
+    for (uint16_t y = 0; y < h; y++)
+        for (uint16_t x = 0; x < w; x++)
+        {
+            uint32_t a = src + ((uint32_t)y * sw + x) * bytes;
+            if (a + bytes > flashSize_8876)
+                return;
+            uint32_t v = 0;
+            for (uint8_t i = 0; i < bytes; i++)
+                v |= (uint32_t)flash_8876[a + i] << (8 * i);
+            put(reg32(0x50) + ((uint32_t)(dy + y) * reg16(0x54) + dx + x) * bytes, bytes, v);
+        }
+}
+
+//-----------------------------------------------------------------------------
+void RA8876_Model::writePpm(Print &out, uint32_t addr, uint16_t width, uint16_t w, uint16_t h, uint8_t bytes)
+{
+    char head[32];
+
+    snprintf(head, sizeof(head), "P6\n%u %u\n255\n", w, h);
+    out.print(head);
+    for (uint16_t y = 0; y < h; y++)
+        for (uint16_t x = 0; x < w; x++)
+        {
+            uint32_t rgb = rasterToRgb(get(addr + ((uint32_t)y * width + x) * bytes, bytes), bytes);
+            for (int8_t shift = 16; shift >= 0; shift -= 8)
+            {
+                uint8_t c = rgb >> shift;
+                if (bytes == 2)             // repeat the top bits into the low ones
+                    c |= c >> (shift == 8 ? 6 : 5);
+                out.write(c);
+            }
+        }
+}
+
+#endif
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 bus statistics, see RA8876_Stats.h.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ER-TFTM0784-1.h"
+
+#ifdef RA8876_STATS
+
+static const char *const waitNames[RA8876_WAITS] = { "2D", "BTE", "WR FIFO", "SFI DMA", "RD FIFO" };
+
+//-----------------------------------------------------------------------------
+void RA8876_Stats::reset()
+{
+    memset(slot_8876, 0, sizeof(slot_8876));
+}
+
+void RA8876_Stats::snapshot(RA8876_Stats &out, bool clear)
+{
+    out = *this;
+    if (clear)
+        reset();
+}
+
+uint8_t RA8876_Stats::enter(const char *tag)
+{
+    uint8_t prev = cur_8876;
+    uint8_t i;
+
+    for (i = 1; i < used_8876; i++)
+        if (name_8876[i] == tag || strcmp(name_8876[i], tag) == 0)
+            break;
+    if (i == used_8876)
+    {
+        if (used_8876 == RA8876_STATS_TAGS + 1)
+            i = 0;
+        else
+            name_8876[used_8876++] = tag;
+    }
+    cur_8876 = i;
+    return prev;
+}
+
+RA8876_BusStats RA8876_Stats::total() const
+{
+    RA8876_BusStats sum;
+    uint8_t i, w;
+
+    memset(&sum, 0, sizeof(sum));
+    for (i = 0; i < used_8876; i++)
+    {
+        const RA8876_BusStats &s = slot_8876[i];
+        sum.cmd_writes += s.cmd_writes;
+        sum.data_writes += s.data_writes;
+        sum.data_reads += s.data_reads;
+        sum.status_reads += s.status_reads;
+        sum.bursts += s.bursts;
+        sum.bytes += s.bytes;
+        for (w = 0; w < RA8876_WAITS; w++)
+        {
+            sum.polls[w] += s.polls[w];
+            sum.wait_us[w] += s.wait_us[w];
+        }
+    }
+    return sum;
+}
+
+void RA8876_Stats::reportLine(Print &out, const char *name, const RA8876_BusStats &s)
+{
+    out.print("RA8876: ");
+    out.print(name);
+    out.print(": cmd ");
+    out.print(s.cmd_writes);
+    out.print(", write ");
+    out.print(s.data_writes);
+    out.print(", read ");
+    out.print(s.data_reads);
+    out.print(", status ");
+    out.print(s.status_reads);
+    out.print(", bursts ");
+    out.print(s.bursts);
+    out.print(", ");
+    out.print(s.bytes);
+    out.print(" bytes");
+    for (uint8_t w = 0; w < RA8876_WAITS; w++)
+    {
+        if (s.polls[w] == 0)
+            continue;
+        out.print(", ");
+        out.print(waitNames[w]);
+        out.print(" wait ");
+        out.print(s.polls[w]);
+        out.print(" polls ");
+        out.print(s.wait_us[w]);
+        out.print(" us");
+    }
+    out.println();
+}
+
+void RA8876_Stats::report(Print &out) const
+{
+    for (uint8_t i = 0; i < used_8876; i++)
+        reportLine(out, name_8876[i], slot_8876[i]);
+    reportLine(out, "total", total());
+}
+
+#endif // RA8876_STATS
@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 bus statistics
+//
+// Per display counters of the bus cycles RA8876_Driver issues (after the
+// register shadow has dropped what it can), payload bytes, and the polls and
+// time spent in the busy-wait loops. Traffic is attributed to the innermost
+// RA8876_STATS_SCOPE tag active when it happens, untagged traffic to slot 0.
+// The test traffic of LCD_SpiCalibrate() is not counted.
+//
+//   RA8876_STATS_SCOPE(tft, "draw gauge");    // until the end of the block
+//   ...
+//   RA8876_Stats frame;
+//   tft.stats().snapshot(frame, true);        // copy and start over
+//   frame.report(Serial);
+//
+// Enable with RA8876_STATS in ER-TFTM0784-1.h. Without it the counting and
+// RA8876_STATS_SCOPE compile to nothing.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_STATS_H__
+#define __RA8876_STATS_H__
+
+#include <stdint.h>
+
+// Busy-wait loops with their own counters.
+#define RA8876_WAIT_2D          0   // Check_2D_Busy()
+#define RA8876_WAIT_BTE         1   // Check_BTE_Busy()
+#define RA8876_WAIT_WR_FIFO     2   // Check_Mem_WR_FIFO_not_Full()
+#define RA8876_WAIT_SFI_DMA     3   // Check_Busy_SFI_DMA()
+#define RA8876_WAIT_RD_FIFO     4   // memory read FIFO, Readback_Chunk()
+#define RA8876_WAITS            5
+
+struct RA8876_BusStats {
+    uint32_t cmd_writes;
+    uint32_t data_writes;               // register and memory data cycles
+    uint32_t data_reads;
+    uint32_t status_reads;
+    uint32_t bursts;                    // memory write and read bursts
+    uint32_t bytes;                     // data written and read, burst payload
+    uint32_t polls[RA8876_WAITS];       // reads made by each wait loop
+    uint32_t wait_us[RA8876_WAITS];     // time spent in each wait loop
+};
+
+//==============================================================================
+class RA8876_Stats {
+public:
+    RA8876_Stats() : used_8876(1), cur_8876(0)
+    {
+        name_8876[0] = "untagged";
+        reset();
+    }
+
+    // Zero all counters. Tags stay registered.
+    void reset();
+    // Copy the counters to 'out', and zero them if 'clear'.
+    void snapshot(RA8876_Stats &out, bool clear);
+
+    void countCmd() { slot_8876[cur_8876].cmd_writes++; }
+    void countWrite(uint8_t bytes)
+    {
+        slot_8876[cur_8876].data_writes++;
+        slot_8876[cur_8876].bytes += bytes;
+    }
+    void countRead()
+    {
+        slot_8876[cur_8876].data_reads++;
+        slot_8876[cur_8876].bytes++;
+    }
+    void countStatus() { slot_8876[cur_8876].status_reads++; }
+    void countBurst(uint32_t bytes)
+    {
+        slot_8876[cur_8876].bursts++;
+        slot_8876[cur_8876].bytes += bytes;
+    }
+    void countWait(uint8_t which, uint32_t polls, uint32_t us)
+    {
+        slot_8876[cur_8876].polls[which] += polls;
+        slot_8876[cur_8876].wait_us[which] += us;
+    }
+
+    // Make 'tag' the slot traffic is counted in; returns the slot it
+    // replaces, for leave(). Tags are matched by string and must outlive the
+    // object. Past RA8876_STATS_TAGS tags, traffic counts as untagged.
+    uint8_t enter(const char *tag);
+    void leave(uint8_t prev) { cur_8876 = prev; }
+
+    // Slot 0 is untagged traffic, 1..slots()-1 the tags in order of first use.
+    uint8_t slots() const { return used_8876; }
+    const char *name(uint8_t slot) const { return name_8876[slot]; }
+    const RA8876_BusStats &get(uint8_t slot) const { return slot_8876[slot]; }
+    RA8876_BusStats total() const;
+
+    // One line per slot plus the total.
+    void report(Print &out) const;
+
+private:
+    static void reportLine(Print &out, const char *name, const RA8876_BusStats &s);
+
+    RA8876_BusStats slot_8876[RA8876_STATS_TAGS + 1];
+    const char *name_8876[RA8876_STATS_TAGS + 1];
+    uint8_t used_8876;
+    uint8_t cur_8876;
+};
+
+//==============================================================================
+// Counts traffic under 'tag' while in scope; see RA8876_STATS_SCOPE.
+class RA8876_StatsScope {
+public:
+    RA8876_StatsScope(RA8876_Stats &stats, const char *tag)
+        : stats_8876(stats), prev_8876(stats.enter(tag)) { }
+    ~RA8876_StatsScope() { stats_8876.leave(prev_8876); }
+
+private:
+    RA8876_Stats &stats_8876;
+    uint8_t prev_8876;
+};
+
+// Polls and time of one pass through a wait loop, counted when it ends.
+class RA8876_StatsWait {
+public:
+    RA8876_StatsWait(RA8876_Stats &stats, uint8_t which)
+        : stats_8876(stats), which_8876(which), polls_8876(0), start_8876(micros()) { }
+    ~RA8876_StatsWait() { stats_8876.countWait(which_8876, polls_8876, micros() - start_8876); }
+    void poll() { polls_8876++; }
+
+private:
+    RA8876_Stats &stats_8876;
+    uint8_t which_8876;
+    uint32_t polls_8876;
+    uint32_t start_8876;
+};
+
+#endif
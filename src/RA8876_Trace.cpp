@@ -0,0 +1,118 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 bus trace recorder, see RA8876_Trace.h.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ER-TFTM0784-1.h"
+
+#ifdef RA8876_TRACE
+
+//-----------------------------------------------------------------------------
+RA8876_Trace::RA8876_Trace()
+{
+    head_8876 = 0;
+    count_8876 = 0;
+    last_8876 = 0;
+    on_8876 = true;
+#ifndef ARDUINO
+    file_8876 = NULL;
+#endif
+}
+
+void RA8876_Trace::record(uint8_t type, uint8_t reg, uint16_t value)
+{
+    uint32_t now, dt;
+
+    if (!on_8876)
+        return;
+    now = micros();
+    dt = (count_8876 == 0) ? 0 : now - last_8876;
+    last_8876 = now;
+    if (dt > 0xFFFF)
+    {
+        uint32_t ms = dt / 1000;
+        store(RA8876_TRACE_TIME, 0, (ms > 0xFFFF) ? 0xFFFF : ms, 0);
+        dt = 0;
+    }
+    store(type, reg, value, dt);
+}
+
+void RA8876_Trace::store(uint8_t type, uint8_t reg, uint16_t value, uint16_t dt)
+{
+    RA8876_TraceRec &rec = ring_8876[head_8876];
+
+    rec.type = type;
+    rec.reg = reg;
+    rec.value = value;
+    rec.dt = dt;
+    if (++head_8876 == RA8876_TRACE_RECORDS)
+        head_8876 = 0;
+    if (count_8876 < RA8876_TRACE_RECORDS)
+        count_8876++;
+#ifndef ARDUINO
+    if (file_8876)
+    {
+        uint8_t buf[RA8876_TRACE_RECSIZE];
+        pack(rec, buf);
+        fwrite(buf, 1, sizeof(buf), file_8876);
+    }
+#endif
+}
+
+RA8876_TraceRec RA8876_Trace::get(uint16_t i) const
+{
+    uint16_t slot = head_8876 + RA8876_TRACE_RECORDS - count_8876 + i;
+    return ring_8876[slot % RA8876_TRACE_RECORDS];
+}
+
+void RA8876_Trace::header(uint8_t *buf)
+{
+    buf[0] = 'R';
+    buf[1] = 'A';
+    buf[2] = '8';
+    buf[3] = 'T';
+    buf[4] = RA8876_TRACE_VERSION;
+    buf[5] = RA8876_TRACE_RECSIZE;
+    buf[6] = 0;
+    buf[7] = 0;
+}
+
+void RA8876_Trace::pack(const RA8876_TraceRec &rec, uint8_t *buf)
+{
+    buf[0] = rec.type;
+    buf[1] = rec.reg;
+    buf[2] = rec.value & 0xFF;
+    buf[3] = rec.value >> 8;
+    buf[4] = rec.dt & 0xFF;
+    buf[5] = rec.dt >> 8;
+}
+
+void RA8876_Trace::dump(Print &out) const
+{
+    uint8_t buf[8];
+
+    header(buf);
+    out.write(buf, 8);
+    for (uint16_t i = 0; i < count_8876; i++)
+    {
+        pack(get(i), buf);
+        out.write(buf, RA8876_TRACE_RECSIZE);
+    }
+}
+
+#ifndef ARDUINO
+void RA8876_Trace::setFile(FILE *file)
+{
+    uint8_t buf[8];
+
+    file_8876 = file;
+    if (file)
+    {
+        header(buf);
+        fwrite(buf, 1, sizeof(buf), file);
+    }
+}
+#endif
+
+#endif // RA8876_TRACE
@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// RA8876 bus trace recorder
+//
+// RA8876_TraceBus<Bus> wraps a transport and logs every cycle that goes over
+// the wire: command, data and status cycles, memory bursts and resets, each
+// with the time since the record before. Records go to a RAM ring buffer
+// (dump() sends it to a Print, e.g. Serial) and, on host builds, can also be
+// streamed to a file. extras/ra8876_trace decodes, summarises and replays
+// the result.
+//
+// Enable with RA8876_TRACE in ER-TFTM0784-1.h; ER_TFTM0784 then traces its
+// bus and tft.bus().trace() reaches the recorder.
+//
+// Trace format, little endian: an 8 byte header "RA8T", version, record
+// size, 2 reserved bytes, then 6 byte records:
+//   uint8_t  type     RA8876_TRACE_*
+//   uint8_t  reg      register selected by the last command cycle
+//   uint16_t value    cycle data
+//   uint16_t dt       microseconds since the previous record, saturating
+// A gap longer than 65535 us is preceded by a TIME record holding it in ms.
+// A BURST record is written when the burst ends; its byte count is
+// value | reg << 16 and dt covers the whole burst. A READBURST record, for
+// pixels read from the memory port, counts its bytes the same way.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RA8876_TRACE_H__
+#define __RA8876_TRACE_H__
+
+#include <stdint.h>
+
+#define RA8876_TRACE_CMD        0   // command write, value = register
+#define RA8876_TRACE_DATA       1   // data write
+#define RA8876_TRACE_DATA16     2   // 16-bit memory data write
+#define RA8876_TRACE_READ       3   // data read, value = data returned
+#define RA8876_TRACE_STATUS     4   // status read, value = status returned
+#define RA8876_TRACE_BURST      5   // memory write burst
+#define RA8876_TRACE_RESET      6   // hardware reset pulse
+#define RA8876_TRACE_TIME       7   // long gap, value = milliseconds
+#define RA8876_TRACE_READBURST  8   // memory read burst
+#define RA8876_TRACE_TYPES      9
+
+#define RA8876_TRACE_VERSION    1
+#define RA8876_TRACE_RECSIZE    6
+
+struct RA8876_TraceRec {
+    uint8_t type;
+    uint8_t reg;
+    uint16_t value;
+    uint16_t dt;
+};
+
+//==============================================================================
+class RA8876_Trace {
+public:
+    RA8876_Trace();
+
+    void enable(bool on) { on_8876 = on; }
+    void clear() { head_8876 = 0; count_8876 = 0; }
+    void record(uint8_t type, uint8_t reg, uint16_t value);
+
+    // Records held, oldest first.
+    uint16_t count() const { return count_8876; }
+    RA8876_TraceRec get(uint16_t i) const;
+
+    // Header and all records held, in the trace format.
+    void dump(Print &out) const;
+#ifndef ARDUINO
+    // Also append every new record to 'file'; writes the header now.
+    void setFile(FILE *file);
+#endif
+
+    static void header(uint8_t *buf);
+    static void pack(const RA8876_TraceRec &rec, uint8_t *buf);
+
+private:
+    void store(uint8_t type, uint8_t reg, uint16_t value, uint16_t dt);
+
+    RA8876_TraceRec ring_8876[RA8876_TRACE_RECORDS];
+    uint16_t head_8876;     // next slot to write
+    uint16_t count_8876;
+    uint32_t last_8876;     // micros() of the previous record
+    bool on_8876;
+#ifndef ARDUINO
+    FILE *file_8876;
+#endif
+};
+
+//==============================================================================
+// Transport wrapper; constructor arguments are passed on to Bus.
+template<class Bus>
+class RA8876_TraceBus : public Bus {
+public:
+    template<typename... Args>
+    RA8876_TraceBus(Args... args) : Bus(args...), reg_8876(0), burst_8876(0) { }
+
+    RA8876_Trace &trace() { return trace_8876; }
+
+    void hwReset()
+    {
+        Bus::hwReset();
+        trace_8876.record(RA8876_TRACE_RESET, 0, 0);
+    }
+    void cmdWrite(uint8_t Cmd)
+    {
+        Bus::cmdWrite(Cmd);
+        reg_8876 = Cmd;
+        trace_8876.record(RA8876_TRACE_CMD, Cmd, Cmd);
+    }
+    void dataWrite(uint8_t data)
+    {
+        Bus::dataWrite(data);
+        trace_8876.record(RA8876_TRACE_DATA, reg_8876, data);
+    }
+    void dataWrite16(uint16_t data)
+    {
+        Bus::dataWrite16(data);
+        trace_8876.record(RA8876_TRACE_DATA16, reg_8876, data);
+    }
+    uint16_t dataRead()
+    {
+        uint16_t data = Bus::dataRead();
+        trace_8876.record(RA8876_TRACE_READ, reg_8876, data);
+        return data;
+    }
+    uint8_t statusRead()
+    {
+        uint8_t data = Bus::statusRead();
+        trace_8876.record(RA8876_TRACE_STATUS, reg_8876, data);
+        return data;
+    }
+
+    void burstBegin()
+    {
+        Bus::burstBegin();
+        burst_8876 = 0;
+    }
+    void burstWrite8(uint8_t data)
+    {
+        Bus::burstWrite8(data);
+        burst_8876 += 1;
+    }
+    void burstWrite16(uint16_t data)
+    {
+        Bus::burstWrite16(data);
+        burst_8876 += 2;
+    }
+    void burstPixels(const uint16_t *data, uint32_t count)
+    {
+        Bus::burstPixels(data, count);
+        burst_8876 += count * 2;
+    }
+    bool burstAsync(const uint16_t *data, uint32_t count)
+    {
+        if (!Bus::burstAsync(data, count))
+            return false;
+        burst_8876 += count * 2;
+        return true;
+    }
+    void burstEnd()
+    {
+        Bus::burstEnd();
+        if (burst_8876 > 0xFFFFFF)
+            burst_8876 = 0xFFFFFF;
+        trace_8876.record(RA8876_TRACE_BURST, burst_8876 >> 16, burst_8876);
+    }
+    void burstReadPixels(uint16_t *data, uint32_t count)
+    {
+        uint32_t bytes = count * 2;
+
+        Bus::burstReadPixels(data, count);
+        if (bytes > 0xFFFFFF)
+            bytes = 0xFFFFFF;
+        trace_8876.record(RA8876_TRACE_READBURST, bytes >> 16, bytes);
+    }
+
+private:
+    uint8_t reg_8876;
+    uint32_t burst_8876;    // bytes in the running burst
+    RA8876_Trace trace_8876;
+};
+
+#endif